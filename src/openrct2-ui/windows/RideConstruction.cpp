@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Viewport.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -459,6 +460,10 @@ static bool _boosterTrackSelected;
 
 static uint32_t _currentDisabledSpecialTrackPieces;
 
+// What the ride would be rated with the track as it is now and the stats of its last test run. Worked out when the
+// construction changes, not on every paint.
+static std::optional<rating_tuple> _estimatedRatings;
+
 static void window_ride_construction_construct(rct_window* w);
 static void window_ride_construction_mouseup_demolish(rct_window* w);
 static void window_ride_construction_rotate(rct_window* w);
@@ -473,6 +478,7 @@ static void sub_6CBCE2(
     int32_t originY, int32_t originZ);
 static void window_ride_construction_update_map_selection();
 static void window_ride_construction_update_possible_ride_configurations();
+static void window_ride_construction_update_estimated_ratings();
 static void window_ride_construction_update_widgets(rct_window* w);
 static void window_ride_construction_select_map_tiles(
     Ride* ride, int32_t trackType, int32_t trackDirection, int32_t x, int32_t y);
@@ -2333,6 +2339,25 @@ static void window_ride_construction_paint(rct_window* w, rct_drawpixelinfo* dpi
             w, &clipdpi, rideIndex, trackType, trackDirection, liftHillAndAlternativeState, width, height);
     }
 
+    // Draw estimated ratings
+    if (_estimatedRatings)
+    {
+        x = w->x + widget->left + 3;
+        y = w->y + widget->top + 2;
+        width = widget->right - widget->left - 5;
+
+        fixed32_2dp rating = _estimatedRatings->excitement;
+        gfx_draw_string_left_clipped(dpi, STR_TRACK_LIST_EXCITEMENT_RATING, &rating, COLOUR_BLACK, x, y, width);
+        y += LIST_ROW_HEIGHT;
+
+        rating = _estimatedRatings->intensity;
+        gfx_draw_string_left_clipped(dpi, STR_TRACK_LIST_INTENSITY_RATING, &rating, COLOUR_BLACK, x, y, width);
+        y += LIST_ROW_HEIGHT;
+
+        rating = _estimatedRatings->nausea;
+        gfx_draw_string_left_clipped(dpi, STR_TRACK_LIST_NAUSEA_RATING, &rating, COLOUR_BLACK, x, y, width);
+    }
+
     // Draw cost
     x = w->x + (widget->left + widget->right) / 2;
     y = w->y + widget->bottom - 23;
@@ -2520,9 +2545,30 @@ void window_ride_construction_update_active_elements_impl()
     }
 
     window_ride_construction_update_possible_ride_configurations();
+    window_ride_construction_update_estimated_ratings();
     window_ride_construction_update_widgets(w);
 }
 
+static void window_ride_construction_update_estimated_ratings()
+{
+    _estimatedRatings = std::nullopt;
+
+    // Without a test run there are no stats to rate the layout with
+    auto ride = get_ride(_currentRideIndex);
+    if (ride == nullptr || ride_get_total_length(ride) == 0)
+        return;
+
+    // Rate the ride as if it had been opened and tested again
+    auto snapshot = RideRatingsSnapshot::FromRide(*ride);
+    snapshot.GetRide().status = RIDE_STATUS_OPEN;
+    snapshot.GetRide().lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    auto result = ride_ratings_evaluate(snapshot);
+    if (result && result->Ratings.excitement != RIDE_RATING_UNDEFINED)
+    {
+        _estimatedRatings = result->Ratings;
+    }
+}
+
 /**
  *
  *  rct2: 0x006C6A77
@@ -581,15 +581,24 @@ static void window_track_list_paint(rct_window* w, rct_drawpixelinfo* dpi)
     y = w->y + widget->bottom + 2;
 
     // Stats
-    fixed32_2dp rating = _loadedTrackDesign->excitement * 10;
+    // Designs saved before the ride was rated store no ratings, use the ones worked out when the design was indexed
+    rating_tuple ratings = _trackDesigns[trackIndex].ratings;
+    if (_loadedTrackDesign->excitement != 0 || ratings.excitement == RIDE_RATING_UNDEFINED)
+    {
+        ratings.excitement = _loadedTrackDesign->excitement * 10;
+        ratings.intensity = _loadedTrackDesign->intensity * 10;
+        ratings.nausea = _loadedTrackDesign->nausea * 10;
+    }
+
+    fixed32_2dp rating = ratings.excitement;
     gfx_draw_string_left(dpi, STR_TRACK_LIST_EXCITEMENT_RATING, &rating, COLOUR_BLACK, x, y);
     y += LIST_ROW_HEIGHT;
 
-    rating = _loadedTrackDesign->intensity * 10;
+    rating = ratings.intensity;
     gfx_draw_string_left(dpi, STR_TRACK_LIST_INTENSITY_RATING, &rating, COLOUR_BLACK, x, y);
     y += LIST_ROW_HEIGHT;
 
-    rating = _loadedTrackDesign->nausea * 10;
+    rating = ratings.nausea;
     gfx_draw_string_left(dpi, STR_TRACK_LIST_NAUSEA_RATING, &rating, COLOUR_BLACK, x, y);
     y += LIST_ROW_HEIGHT + 4;
 
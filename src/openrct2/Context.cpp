@@ -901,6 +901,7 @@ namespace OpenRCT2
 
             if (!_isWindowMinimised && !gOpenRCT2Headless)
             {
+                gfx_object_evict_images((size_t)std::max(0, gConfigGeneral.object_image_budget) * 1024 * 1024);
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
@@ -946,6 +947,7 @@ namespace OpenRCT2
                 const float alpha = std::min((float)_accumulator / GAME_UPDATE_TIME_MS, 1.0f);
                 sprite_position_tween_all(alpha);
 
+                gfx_object_evict_images((size_t)std::max(0, gConfigGeneral.object_image_budget) * 1024 * 1024);
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
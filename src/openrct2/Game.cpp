@@ -685,6 +685,8 @@ void game_load_init()
 
     IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
     snapshots->Reset();
+    sprite_incremental_checksum_invalidate();
+    sprite_hot_fields_rebuild();
 
     gScreenFlags = SCREEN_FLAGS_PLAYING;
     audio_stop_all_music_and_sounds();
@@ -16,6 +16,7 @@
 #include "Input.h"
 #include "OpenRCT2.h"
 #include "ReplayManager.h"
+#include "TickProfiler.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
 #include "interface/Screenshot.h"
@@ -225,12 +226,15 @@ void GameState::Update()
 
 void GameState::UpdateLogic()
 {
+    PROFILE_TICK_BEGIN();
+
     gScreenAge++;
     if (gScreenAge == 0)
         gScreenAge--;
 
     GetContext()->GetReplayManager()->Update();
 
+    PROFILE_TICK_SECTION(Network);
     network_update();
 
     if (network_get_mode() == NETWORK_MODE_SERVER)
@@ -261,35 +265,52 @@ void GameState::UpdateLogic()
         }
     }
 
+    PROFILE_TICK_SECTION(Date);
     date_update();
     _date = Date(gDateMonthTicks, gDateMonthTicks);
 
+    PROFILE_TICK_SECTION(Scenario);
     scenario_update();
+    PROFILE_TICK_SECTION(Climate);
     climate_update();
+    PROFILE_TICK_SECTION(MapTiles);
     map_update_tiles();
     // Temporarily remove provisional paths to prevent peep from interacting with them
     map_remove_provisional_elements();
+    PROFILE_TICK_SECTION(PathWideFlags);
     map_update_path_wide_flags();
+    PROFILE_TICK_SECTION(Peeps);
     peep_update_all();
     map_restore_provisional_elements();
+    PROFILE_TICK_SECTION(Vehicles);
     vehicle_update_all();
+    PROFILE_TICK_SECTION(MiscSprites);
     sprite_misc_update_all();
+    PROFILE_TICK_SECTION(Rides);
     Ride::UpdateAll();
 
+    PROFILE_TICK_SECTION(Park);
     if (!(gScreenFlags & SCREEN_FLAGS_EDITOR))
     {
         _park->Update(_date);
     }
 
+    PROFILE_TICK_SECTION(Research);
     research_update();
+    PROFILE_TICK_SECTION(RideRatings);
     ride_ratings_update_all();
+    PROFILE_TICK_SECTION(RideMeasurements);
     ride_measurements_update();
+    PROFILE_TICK_SECTION(News);
     news_item_update_current();
 
+    PROFILE_TICK_SECTION(MapAnimations);
     map_animation_invalidate_all();
+    PROFILE_TICK_SECTION(Sounds);
     vehicle_sounds_update();
     peep_update_crowd_noise();
     climate_update_sound();
+    PROFILE_TICK_LEAVE();
     editor_open_windows_for_current_step();
 
     // Update windows
@@ -301,11 +322,15 @@ void GameState::UpdateLogic()
         gLastAutoSaveUpdate = Platform::GetTicks();
     }
 
+    PROFILE_TICK_SECTION(GameActions);
     GameActions::ProcessQueue();
 
+    PROFILE_TICK_SECTION(Network);
     network_process_pending();
     network_flush();
 
+    PROFILE_TICK_END();
+
     gCurrentTicks++;
     gScenarioTicks++;
     gSavedAge++;
@@ -105,6 +105,7 @@ namespace OpenRCT2
             RECORDING,
             PLAYING,
             NORMALISATION,
+            ACTIONS,
         };
 
     public:
@@ -127,6 +128,11 @@ namespace OpenRCT2
             return _mode == ReplayMode::NORMALISATION;
         }
 
+        virtual bool IsPlayingActions() const override
+        {
+            return _mode == ReplayMode::ACTIONS;
+        }
+
         virtual void AddGameAction(uint32_t tick, const GameAction* action) override
         {
             if (_currentRecording == nullptr)
@@ -195,6 +201,16 @@ namespace OpenRCT2
                     return;
                 }
             }
+            else if (_mode == ReplayMode::ACTIONS)
+            {
+                ReplayCommands();
+
+                if (_currentReplay->commands.empty())
+                {
+                    StopPlayback();
+                    return;
+                }
+            }
         }
 
         virtual bool StartRecording(const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/) override
@@ -310,7 +326,7 @@ namespace OpenRCT2
         {
             ReplayRecordData* data = nullptr;
 
-            if (_mode == ReplayMode::PLAYING)
+            if (_mode == ReplayMode::PLAYING || _mode == ReplayMode::ACTIONS)
                 data = _currentReplay.get();
             else if (_mode == ReplayMode::RECORDING)
                 data = _currentRecording.get();
@@ -326,7 +342,7 @@ namespace OpenRCT2
             info.TimeRecorded = data->timeRecorded;
             if (_mode == ReplayMode::RECORDING)
                 info.Ticks = gCurrentTicks - data->tickStart;
-            else if (_mode == ReplayMode::PLAYING)
+            else if (_mode == ReplayMode::PLAYING || _mode == ReplayMode::ACTIONS)
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = (uint32_t)data->commands.size();
             info.NumChecksums = (uint32_t)data->checksums.size();
@@ -379,7 +395,7 @@ namespace OpenRCT2
 
         virtual bool StopPlayback() override
         {
-            if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
+            if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION && _mode != ReplayMode::ACTIONS)
                 return false;
 
             // During normal playback we pause the game if stopped.
@@ -420,6 +436,58 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool LoadReplayPark(const std::string& file) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            auto replayData = std::make_unique<ReplayRecordData>();
+
+            if (!ReadReplayData(file, *replayData))
+            {
+                log_error("Unable to read replay data.");
+                return false;
+            }
+
+            if (!LoadReplayDataMap(*replayData))
+            {
+                log_error("Unable to load map.");
+                return false;
+            }
+
+            gCurrentTicks = replayData->tickStart;
+
+            return true;
+        }
+
+        virtual bool StartActionPlayback(const std::string& file) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            auto replayData = std::make_unique<ReplayRecordData>();
+
+            if (!ReadReplayData(file, *replayData))
+            {
+                log_error("Unable to read replay data.");
+                return false;
+            }
+
+            if (replayData->commands.empty())
+            {
+                log_error("Replay has no game actions.");
+                return false;
+            }
+
+            // The commands keep their distance to the start of the replay.
+            _actionTickOffset = gCurrentTicks - replayData->tickStart;
+
+            _currentReplay = std::move(replayData);
+            _mode = ReplayMode::ACTIONS;
+
+            return true;
+        }
+
     private:
         bool LoadReplayDataMap(ReplayRecordData& data)
         {
@@ -443,6 +511,7 @@ namespace OpenRCT2
                 // In case the sprite limit will be increased we keep the unused fields cleared.
                 std::fill_n(gSpriteSpatialIndex, std::size(gSpriteSpatialIndex), SPRITE_INDEX_NULL);
                 std::memcpy(gSpriteSpatialIndex, data.spriteSpatialData.GetData(), data.spriteSpatialData.GetLength());
+                sprite_typed_spatial_index_rebuild();
 
                 // Load all map global variables.
                 DataSerialiser parkParamsDs(false, data.parkParams);
@@ -755,11 +824,21 @@ namespace OpenRCT2
 
                     _nextReplayTick = gCurrentTicks + 1;
                 }
+                else if (_mode == ReplayMode::ACTIONS)
+                {
+                    if (command.tick + _actionTickOffset > gCurrentTicks)
+                        break;
+                }
 
                 bool isPositionValid = false;
 
                 GameAction* action = command.action.get();
                 action->SetFlags(action->GetFlags() | GAME_COMMAND_FLAG_REPLAY);
+                if (_mode == ReplayMode::ACTIONS)
+                {
+                    // Actions recorded in a network game would otherwise not be sent to the server.
+                    action->SetFlags(action->GetFlags() & ~GAME_COMMAND_FLAG_NETWORKED);
+                }
 
                 GameActionResult::Ptr result = GameActions::Execute(action);
                 if (result->Error == GA_ERROR::OK)
@@ -787,6 +866,7 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _actionTickOffset = 0;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager()
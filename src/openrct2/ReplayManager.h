@@ -54,6 +54,13 @@ namespace OpenRCT2
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
+
+        // Loads the park the replay was recorded on without playing it back.
+        virtual bool LoadReplayPark(const std::string& file) = 0;
+        // Executes the game actions of the replay from the current tick onwards on whatever park is loaded, as a
+        // client they are sent to the server like actions of a player.
+        virtual bool StartActionPlayback(const std::string& file) = 0;
+        virtual bool IsPlayingActions() const = 0;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager();
@@ -0,0 +1,186 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickProfiler.h"
+
+#include "Game.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+
+namespace OpenRCT2::TickProfiler
+{
+    static constexpr size_t SectionCount = (size_t)TickSection::Count;
+
+    static constexpr const char* SectionNames[] = {
+        "network",
+        "date",
+        "scenario",
+        "climate",
+        "map_tiles",
+        "path_wide_flags",
+        "peeps",
+        "peep_housekeeping",
+        "vehicles",
+        "misc_sprites",
+        "rides",
+        "park",
+        "research",
+        "ride_ratings",
+        "ride_measurements",
+        "news",
+        "map_animations",
+        "sounds",
+        "game_actions",
+    };
+    static_assert(std::size(SectionNames) == SectionCount, "Every tick section needs a name");
+
+    struct FileCloser
+    {
+        void operator()(std::FILE* file) const
+        {
+            std::fclose(file);
+        }
+    };
+
+    static bool _enabled = false;
+    static uint64_t _tickCount = 0;
+    static std::array<SectionStats, SectionCount> _stats{};
+    static std::array<uint64_t, SectionCount> _currentTick{};
+    static std::unique_ptr<std::FILE, FileCloser> _output;
+
+    const char* GetSectionName(TickSection section)
+    {
+        return SectionNames[(size_t)section];
+    }
+
+    bool IsEnabled()
+    {
+        return _enabled;
+    }
+
+    void SetEnabled(bool enabled)
+    {
+        _enabled = enabled;
+        _currentTick = {};
+    }
+
+    void Reset()
+    {
+        _tickCount = 0;
+        _stats = {};
+        _currentTick = {};
+    }
+
+    bool OpenOutput(const std::string& path)
+    {
+        _output.reset(std::fopen(path.c_str(), "w"));
+        if (_output == nullptr)
+        {
+            log_error("Unable to open '%s' for the tick profile.", path.c_str());
+            return false;
+        }
+
+        std::fprintf(_output.get(), "tick");
+        for (auto name : SectionNames)
+        {
+            std::fprintf(_output.get(), ",%s_us", name);
+        }
+        std::fprintf(_output.get(), ",total_us\n");
+
+        SetEnabled(true);
+        return true;
+    }
+
+    void CloseOutput()
+    {
+        _output.reset();
+    }
+
+    void Record(TickSection section, Clock::duration duration)
+    {
+        _currentTick[(size_t)section] += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    }
+
+    void RecordNested(TickSection parent, TickSection section, Clock::duration duration)
+    {
+        // The parent is recorded when it is left, the unsigned wrap-around until then is intended
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        _currentTick[(size_t)section] += ns;
+        _currentTick[(size_t)parent] -= ns;
+    }
+
+    static size_t GetBucket(uint64_t ns)
+    {
+        uint64_t us = ns / 1000;
+        size_t bucket = 0;
+        while (bucket < HistogramBucketCount - 1 && us >= (1ULL << bucket))
+        {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    void EndTick()
+    {
+        _tickCount++;
+        uint64_t totalNs = 0;
+        for (size_t i = 0; i < SectionCount; i++)
+        {
+            auto ns = _currentTick[i];
+            auto& stats = _stats[i];
+            stats.Ticks++;
+            stats.TotalNs += ns;
+            stats.MaxNs = std::max(stats.MaxNs, ns);
+            stats.LastNs = ns;
+            stats.Histogram[GetBucket(ns)]++;
+            totalNs += ns;
+        }
+
+        if (_output != nullptr)
+        {
+            std::fprintf(_output.get(), "%u", gCurrentTicks);
+            for (auto ns : _currentTick)
+            {
+                std::fprintf(_output.get(), ",%.1f", ns / 1000.0);
+            }
+            std::fprintf(_output.get(), ",%.1f\n", totalNs / 1000.0);
+        }
+        _currentTick = {};
+    }
+
+    uint64_t GetTickCount()
+    {
+        return _tickCount;
+    }
+
+    const SectionStats& GetStats(TickSection section)
+    {
+        return _stats[(size_t)section];
+    }
+
+    uint64_t GetPercentileUs(TickSection section, uint32_t percentile)
+    {
+        const auto& stats = GetStats(section);
+        uint64_t threshold = (stats.Ticks * std::min<uint32_t>(percentile, 100) + 99) / 100;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < HistogramBucketCount; i++)
+        {
+            seen += stats.Histogram[i];
+            if (seen >= threshold && seen != 0)
+            {
+                // Report the upper bound of the bucket, the last one is open ended so use the maximum.
+                return i == HistogramBucketCount - 1 ? stats.MaxNs / 1000 : (1ULL << i);
+            }
+        }
+        return 0;
+    }
+} // namespace OpenRCT2::TickProfiler
@@ -0,0 +1,195 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <array>
+#include <chrono>
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * The parts of GameState::UpdateLogic that are timed by the tick profiler.
+     */
+    enum class TickSection : uint8_t
+    {
+        Network,
+        Date,
+        Scenario,
+        Climate,
+        MapTiles,
+        PathWideFlags,
+        Peeps,
+        // The 128 tick guest and staff update, timed inside Peeps.
+        PeepHousekeeping,
+        Vehicles,
+        MiscSprites,
+        Rides,
+        Park,
+        Research,
+        RideRatings,
+        RideMeasurements,
+        News,
+        MapAnimations,
+        Sounds,
+        GameActions,
+        Count,
+    };
+
+    namespace TickProfiler
+    {
+        // Bucket i counts section times below 2^i microseconds, the last bucket everything above.
+        constexpr size_t HistogramBucketCount = 16;
+
+        struct SectionStats
+        {
+            uint64_t Ticks;
+            uint64_t TotalNs;
+            uint64_t MaxNs;
+            uint64_t LastNs;
+            std::array<uint32_t, HistogramBucketCount> Histogram;
+        };
+
+        using Clock = std::chrono::high_resolution_clock;
+
+        const char* GetSectionName(TickSection section);
+
+        bool IsEnabled();
+        void SetEnabled(bool enabled);
+        void Reset();
+
+        /**
+         * Writes the time of every section for each tick as CSV to the given file, enables the profiler.
+         */
+        bool OpenOutput(const std::string& path);
+        void CloseOutput();
+
+        void Record(TickSection section, Clock::duration duration);
+
+        /**
+         * Records time spent in a section nested inside another, taking it out of the parent so the tick total is unchanged.
+         */
+        void RecordNested(TickSection parent, TickSection section, Clock::duration duration);
+        void EndTick();
+
+        uint64_t GetTickCount();
+        const SectionStats& GetStats(TickSection section);
+
+        /**
+         * Estimates the given percentile (0-100) of a section in microseconds from its histogram.
+         */
+        uint64_t GetPercentileUs(TickSection section, uint32_t percentile);
+    } // namespace TickProfiler
+
+    /**
+     * Times consecutive sections of a tick, entering a section closes the previous one and EndTick closes the last.
+     * Only reads the clock when the profiler is enabled.
+     */
+    class TickSectionTimer
+    {
+    private:
+        TickProfiler::Clock::time_point _start;
+        TickSection _section = TickSection::Count;
+        bool _enabled;
+
+    public:
+        TickSectionTimer()
+            : _enabled(TickProfiler::IsEnabled())
+        {
+        }
+
+        TickSectionTimer(const TickSectionTimer&) = delete;
+        TickSectionTimer& operator=(const TickSectionTimer&) = delete;
+
+        void Enter(TickSection section)
+        {
+            if (_enabled)
+            {
+                auto now = TickProfiler::Clock::now();
+                if (_section != TickSection::Count)
+                {
+                    TickProfiler::Record(_section, now - _start);
+                }
+                _section = section;
+                _start = now;
+            }
+        }
+
+        void Leave()
+        {
+            if (_enabled && _section != TickSection::Count)
+            {
+                TickProfiler::Record(_section, TickProfiler::Clock::now() - _start);
+                _section = TickSection::Count;
+            }
+        }
+
+        void EndTick()
+        {
+            if (_enabled)
+            {
+                Leave();
+                TickProfiler::EndTick();
+            }
+        }
+    };
+
+    /**
+     * Times a section nested inside another for as long as it is in scope.
+     */
+    class TickNestedSectionTimer
+    {
+    private:
+        TickProfiler::Clock::time_point _start;
+        TickSection _parent;
+        TickSection _section;
+        bool _enabled;
+
+    public:
+        TickNestedSectionTimer(TickSection parent, TickSection section)
+            : _parent(parent)
+            , _section(section)
+            , _enabled(TickProfiler::IsEnabled())
+        {
+            if (_enabled)
+            {
+                _start = TickProfiler::Clock::now();
+            }
+        }
+
+        TickNestedSectionTimer(const TickNestedSectionTimer&) = delete;
+        TickNestedSectionTimer& operator=(const TickNestedSectionTimer&) = delete;
+
+        ~TickNestedSectionTimer()
+        {
+            if (_enabled)
+            {
+                TickProfiler::RecordNested(_parent, _section, TickProfiler::Clock::now() - _start);
+            }
+        }
+    };
+} // namespace OpenRCT2
+
+#ifdef DISABLE_TICK_PROFILER
+#    define PROFILE_TICK_BEGIN()
+#    define PROFILE_TICK_SECTION(section)
+#    define PROFILE_TICK_LEAVE()
+#    define PROFILE_TICK_END()
+#    define PROFILE_TICK_NESTED(parent, section)
+#else
+#    define PROFILE_TICK_BEGIN() OpenRCT2::TickSectionTimer _tickSectionTimer
+#    define PROFILE_TICK_SECTION(section) _tickSectionTimer.Enter(OpenRCT2::TickSection::section)
+#    define PROFILE_TICK_LEAVE() _tickSectionTimer.Leave()
+#    define PROFILE_TICK_END() _tickSectionTimer.EndTick()
+#    define PROFILE_TICK_NESTED(parent, section)                                                                               \
+        OpenRCT2::TickNestedSectionTimer _tickNestedSectionTimer(OpenRCT2::TickSection::parent, OpenRCT2::TickSection::section)
+#endif
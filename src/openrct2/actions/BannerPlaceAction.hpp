@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Banner.h"
 #include "../world/MapAnimation.h"
 #include "../world/Scenery.h"
@@ -158,6 +159,7 @@ public:
             bannerElement->SetGhost(true);
         }
         map_invalidate_tile_full(_loc.x, _loc.y);
+        peep_pathfind_invalidate_paths(_loc);
         map_animation_create(MAP_ANIMATION_TYPE_BANNER, _loc.x, _loc.y, bannerElement->base_height);
 
         rct_scenery_entry* bannerEntry = get_banner_entry(_bannerType);
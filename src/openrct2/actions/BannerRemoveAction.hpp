@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Banner.h"
 #include "../world/MapAnimation.h"
 #include "../world/Scenery.h"
@@ -122,6 +123,7 @@ public:
         tile_element_remove_banner_entry(reinterpret_cast<TileElement*>(bannerElement));
         map_invalidate_tile_zoom1(_loc.x, _loc.y, _loc.z / 8, _loc.z / 8 + 32);
         bannerElement->Remove();
+        peep_pathfind_invalidate_paths(_loc);
 
         return res;
     }
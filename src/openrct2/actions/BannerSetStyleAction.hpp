@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../windows/Intent.h"
 #include "../world/Banner.h"
 #include "GameAction.h"
@@ -153,6 +154,7 @@ public:
                     allowedEdges &= ~(1 << bannerElement->GetPosition());
                 }
                 bannerElement->SetAllowedEdges(allowedEdges);
+                peep_pathfind_invalidate_paths({ banner->position.x * 32, banner->position.y * 32 });
                 break;
             }
             default:
@@ -15,6 +15,7 @@
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Footpath.h"
 #include "../world/Location.hpp"
 #include "../world/Park.h"
@@ -196,6 +197,8 @@ private:
         }
         pathElement->SetAddition(0);
         pathElement->SetIsBroken(false);
+        map_invalidate_path_wide_flags(_loc);
+        peep_pathfind_invalidate_paths(_loc);
 
         RemoveIntersectingWalls(pathElement);
         return res;
@@ -354,6 +357,8 @@ private:
             {
                 pathElement->SetGhost(true);
             }
+            map_invalidate_path_wide_flags(_loc);
+            peep_pathfind_invalidate_paths(_loc);
             footpath_queue_chain_reset();
 
             if (!(GetFlags() & GAME_COMMAND_FLAG_PATH_SCENERY))
@@ -15,6 +15,7 @@
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Footpath.h"
 #include "../world/Location.hpp"
 #include "../world/Park.h"
@@ -270,6 +271,8 @@ private:
             {
                 pathElement->SetGhost(true);
             }
+            map_invalidate_path_wide_flags(_loc);
+            peep_pathfind_invalidate_paths(_loc);
             map_invalidate_tile_full(_loc.x, _loc.y);
         }
 
@@ -15,6 +15,7 @@
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Footpath.h"
 #include "../world/Location.hpp"
 #include "../world/Park.h"
@@ -94,6 +95,8 @@ public:
             footpath_remove_edges_at(_loc.x, _loc.y, footpathElement);
             map_invalidate_tile_full(_loc.x, _loc.y);
             tile_element_remove(footpathElement);
+            map_invalidate_path_wide_flags(_loc);
+            peep_pathfind_invalidate_paths(_loc);
             footpath_update_queue_chains();
         }
         else
@@ -11,6 +11,7 @@
 
 #include "../OpenRCT2.h"
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../world/Entrance.h"
 #include "../world/Park.h"
 #include "GameAction.h"
@@ -103,6 +104,7 @@ private:
 
         map_invalidate_tile(loc.x, loc.y, entranceElement->base_height * 8, entranceElement->clearance_height * 8);
         entranceElement->Remove();
+        peep_pathfind_invalidate_paths(loc);
         update_park_fences({ loc.x, loc.y });
     }
 };
@@ -17,6 +17,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
+#include "../peep/Peep.h"
 #include "../ride/Ride.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
@@ -134,6 +135,8 @@ private:
 
         sub_6CB945(ride);
         ride_clear_leftover_entrances(ride);
+        // Shops and entrances are removed all over the map.
+        peep_pathfind_reset_paths();
         news_item_disable_news(NEWS_ITEM_RIDE, _rideIndex);
 
         for (BannerIndex i = 0; i < MAX_BANNERS; i++)
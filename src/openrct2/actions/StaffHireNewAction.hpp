@@ -226,6 +226,7 @@ private:
             {
                 // NOTE: This state is required for the window to act.
                 newPeep->state = PEEP_STATE_PICKED;
+                sprite_hot_fields_set_state(newPeep->sprite_index, newPeep->state);
 
                 sprite_move(newPeep->x, newPeep->y, newPeep->z, (rct_sprite*)newPeep);
                 invalidate_sprite_2((rct_sprite*)newPeep);
@@ -269,6 +270,7 @@ private:
         // Find a location to place new staff member
 
         newPeep->state = PEEP_STATE_FALLING;
+        sprite_hot_fields_set_state(newPeep->sprite_index, newPeep->state);
 
         int16_t x, y, z;
         uint32_t count = 0;
@@ -328,6 +330,7 @@ private:
             {
                 // User must pick a location
                 newPeep->state = PEEP_STATE_PICKED;
+                sprite_hot_fields_set_state(newPeep->sprite_index, newPeep->state);
                 x = newPeep->x;
                 y = newPeep->y;
                 z = newPeep->z;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../ride/RideGroupManager.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -682,6 +683,7 @@ public:
                 footpath_connect_edges(mapLoc.x, mapLoc.y, tileElement, GetFlags());
             }
             map_invalidate_tile_full(mapLoc.x, mapLoc.y);
+            peep_pathfind_invalidate_paths(mapLoc);
         }
 
         money32 price = RideTrackCosts[ride->type].track_price;
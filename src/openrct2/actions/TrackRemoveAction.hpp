@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../management/Finance.h"
+#include "../peep/Peep.h"
 #include "../ride/RideGroupManager.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -447,6 +448,7 @@ public:
                 footpath_remove_edges_at(mapLoc.x, mapLoc.y, tileElement);
             }
             tile_element_remove(tileElement);
+            peep_pathfind_invalidate_paths(mapLoc);
             sub_6CB945(ride);
             if (!(GetFlags() & GAME_COMMAND_FLAG_GHOST))
             {
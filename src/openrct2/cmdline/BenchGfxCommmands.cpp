@@ -11,10 +11,12 @@
 #include "CommandLine.hpp"
 
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchGfxGiant(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::BenchGfxCommands[]{
     // Main commands
-    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx), CommandTableEnd
+    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx),
+    DefineCommand("giant", "<file> [iterations count]", nullptr, HandleBenchGfxGiant), CommandTableEnd
 };
 
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
@@ -28,3 +30,15 @@ static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleBenchGfxGiant(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_gfxbench_giant(argv, argc);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
@@ -0,0 +1,218 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../core/MemoryStream.h"
+#    include "../object/Object.h"
+#    include "../rct12/SawyerChunk.h"
+#    include "../rct12/SawyerChunkReader.h"
+#    include "../util/SawyerCoding.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstring>
+#    include <random>
+#    include <vector>
+
+// Roughly the size of the map element chunk of a large park.
+constexpr size_t BENCH_PAYLOAD_SIZE = 4 * 1024 * 1024;
+
+// Map data is mostly runs of identical bytes broken up by short literal stretches.
+static std::vector<uint8_t> create_payload(size_t length = BENCH_PAYLOAD_SIZE)
+{
+    std::mt19937 rng(0);
+    std::vector<uint8_t> data;
+    data.reserve(length);
+    while (data.size() < length)
+    {
+        auto count = std::min<size_t>(length - data.size(), rng() % 64 + 1);
+        if (rng() % 2 == 0)
+        {
+            data.insert(data.end(), count, (uint8_t)rng());
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                data.push_back((uint8_t)rng());
+            }
+        }
+    }
+    return data;
+}
+
+static std::vector<uint8_t> encode_payload(uint8_t encoding, size_t length = BENCH_PAYLOAD_SIZE)
+{
+    auto payload = create_payload(length);
+    sawyercoding_chunk_header header;
+    header.encoding = encoding;
+    header.length = (uint32_t)payload.size();
+    std::vector<uint8_t> encoded(payload.size() * 2 + sizeof(header));
+    encoded.resize(sawyercoding_write_chunk_buffer(encoded.data(), payload.data(), header));
+    return encoded;
+}
+
+// Decodes the chunk into a buffer owned by the chunk and copies it out, as ReadChunk(dst, length) used to.
+static void BM_decode_buffered(benchmark::State& state, uint8_t encoding)
+{
+    auto encoded = encode_payload(encoding);
+    std::vector<uint8_t> dst(BENCH_PAYLOAD_SIZE);
+    for (auto _ : state)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        auto chunk = SawyerChunkReader(&ms).ReadChunk();
+        std::memcpy(dst.data(), chunk->GetData(), std::min(chunk->GetLength(), dst.size()));
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_PAYLOAD_SIZE);
+}
+
+static void BM_decode_direct(benchmark::State& state, uint8_t encoding)
+{
+    auto encoded = encode_payload(encoding);
+    std::vector<uint8_t> dst(BENCH_PAYLOAD_SIZE);
+    for (auto _ : state)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        SawyerChunkReader(&ms).ReadChunk(dst.data(), dst.size());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_PAYLOAD_SIZE);
+}
+
+// The original byte at a time RLE decoder, used for SV4 and SC4 files.
+static void BM_decode_rle_reference(benchmark::State& state)
+{
+    auto encoded = encode_payload(CHUNK_ENCODING_RLE);
+    std::vector<uint8_t> src(encoded.begin() + sizeof(sawyercoding_chunk_header), encoded.end());
+    // The decoder skips the checksum at the end of the data
+    src.resize(src.size() + 4);
+    std::vector<uint8_t> dst(BENCH_PAYLOAD_SIZE);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sawyercoding_decode_sv4(src.data(), dst.data(), src.size(), dst.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_PAYLOAD_SIZE);
+}
+
+// The chunks following the header of a saved game: objects, date, tile elements and the rest of the park state.
+static const size_t ParkChunkLengths[] = { sizeof(rct_object_entry) * 721, 16, 0x30000 * 8, 3048816 };
+
+static std::vector<uint8_t> encode_park_chunks()
+{
+    std::vector<uint8_t> encoded;
+    for (auto length : ParkChunkLengths)
+    {
+        auto chunk = encode_payload(CHUNK_ENCODING_RLECOMPRESSED, length);
+        encoded.insert(encoded.end(), chunk.begin(), chunk.end());
+    }
+    return encoded;
+}
+
+static void BM_park_chunks_sequential(benchmark::State& state)
+{
+    auto encoded = encode_park_chunks();
+    std::vector<std::vector<uint8_t>> chunks;
+    for (auto length : ParkChunkLengths)
+    {
+        chunks.emplace_back(length);
+    }
+    for (auto _ : state)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        SawyerChunkReader reader(&ms);
+        for (auto& chunk : chunks)
+        {
+            reader.ReadChunk(chunk.data(), chunk.size());
+        }
+        benchmark::DoNotOptimize(chunks.data());
+    }
+}
+
+static void BM_park_chunks_parallel(benchmark::State& state)
+{
+    auto encoded = encode_park_chunks();
+    std::vector<std::vector<uint8_t>> chunks;
+    std::vector<SawyerChunkDestination> destinations;
+    for (auto length : ParkChunkLengths)
+    {
+        chunks.emplace_back(length);
+        destinations.push_back({ chunks.back().data(), length });
+    }
+    for (auto _ : state)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        SawyerChunkReader(&ms).ReadChunks(destinations);
+        benchmark::DoNotOptimize(chunks.data());
+    }
+}
+
+static int cmdline_for_bench_sawyer_coding(int argc, const char** argv)
+{
+    benchmark::RegisterBenchmark("rle/reference", BM_decode_rle_reference);
+    benchmark::RegisterBenchmark("rle/buffered", BM_decode_buffered, CHUNK_ENCODING_RLE);
+    benchmark::RegisterBenchmark("rle/direct", BM_decode_direct, CHUNK_ENCODING_RLE);
+    benchmark::RegisterBenchmark("rotate/buffered", BM_decode_buffered, CHUNK_ENCODING_ROTATE);
+    benchmark::RegisterBenchmark("rotate/direct", BM_decode_direct, CHUNK_ENCODING_ROTATE);
+    benchmark::RegisterBenchmark("park_chunks/sequential", BM_park_chunks_sequential)->UseRealTime();
+    benchmark::RegisterBenchmark("park_chunks/parallel", BM_park_chunks_parallel)->UseRealTime();
+
+    // Google benchmark reorders the pointers in argv, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back((char*)argv[i]);
+    }
+    argc = (int)argv_for_benchmark.size();
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sawyer_coding(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSawyerCoding(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSawyerCodingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchSawyerCoding),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSawyerCoding), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -0,0 +1,214 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../peep/Peep.h"
+#    include "../world/Location.hpp"
+#    include "../world/Sprite.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <random>
+#    include <vector>
+
+// Fills every sprite slot with a peep at a random position and state, linked in random order like in a long running park.
+static void fill_sprites_with_peeps()
+{
+    reset_sprite_list();
+
+    std::mt19937 rng(0);
+    std::vector<rct_sprite*> sprites;
+    rct_sprite* sprite;
+    while ((sprite = create_sprite(SPRITE_IDENTIFIER_PEEP)) != nullptr)
+    {
+        sprite->peep.sprite_identifier = SPRITE_IDENTIFIER_PEEP;
+        sprite->peep.state = (PeepState)(rng() % PEEP_STATE_INSPECTING);
+        sprite_move(rng() % (255 * 32), rng() % (255 * 32), rng() % 1024, sprite);
+        sprites.push_back(sprite);
+    }
+
+    std::shuffle(sprites.begin(), sprites.end(), rng);
+    for (auto s : sprites)
+    {
+        move_sprite_to_list(s, SPRITE_LIST_LITTER);
+    }
+    for (auto s : sprites)
+    {
+        move_sprite_to_list(s, SPRITE_LIST_PEEP);
+    }
+    sprite_hot_fields_rebuild();
+}
+
+static void BM_peep_list_walk_legacy(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        int32_t sum = 0;
+        for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP]; spriteIndex != SPRITE_INDEX_NULL;)
+        {
+            const auto& peep = get_sprite(spriteIndex)->peep;
+            sum += peep.x + peep.y + peep.z;
+            spriteIndex = peep.next;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * gSpriteListCount[SPRITE_LIST_PEEP]);
+}
+
+static void BM_peep_list_walk_hot(benchmark::State& state)
+{
+    const auto& hotFields = sprite_hot_fields();
+    for (auto _ : state)
+    {
+        int32_t sum = 0;
+        for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP]; spriteIndex != SPRITE_INDEX_NULL;)
+        {
+            sum += hotFields.X[spriteIndex] + hotFields.Y[spriteIndex] + hotFields.Z[spriteIndex];
+            spriteIndex = hotFields.Next[spriteIndex];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * gSpriteListCount[SPRITE_LIST_PEEP]);
+}
+
+static void BM_peep_queue_scan_legacy(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        int32_t queuing = 0;
+        uint16_t spriteIndex;
+        Peep* peep;
+        FOR_ALL_PEEPS (spriteIndex, peep)
+        {
+            if (peep->state == PEEP_STATE_QUEUING)
+            {
+                queuing++;
+            }
+        }
+        benchmark::DoNotOptimize(queuing);
+    }
+    state.SetItemsProcessed(state.iterations() * gSpriteListCount[SPRITE_LIST_PEEP]);
+}
+
+static void BM_peep_queue_scan_hot(benchmark::State& state)
+{
+    const auto& hotFields = sprite_hot_fields();
+    for (auto _ : state)
+    {
+        int32_t queuing = 0;
+        for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP]; spriteIndex != SPRITE_INDEX_NULL;
+             spriteIndex = hotFields.Next[spriteIndex])
+        {
+            if (hotFields.State[spriteIndex] == PEEP_STATE_QUEUING)
+            {
+                queuing++;
+            }
+        }
+        benchmark::DoNotOptimize(queuing);
+    }
+    state.SetItemsProcessed(state.iterations() * gSpriteListCount[SPRITE_LIST_PEEP]);
+}
+
+// The position copy done every frame for tweening.
+static void BM_position_store_legacy(benchmark::State& state)
+{
+    std::vector<LocationXYZ16> locations(MAX_SPRITES);
+    for (auto _ : state)
+    {
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
+        {
+            const auto& sprite = get_sprite(i)->generic;
+            locations[i] = { sprite.x, sprite.y, sprite.z };
+        }
+        benchmark::DoNotOptimize(locations.data());
+    }
+    state.SetItemsProcessed(state.iterations() * MAX_SPRITES);
+}
+
+static void BM_position_store_hot(benchmark::State& state)
+{
+    const auto& hotFields = sprite_hot_fields();
+    std::vector<LocationXYZ16> locations(MAX_SPRITES);
+    for (auto _ : state)
+    {
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
+        {
+            locations[i] = { hotFields.X[i], hotFields.Y[i], hotFields.Z[i] };
+        }
+        benchmark::DoNotOptimize(locations.data());
+    }
+    state.SetItemsProcessed(state.iterations() * MAX_SPRITES);
+}
+
+static int cmdline_for_bench_sprite_hot_fields(int argc, const char** argv)
+{
+    fill_sprites_with_peeps();
+    log_info("Filled %u sprites with peeps.", (uint32_t)gSpriteListCount[SPRITE_LIST_PEEP]);
+
+    benchmark::RegisterBenchmark("peep_list_walk/legacy", BM_peep_list_walk_legacy);
+    benchmark::RegisterBenchmark("peep_list_walk/hot", BM_peep_list_walk_hot);
+    benchmark::RegisterBenchmark("peep_queue_scan/legacy", BM_peep_queue_scan_legacy);
+    benchmark::RegisterBenchmark("peep_queue_scan/hot", BM_peep_queue_scan_hot);
+    benchmark::RegisterBenchmark("position_store/legacy", BM_position_store_legacy);
+    benchmark::RegisterBenchmark("position_store/hot", BM_position_store_hot);
+
+    // Google benchmark reorders the pointers in argv, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back((char*)argv[i]);
+    }
+    argc = (int)argv_for_benchmark.size();
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSpriteHotFields(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sprite_hot_fields(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSpriteHotFields(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSpriteHotFieldsCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchSpriteHotFields),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSpriteHotFields), CommandTableEnd
+#endif // USE_BENCHMARK
+};
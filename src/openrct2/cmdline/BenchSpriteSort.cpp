@@ -32,45 +32,65 @@
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <string>
 #    include <vector>
 
-static void fixup_pointers(paint_session* s, size_t paint_session_entries, size_t paint_struct_entries, size_t quadrant_entries)
+static void fixup_pointers(std::vector<RecordedPaintSession>& s)
 {
-    for (size_t i = 0; i < paint_session_entries; i++)
+    for (auto& recorded : s)
     {
-        for (size_t j = 0; j < paint_struct_entries; j++)
+        auto& entries = recorded.Entries;
+        auto fixup = [&entries](paint_struct*& ps) {
+            auto index = (size_t)ps;
+            ps = index >= entries.size() ? nullptr : &entries[index].basic;
+        };
+        for (auto& entry : entries)
         {
-            if (s[i].PaintStructs[j].basic.next_quadrant_ps == (paint_struct*)paint_struct_entries)
-            {
-                s[i].PaintStructs[j].basic.next_quadrant_ps = nullptr;
-            }
-            else
-            {
-                s[i].PaintStructs[j].basic.next_quadrant_ps = &s[i].PaintStructs
-                                                                   [(uintptr_t)s[i].PaintStructs[j].basic.next_quadrant_ps]
-                                                                       .basic;
-            }
+            fixup(entry.basic.next_quadrant_ps);
         }
-        for (size_t j = 0; j < quadrant_entries; j++)
+        for (auto& quadrant : recorded.Session.Quadrants)
         {
-            if (s[i].Quadrants[j] == (paint_struct*)quadrant_entries)
-            {
-                s[i].Quadrants[j] = nullptr;
-            }
-            else
-            {
-                s[i].Quadrants[j] = &s[i].PaintStructs[(size_t)s[i].Quadrants[j]].basic;
-            }
+            fixup(quadrant);
         }
     }
 }
 
-static std::vector<paint_session> extract_paint_session(const std::string parkFileName)
+static std::vector<size_t> arranged_order(const RecordedPaintSession& recorded)
+{
+    std::vector<size_t> order;
+    for (auto ps = recorded.Session.PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+    {
+        order.push_back(reinterpret_cast<const paint_entry*>(ps) - recorded.Entries.data());
+    }
+    return order;
+}
+
+// Arranges every session with both engines and checks the resulting draw order is the same.
+static bool verify_arrange_engines(const std::vector<RecordedPaintSession>& inputSessions)
+{
+    for (size_t i = 0; i < inputSessions.size(); i++)
+    {
+        std::vector<RecordedPaintSession> legacy = { inputSessions[i] };
+        std::vector<RecordedPaintSession> flat = { inputSessions[i] };
+        fixup_pointers(legacy);
+        fixup_pointers(flat);
+        paint_session_arrange(&legacy[0].Session, PaintArrangeEngine::Legacy);
+        paint_session_arrange(&flat[0].Session, PaintArrangeEngine::Flat);
+        if (arranged_order(legacy[0]) != arranged_order(flat[0]))
+        {
+            log_error("Session %u is arranged differently by the flat engine.", (uint32_t)i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<RecordedPaintSession> extract_paint_session(const std::string parkFileName)
 {
     core_init();
     gOpenRCT2Headless = true;
     auto context = OpenRCT2::CreateContext();
-    std::vector<paint_session> sessions;
+    std::vector<RecordedPaintSession> sessions;
     log_info("Starting...");
     if (context->Initialise())
     {
@@ -136,41 +156,45 @@ static std::vector<paint_session> extract_paint_session(const std::string parkFi
 }
 
 // This function is based on benchgfx_render_screenshots
-static void BM_paint_session_arrange(benchmark::State& state, const std::vector<paint_session> inputSessions)
+static void BM_paint_session_arrange(
+    benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions, PaintArrangeEngine engine)
 {
-    std::vector<paint_session> sessions = inputSessions;
+    std::vector<RecordedPaintSession> sessions = inputSessions;
     // Fixing up the pointers continuously is wasteful. Fix it up once for `sessions` and store a copy.
     // Keep in mind we need bit-exact copy, as the lists use pointers.
     // Once sorted, just restore the copy with the original fixed-up version.
-    paint_session* local_s = new paint_session[std::size(sessions)];
-    fixup_pointers(&sessions[0], std::size(sessions), std::size(local_s->PaintStructs), std::size(local_s->Quadrants));
-    std::copy_n(sessions.cbegin(), std::size(sessions), local_s);
+    fixup_pointers(sessions);
+    const std::vector<RecordedPaintSession> local_s = sessions;
     for (auto _ : state)
     {
         state.PauseTiming();
-        std::copy_n(local_s, std::size(sessions), sessions.begin());
+        for (size_t i = 0; i < sessions.size(); i++)
+        {
+            // Copy element-wise so the entries stay at the addresses the fixed-up pointers refer to.
+            std::copy(local_s[i].Entries.begin(), local_s[i].Entries.end(), sessions[i].Entries.begin());
+            sessions[i].Session = local_s[i].Session;
+        }
         state.ResumeTiming();
-        paint_session_arrange(&sessions[0]);
+        for (auto& recorded : sessions)
+        {
+            paint_session_arrange(&recorded.Session, engine);
+        }
         benchmark::DoNotOptimize(sessions);
     }
     state.SetItemsProcessed(state.iterations() * std::size(sessions));
-    delete[] local_s;
 }
 
 static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
 {
     {
         // Register some basic "baseline" benchmark
-        std::vector<paint_session> sessions(1);
-        for (auto& ps : sessions[0].PaintStructs)
-        {
-            ps.basic.next_quadrant_ps = (paint_struct*)(std::size(sessions[0].PaintStructs));
-        }
-        for (auto& quad : sessions[0].Quadrants)
+        std::vector<RecordedPaintSession> sessions(1);
+        for (auto& quad : sessions[0].Session.Quadrants)
         {
-            quad = (paint_struct*)(std::size(sessions[0].Quadrants));
+            quad = (paint_struct*)(std::size(sessions[0].Entries));
         }
-        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
+        benchmark::RegisterBenchmark("baseline/legacy", BM_paint_session_arrange, sessions, PaintArrangeEngine::Legacy);
+        benchmark::RegisterBenchmark("baseline/flat", BM_paint_session_arrange, sessions, PaintArrangeEngine::Flat);
     }
 
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
@@ -186,9 +210,22 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         if (platform_file_exists(argv[i]))
         {
             // Register benchmark for sv6 if valid
-            std::vector<paint_session> sessions = extract_paint_session(argv[i]);
+            std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
             if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+            {
+                if (!verify_arrange_engines(sessions))
+                {
+                    log_error("Arrange engines disagree on '%s'.", argv[i]);
+                    return -1;
+                }
+                log_info("Arrange engines agree on all %u sessions.", (uint32_t)sessions.size());
+
+                std::string name = argv[i];
+                benchmark::RegisterBenchmark(
+                    (name + "/legacy").c_str(), BM_paint_session_arrange, sessions, PaintArrangeEngine::Legacy);
+                benchmark::RegisterBenchmark(
+                    (name + "/flat").c_str(), BM_paint_session_arrange, sessions, PaintArrangeEngine::Flat);
+            }
         }
         else
         {
@@ -118,13 +118,19 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchSpriteHotFieldsCommands[];
+    extern const CommandLineCommand BenchSawyerCodingCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand LoadTestCommands[];
 
     extern const CommandLineExample RootExamples[];
 
+    extern const CommandLineOptionDefinition SimulateBatchOptions[];
+
     void PrintHelp(bool allCommands = false);
     exitcode_t HandleCommandDefault();
 
     exitcode_t HandleCommandConvert(CommandLineArgEnumerator* enumerator);
     exitcode_t HandleCommandUri(CommandLineArgEnumerator* enumerator);
+    exitcode_t HandleCommandSimulateBatch(CommandLineArgEnumerator* enumerator);
 } // namespace CommandLine
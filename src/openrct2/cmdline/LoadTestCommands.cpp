@@ -0,0 +1,457 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifndef DISABLE_NETWORK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../ReplayManager.h"
+#    include "../config/Config.h"
+#    include "../core/Console.hpp"
+#    include "../core/File.h"
+#    include "../core/Json.hpp"
+#    include "../core/Path.hpp"
+#    include "../network/network.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <cstdlib>
+#    include <functional>
+#    include <memory>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Bots that have not loaded the map by then give up
+constexpr std::chrono::seconds LOADTEST_JOIN_TIMEOUT(60);
+
+static uint32_t _clients = 8;
+static uint32_t _port = 0;
+static const char* _reportPath = nullptr;
+static const char* _userDataPath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition LoadTestOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_clients,    NAC, "clients", "bots in the last round, doubled from one (default 8)" },
+    { CMDLINE_TYPE_INTEGER, &_port,       NAC, "port",    "port of the server, defaults to the configured port"  },
+    { CMDLINE_TYPE_STRING,  &_reportPath, NAC, "report",  "write the JSON report to the given file"              },
+    OptionTableEnd
+};
+
+static constexpr const CommandLineOptionDefinition LoadTestBotOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_reportPath,   NAC, "report",         "write the result as JSON to the given file" },
+    { CMDLINE_TYPE_STRING, &_userDataPath, NAC, "user-data-path", "directory for the key and logs of the bot"  },
+    OptionTableEnd
+};
+
+static exitcode_t HandleLoadTest(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleLoadTestBot(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::LoadTestCommands[]
+{
+    // Main commands
+    DefineCommand("",    "<replay-file> <seconds>",               LoadTestOptions,    HandleLoadTest   ),
+    DefineCommand("bot", "<port> <replay-file> <seconds> <name>", LoadTestBotOptions, HandleLoadTestBot),
+    CommandTableEnd
+};
+// clang-format on
+
+/**
+ * Updates the game every GAME_UPDATE_TIME_MS like the game loop of a headless server, until the callback returns
+ * false. The callback gets the time the update took in milliseconds.
+ */
+static void RunGameLoop(IContext& context, const std::function<bool(double)>& afterUpdate)
+{
+    auto gameState = context.GetGameState();
+    auto nextUpdate = std::chrono::steady_clock::now();
+    bool running = true;
+    while (running)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        gCurrentDeltaTime = GAME_UPDATE_TIME_MS;
+        gameState->Update();
+        std::chrono::duration<double, std::milli> updateTime = std::chrono::steady_clock::now() - startTime;
+        running = afterUpdate(updateTime.count());
+
+        // A game that falls behind does not catch up either
+        nextUpdate += std::chrono::milliseconds(GAME_UPDATE_TIME_MS);
+        auto now = std::chrono::steady_clock::now();
+        if (nextUpdate < now)
+        {
+            nextUpdate = now;
+        }
+        else
+        {
+            std::this_thread::sleep_until(nextUpdate);
+        }
+    }
+}
+
+static exitcode_t HandleLoadTestBot(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 4)
+    {
+        Console::Error::WriteLine("Missing arguments <port> <replay-file> <seconds> <name>.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    int32_t port = atoi(argv[0]);
+    std::string replayPath = argv[1];
+    std::chrono::seconds duration(atol(argv[2]));
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Objects and settings are already loaded from the user directory, the key and logs of the bot are written elsewhere
+    if (_userDataPath != nullptr)
+    {
+        context->GetPlatformEnvironment()->SetBasePath(DIRBASE::USER, _userDataPath);
+    }
+
+    // Every bot has its own key, and keeps playing after a desync so that the rest of the round is still measured
+    gConfigNetwork.player_name = argv[3];
+    gConfigNetwork.stay_connected = true;
+
+    // The park is replaced by the server's, until then the game has to update a valid one
+    auto replayManager = context->GetReplayManager();
+    if (!replayManager->LoadReplayPark(replayPath))
+    {
+        Console::Error::WriteLine("Unable to load the park of %s.", replayPath.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    if (!network_begin_client("127.0.0.1", port))
+    {
+        Console::Error::WriteLine("Unable to connect to port %d.", port);
+        return EXITCODE_FAIL;
+    }
+
+    bool joined = false;
+    bool desynced = false;
+    bool failed = false;
+    std::chrono::duration<double> joinTime{};
+    std::chrono::steady_clock::time_point joinedTime;
+    uint32_t nextPlaybackTick = 0;
+    RunGameLoop(*context, [&](double) {
+        auto now = std::chrono::steady_clock::now();
+        if (network_get_mode() != NETWORK_MODE_CLIENT)
+        {
+            Console::Error::WriteLine("Disconnected from the server.");
+            failed = true;
+            return false;
+        }
+        if (!joined)
+        {
+            if (!network_is_map_loaded())
+            {
+                return now - startTime < LOADTEST_JOIN_TIMEOUT;
+            }
+            joined = true;
+            joinedTime = now;
+            joinTime = now - startTime;
+            nextPlaybackTick = gCurrentTicks;
+        }
+
+        desynced |= network_is_desynchronised();
+
+        // The replay is played over and over again at its own pace
+        if (!replayManager->IsPlayingActions() && gCurrentTicks >= nextPlaybackTick)
+        {
+            ReplayRecordInfo info;
+            if (!replayManager->StartActionPlayback(replayPath) || !replayManager->GetCurrentReplayInfo(info))
+            {
+                Console::Error::WriteLine("Unable to play the game actions of %s.", replayPath.c_str());
+                failed = true;
+                return false;
+            }
+            nextPlaybackTick = gCurrentTicks + std::max<uint32_t>(info.Ticks, 1);
+        }
+        return now - joinedTime < duration;
+    });
+
+    std::chrono::duration<double> connectedTime{};
+    NetworkStats_t stats = {};
+    if (joined)
+    {
+        connectedTime = std::chrono::steady_clock::now() - joinedTime;
+    }
+    if (network_get_mode() == NETWORK_MODE_CLIENT)
+    {
+        stats = network_get_stats();
+    }
+    network_close();
+
+    if (_reportPath != nullptr)
+    {
+        json_t* report = json_object();
+        json_object_set_new(report, "name", json_string(gConfigNetwork.player_name.c_str()));
+        json_object_set_new(report, "joined", json_boolean(joined));
+        json_object_set_new(report, "join_seconds", json_real(joinTime.count()));
+        json_object_set_new(report, "connected_seconds", json_real(connectedTime.count()));
+        auto bytesReceived = stats.bytesReceived[NETWORK_STATISTICS_GROUP_TOTAL];
+        auto bytesSent = stats.bytesSent[NETWORK_STATISTICS_GROUP_TOTAL];
+        json_object_set_new(report, "bytes_received", json_integer(bytesReceived));
+        json_object_set_new(report, "bytes_sent", json_integer(bytesSent));
+        json_object_set_new(report, "desynced", json_boolean(desynced));
+        Json::WriteToFile(_reportPath, report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        json_decref(report);
+    }
+
+    return joined && !failed ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static double GetPercentile(std::vector<double> values, double percentile)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    auto nth = values.begin() + (size_t)((values.size() - 1) * percentile);
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+/**
+ * Hosts the park of the replay on loopback while the given number of bot processes join it and play its game
+ * actions, and returns the report of the round.
+ */
+static json_t* RunLoadTestRound(
+    IContext& context, const std::string& replayPath, const std::string& dataPath, int32_t port, uint32_t seconds,
+    uint32_t clientCount)
+{
+    // Every round starts with the same park, bots of earlier rounds have changed it
+    if (!context.GetReplayManager()->LoadReplayPark(replayPath))
+    {
+        Console::Error::WriteLine("Unable to load the park of %s.", replayPath.c_str());
+        return nullptr;
+    }
+    if (!network_begin_server(port, "127.0.0.1"))
+    {
+        Console::Error::WriteLine("Unable to host the park on port %d.", port);
+        return nullptr;
+    }
+
+    Console::Error::WriteLine("Running %u bots for %u seconds...", clientCount, seconds);
+    std::string exePath = Platform::GetCurrentExecutablePath();
+    auto getBotReportPath = [&dataPath](size_t index) {
+        return Path::Combine(dataPath, "bot" + std::to_string(index + 1) + ".json");
+    };
+
+    // Each bot is a separate process, the game state is global so clients can not share one
+    std::vector<int32_t> exitCodes(clientCount, -1);
+    std::atomic<uint32_t> runningBots = { clientCount };
+    std::vector<std::thread> bots;
+    for (uint32_t i = 0; i < clientCount; i++)
+    {
+        bots.emplace_back([&, i]() {
+            exitCodes[i] = Platform::Execute(
+                exePath,
+                { "loadtest", "bot", std::to_string(port), replayPath, std::to_string(seconds),
+                  "LoadTestBot" + std::to_string(i + 1), "--report", getBotReportPath(i), "--user-data-path", dataPath },
+                true);
+            runningBots--;
+        });
+    }
+
+    std::vector<double> tickTimes;
+    RunGameLoop(context, [&](double updateTime) {
+        tickTimes.push_back(updateTime);
+        return runningBots > 0;
+    });
+    for (auto& bot : bots)
+    {
+        bot.join();
+    }
+    network_close();
+
+    uint32_t joinedBots = 0;
+    uint32_t desyncedBots = 0;
+    double joinTimeTotal = 0;
+    double joinTimeMax = 0;
+    double bytesReceivedPerSecond = 0;
+    double bytesSentPerSecond = 0;
+    json_t* botReports = json_array();
+    for (uint32_t i = 0; i < clientCount; i++)
+    {
+        auto botReportPath = getBotReportPath(i);
+        json_t* botReport = nullptr;
+        if (File::Exists(botReportPath))
+        {
+            try
+            {
+                botReport = Json::ReadFromFile(botReportPath.c_str());
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to read report of bot %u: %s", i + 1, e.what());
+            }
+        }
+        File::Delete(botReportPath);
+
+        if (botReport == nullptr)
+        {
+            botReport = json_object();
+        }
+        else if (json_is_true(json_object_get(botReport, "joined")))
+        {
+            double joinTime = json_number_value(json_object_get(botReport, "join_seconds"));
+            double connectedTime = json_number_value(json_object_get(botReport, "connected_seconds"));
+            joinedBots++;
+            desyncedBots += json_is_true(json_object_get(botReport, "desynced")) ? 1 : 0;
+            joinTimeTotal += joinTime;
+            joinTimeMax = std::max(joinTimeMax, joinTime);
+            if (connectedTime > 0)
+            {
+                auto bytesReceived = json_integer_value(json_object_get(botReport, "bytes_received"));
+                auto bytesSent = json_integer_value(json_object_get(botReport, "bytes_sent"));
+                bytesReceivedPerSecond += bytesReceived / connectedTime;
+                bytesSentPerSecond += bytesSent / connectedTime;
+            }
+        }
+        json_object_set_new(botReport, "exit_code", json_integer(exitCodes[i]));
+        json_array_append_new(botReports, botReport);
+    }
+
+    double tickTimeMean = 0;
+    for (auto tickTime : tickTimes)
+    {
+        tickTimeMean += tickTime / tickTimes.size();
+    }
+    double joinTimeMean = joinedBots == 0 ? 0 : joinTimeTotal / joinedBots;
+    double desyncRate = joinedBots == 0 ? 0 : (double)desyncedBots / joinedBots;
+    if (joinedBots != 0)
+    {
+        bytesReceivedPerSecond /= joinedBots;
+        bytesSentPerSecond /= joinedBots;
+    }
+
+    json_t* round = json_object();
+    json_object_set_new(round, "clients", json_integer(clientCount));
+    json_object_set_new(round, "joined_clients", json_integer(joinedBots));
+    json_object_set_new(round, "server_ticks", json_integer(tickTimes.size()));
+    json_object_set_new(round, "server_tick_ms_mean", json_real(tickTimeMean));
+    json_object_set_new(round, "server_tick_ms_p99", json_real(GetPercentile(tickTimes, 0.99)));
+    json_object_set_new(round, "server_tick_ms_max", json_real(GetPercentile(tickTimes, 1)));
+    json_object_set_new(round, "join_seconds_mean", json_real(joinTimeMean));
+    json_object_set_new(round, "join_seconds_max", json_real(joinTimeMax));
+    json_object_set_new(round, "bytes_received_per_second_per_client", json_real(bytesReceivedPerSecond));
+    json_object_set_new(round, "bytes_sent_per_second_per_client", json_real(bytesSentPerSecond));
+    json_object_set_new(round, "desync_rate", json_real(desyncRate));
+    json_object_set_new(round, "bots", botReports);
+    return round;
+}
+
+static exitcode_t HandleLoadTest(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <replay-file> <seconds>.");
+        return EXITCODE_FAIL;
+    }
+    if (_clients == 0)
+    {
+        Console::Error::WriteLine("Expected at least one client.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    std::string replayPath = argv[0];
+    uint32_t seconds = atol(argv[1]);
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Keys, users, logs and reports of the test are kept apart and deleted afterwards
+    auto env = context->GetPlatformEnvironment();
+    auto dataPath = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), "loadtest");
+    platform_directory_delete(dataPath.c_str());
+    if (!platform_ensure_directory_exists(dataPath.c_str()))
+    {
+        Console::Error::WriteLine("Unable to create %s.", dataPath.c_str());
+        return EXITCODE_FAIL;
+    }
+    env->SetBasePath(DIRBASE::USER, dataPath);
+
+    // Only the bots can join, and the server has room for all of them
+    int32_t port = _port != 0 ? _port : gConfigNetwork.default_port;
+    gConfigNetwork.advertise = false;
+    gConfigNetwork.maxplayers = std::max<int32_t>(gConfigNetwork.maxplayers, _clients + 1);
+    network_set_password("");
+
+    json_t* report = json_array();
+    bool allSucceeded = true;
+    for (uint32_t clientCount = 1;; clientCount = std::min(clientCount * 2, _clients))
+    {
+        json_t* round = RunLoadTestRound(*context, replayPath, dataPath, port, seconds, clientCount);
+        if (round == nullptr)
+        {
+            json_decref(report);
+            platform_directory_delete(dataPath.c_str());
+            return EXITCODE_FAIL;
+        }
+        allSucceeded &= json_integer_value(json_object_get(round, "joined_clients")) == clientCount;
+        json_array_append_new(report, round);
+        if (clientCount == _clients)
+        {
+            break;
+        }
+    }
+
+    if (_reportPath == nullptr)
+    {
+        char* output = json_dumps(report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        Console::WriteLine("%s", output);
+        free(output);
+    }
+    else
+    {
+        Json::WriteToFile(_reportPath, report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        Console::Error::WriteLine("Report written to %s", _reportPath);
+    }
+    json_decref(report);
+    platform_directory_delete(dataPath.c_str());
+
+    return allSucceeded ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+#endif // DISABLE_NETWORK
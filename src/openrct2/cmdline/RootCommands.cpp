@@ -10,6 +10,7 @@
 #include "../Context.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../TickProfiler.h"
 #include "../Version.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
@@ -58,6 +59,9 @@ static utf8* _openrctDataPath = nullptr;
 static utf8* _rct1DataPath = nullptr;
 static utf8* _rct2DataPath = nullptr;
 static bool _silentBreakpad = false;
+#ifndef DISABLE_TICK_PROFILER
+static utf8* _tickProfilePath = nullptr;
+#endif
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
@@ -81,6 +85,9 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
+#ifndef DISABLE_TICK_PROFILER
+    { CMDLINE_TYPE_STRING,  &_tickProfilePath,  NAC, "profile-ticks",    "write the time spent in each part of every tick as CSV"     },
+#endif
     OptionTableEnd
 };
 
@@ -130,6 +137,7 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
+    DefineCommand("simulate-batch", "<ticks> <file>...", CommandLine::SimulateBatchOptions, CommandLine::HandleCommandSimulateBatch),
 
 #if defined(_WIN32) && !defined(__MINGW32__)
     DefineCommand("register-shell", "", RegisterShellOptions, HandleCommandRegisterShell),
@@ -140,7 +148,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchspritehot",  CommandLine::BenchSpriteHotFieldsCommands),
+    DefineSubCommand("benchsawyer",     CommandLine::BenchSawyerCodingCommands),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+#ifndef DISABLE_NETWORK
+    DefineSubCommand("loadtest",        CommandLine::LoadTestCommands         ),
+#endif
     CommandTableEnd
 };
 
@@ -230,6 +243,14 @@ exitcode_t CommandLine::HandleCommandDefault()
         Memory::Free(_password);
     }
 
+#ifndef DISABLE_TICK_PROFILER
+    if (_tickProfilePath != nullptr)
+    {
+        OpenRCT2::TickProfiler::OpenOutput(_tickProfilePath);
+        Memory::Free(_tickProfilePath);
+    }
+#endif
+
     return result;
 }
 
@@ -11,22 +11,73 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../TickProfiler.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/Json.hpp"
 #include "../network/network.h"
+#include "../platform/Platform2.h"
 #include "../platform/platform.h"
 #include "../world/Sprite.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace OpenRCT2;
 
+static const char* _reportPath = nullptr;
+#ifndef DISABLE_TICK_PROFILER
+static const char* _profileTicksPath = nullptr;
+#endif
+static uint32_t _jobs = 0;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition SimulateOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_reportPath,       NAC, "report",        "write the result as JSON to the given file"             },
+#ifndef DISABLE_TICK_PROFILER
+    { CMDLINE_TYPE_STRING, &_profileTicksPath, NAC, "profile-ticks", "write the time spent in each part of every tick as CSV" },
+#endif
+    OptionTableEnd
+};
+
+const CommandLineOptionDefinition CommandLine::SimulateBatchOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_jobs,       'j', "jobs",   "number of parks simulated at once, defaults to the number of cores" },
+    { CMDLINE_TYPE_STRING,  &_reportPath, NAC, "report", "write the JSON report to the given file instead of stdout"        },
+    OptionTableEnd
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
 
-const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
-                                                          DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
+const CommandLineCommand CommandLine::SimulateCommands[]
+{
+    // Main commands
+    DefineCommand("", "<sv6-file> <ticks>", SimulateOptions, HandleSimulate),
+    CommandTableEnd
 };
+// clang-format on
+
+static void WriteSimulateReport(
+    const char* path, const char* parkPath, uint32_t ticks, const rct_sprite_checksum& checksum, double seconds)
+{
+    json_t* report = json_object();
+    json_object_set_new(report, "park", json_string(parkPath));
+    json_object_set_new(report, "ticks", json_integer(ticks));
+    json_object_set_new(report, "sprite_checksum", json_string(checksum.ToString().c_str()));
+    json_object_set_new(report, "seconds", json_real(seconds));
+    json_object_set_new(report, "ticks_per_second", json_real(seconds > 0 ? ticks / seconds : 0));
+    json_object_set_new(report, "peak_memory", json_integer(Platform::GetPeakMemoryUsage()));
+    Json::WriteToFile(path, report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+    json_decref(report);
+}
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
@@ -58,12 +109,30 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
             return EXITCODE_FAIL;
         }
 
+#ifndef DISABLE_TICK_PROFILER
+        if (_profileTicksPath != nullptr && !TickProfiler::OpenOutput(_profileTicksPath))
+        {
+            return EXITCODE_FAIL;
+        }
+#endif
+
         Console::WriteLine("Running %d ticks...", ticks);
+        auto startTime = std::chrono::high_resolution_clock::now();
         for (uint32_t i = 0; i < ticks; i++)
         {
             context->GetGameState()->UpdateLogic();
         }
-        Console::WriteLine("Completed: %s", sprite_checksum().ToString().c_str());
+        std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+#ifndef DISABLE_TICK_PROFILER
+        TickProfiler::CloseOutput();
+#endif
+
+        auto checksum = sprite_checksum();
+        Console::WriteLine("Completed: %s", checksum.ToString().c_str());
+        if (_reportPath != nullptr)
+        {
+            WriteSimulateReport(_reportPath, inputPath, ticks, checksum, duration.count());
+        }
     }
     else
     {
@@ -73,3 +142,108 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+/**
+ * Simulates every park in a separate process, the game state is global so parks can not share one.
+ */
+exitcode_t CommandLine::HandleCommandSimulateBatch(CommandLineArgEnumerator* argEnumerator)
+{
+    int32_t ticks;
+    if (!argEnumerator->TryPopInteger(&ticks) || ticks < 0)
+    {
+        Console::Error::WriteLine("Expected the number of ticks to simulate.");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<std::string> parkPaths;
+    const char* parkPath;
+    while (argEnumerator->TryPopString(&parkPath) && parkPath[0] != '-')
+    {
+        parkPaths.push_back(parkPath);
+    }
+    if (parkPaths.empty())
+    {
+        Console::Error::WriteLine("Expected at least one park to simulate.");
+        return EXITCODE_FAIL;
+    }
+
+    std::string reportPath = _reportPath != nullptr ? _reportPath : "";
+    std::string exePath = Platform::GetCurrentExecutablePath();
+    size_t jobCount = _jobs != 0 ? _jobs : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    jobCount = std::min(jobCount, parkPaths.size());
+
+    // Each park writes its own report next to the batch report, they are merged once all processes are done.
+    auto getParkReportPath = [&reportPath](size_t index) {
+        auto basePath = reportPath.empty() ? std::string("simulate-batch") : reportPath;
+        return basePath + "." + std::to_string(index) + ".tmp";
+    };
+
+    std::vector<int32_t> exitCodes(parkPaths.size(), -1);
+    std::atomic<size_t> nextPark = { 0 };
+    auto worker = [&]() {
+        size_t index;
+        while ((index = nextPark.fetch_add(1)) < parkPaths.size())
+        {
+            // Progress goes to stderr, so that stdout only has the report when there is no report file
+            Console::Error::WriteLine("Simulating %s...", parkPaths[index].c_str());
+            exitCodes[index] = Platform::Execute(
+                exePath, { "simulate", parkPaths[index], std::to_string(ticks), "--report", getParkReportPath(index) },
+                true);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < jobCount; i++)
+    {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    bool allSucceeded = true;
+    json_t* report = json_array();
+    for (size_t i = 0; i < parkPaths.size(); i++)
+    {
+        auto parkReportPath = getParkReportPath(i);
+        json_t* parkReport = nullptr;
+        if (exitCodes[i] == EXITCODE_OK && File::Exists(parkReportPath))
+        {
+            try
+            {
+                parkReport = Json::ReadFromFile(parkReportPath.c_str());
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to read report of %s: %s", parkPaths[i].c_str(), e.what());
+            }
+        }
+        File::Delete(parkReportPath);
+
+        if (parkReport == nullptr)
+        {
+            allSucceeded = false;
+            parkReport = json_object();
+            json_object_set_new(parkReport, "park", json_string(parkPaths[i].c_str()));
+            json_object_set_new(parkReport, "ticks", json_integer(ticks));
+        }
+        json_object_set_new(parkReport, "exit_code", json_integer(exitCodes[i]));
+        json_array_append_new(report, parkReport);
+    }
+
+    if (reportPath.empty())
+    {
+        char* output = json_dumps(report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        Console::WriteLine("%s", output);
+        free(output);
+    }
+    else
+    {
+        Json::WriteToFile(reportPath.c_str(), report, JSON_INDENT(4) | JSON_PRESERVE_ORDER);
+        Console::Error::WriteLine("Report written to %s", reportPath.c_str());
+    }
+    json_decref(report);
+
+    return allSucceeded ? EXITCODE_OK : EXITCODE_FAIL;
+}
@@ -34,6 +34,7 @@ struct GeneralConfiguration
     bool show_fps;
     bool multithreading;
     bool minimize_fullscreen_focus_loss;
+    int32_t object_image_budget; // MiB of object image data to keep in memory, 0 for no limit
 
     // Map rendering
     bool landscape_smoothing;
@@ -147,6 +147,28 @@ namespace File
 #endif
         return lastModified;
     }
+
+    uint64_t GetSize(const std::string& path)
+    {
+        uint64_t size = 0;
+#ifdef _WIN32
+        auto pathW = String::ToWideChar(path.c_str());
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (GetFileAttributesExW(pathW.c_str(), GetFileExInfoStandard, &attributes))
+        {
+            size = ((uint64_t)attributes.nFileSizeHigh << 32ULL) | (uint64_t)attributes.nFileSizeLow;
+        }
+#else
+        struct stat statInfo
+        {
+        };
+        if (stat(path.c_str(), &statInfo) == 0)
+        {
+            size = statInfo.st_size;
+        }
+#endif
+        return size;
+    }
 } // namespace File
 
 bool writeentirefile(const utf8* path, const void* buffer, size_t length)
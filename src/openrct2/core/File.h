@@ -26,4 +26,5 @@ namespace File
     void WriteAllBytes(const std::string& path, const void* buffer, size_t length);
     std::vector<std::string> ReadAllLines(const std::string& path);
     uint64_t GetLastModified(const std::string& path);
+    uint64_t GetSize(const std::string& path);
 } // namespace File
@@ -14,10 +14,12 @@
 #include "File.h"
 #include "FileScanner.h"
 #include "FileStream.hpp"
-#include "JobPool.hpp"
 #include "Path.hpp"
+#include "TaskScheduler.h"
 
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <list>
 #include <string>
 #include <tuple>
@@ -205,7 +207,7 @@ private:
         const size_t totalCount = scanResult.Files.size();
         if (totalCount > 0)
         {
-            JobPool jobPool;
+            OpenRCT2::TaskGroup jobs;
             std::mutex printLock; // For verbose prints.
 
             std::list<std::vector<TItem>> containers;
@@ -228,14 +230,15 @@ private:
 
                 auto& items = containers.emplace_back();
 
-                jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                const size_t rangeEnd = rangeStart + stepSize;
+                jobs.Run([this, language, &scanResult, rangeStart, rangeEnd, &items, &processed, &printLock]() {
+                    BuildRange(language, scanResult, rangeStart, rangeEnd, items, processed, printLock);
+                });
 
                 reportProgress();
             }
 
-            jobPool.Join(reportProgress);
+            jobs.Wait(reportProgress);
 
             for (auto&& itr : containers)
             {
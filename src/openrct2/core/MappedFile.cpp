@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MappedFile.h"
+#include "String.hpp"
+
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+    // Allow the file to be replaced while it is mapped
+    auto pathW = String::ToWideChar(path);
+    auto hFile = CreateFileW(
+        pathW.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        throw IOException("Unable to open '" + path + "'");
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize))
+    {
+        CloseHandle(hFile);
+        throw IOException("Unable to get size of '" + path + "'");
+    }
+    _fileHandle = hFile;
+    _length = (size_t)fileSize.QuadPart;
+    if (_length == 0)
+    {
+        return;
+    }
+
+    _mappingHandle = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mappingHandle != nullptr)
+    {
+        _data = MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (_data == nullptr)
+    {
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+        }
+        CloseHandle(hFile);
+        throw IOException("Unable to map '" + path + "'");
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException("Unable to open '" + path + "'");
+    }
+
+    struct stat statInfo
+    {
+    };
+    if (fstat(fd, &statInfo) != 0)
+    {
+        close(fd);
+        throw IOException("Unable to get size of '" + path + "'");
+    }
+    _length = (size_t)statInfo.st_size;
+    if (_length != 0)
+    {
+        // The mapping stays valid after the descriptor is closed, and after the file is replaced
+        auto data = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw IOException("Unable to map '" + path + "'");
+        }
+        _data = data;
+    }
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle != nullptr)
+    {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle != nullptr)
+    {
+        CloseHandle(_fileHandle);
+    }
+#else
+    if (_data != nullptr)
+    {
+        munmap(_data, _length);
+    }
+#endif
+}
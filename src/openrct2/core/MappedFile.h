@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+/**
+ * A read only view of a whole file mapped into memory. Pages are only read from disk when they are accessed.
+ */
+class MappedFile final
+{
+private:
+    void* _data = nullptr;
+    size_t _length = 0;
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    const void* GetData() const
+    {
+        return _data;
+    }
+    size_t GetLength() const
+    {
+        return _length;
+    }
+};
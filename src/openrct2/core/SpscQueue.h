@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace OpenRCT2
+{
+    /**
+     * Unbounded lock-free queue for exactly one producer thread and one consumer thread. Push may only be
+     * called from the producer, TryPop and IsEmpty only from the consumer.
+     */
+    template<typename T> class SpscQueue
+    {
+    private:
+        struct Node
+        {
+            std::atomic<Node*> Next = { nullptr };
+            std::optional<T> Value;
+        };
+
+        // The head is always a node whose value has already been consumed
+        alignas(64) Node* _head = nullptr;
+        alignas(64) Node* _tail = nullptr;
+
+    public:
+        SpscQueue()
+        {
+            _head = _tail = new Node();
+        }
+
+        ~SpscQueue()
+        {
+            while (_head != nullptr)
+            {
+                auto next = _head->Next.load(std::memory_order_relaxed);
+                delete _head;
+                _head = next;
+            }
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        void Push(T value)
+        {
+            auto node = new Node();
+            node->Value.emplace(std::move(value));
+            _tail->Next.store(node, std::memory_order_release);
+            _tail = node;
+        }
+
+        bool TryPop(T& value)
+        {
+            auto next = _head->Next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return false;
+            }
+            value = std::move(*next->Value);
+            next->Value.reset();
+            delete _head;
+            _head = next;
+            return true;
+        }
+
+        bool IsEmpty() const
+        {
+            return _head->Next.load(std::memory_order_acquire) == nullptr;
+        }
+    };
+} // namespace OpenRCT2
@@ -0,0 +1,316 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TaskScheduler.h"
+
+#include "Guard.hpp"
+
+using namespace OpenRCT2;
+
+// Amount of failed attempts to find work before a worker goes to sleep.
+constexpr size_t WORKER_SPIN_COUNT = 64;
+
+namespace
+{
+    struct ThreadContext
+    {
+        TaskScheduler* Scheduler = nullptr;
+        size_t Slot = TaskScheduler::InvalidSlot;
+    };
+} // namespace
+
+static thread_local ThreadContext _threadContext;
+
+#pragma region TaskDeque
+
+bool TaskDeque::Push(Task* task)
+{
+    auto bottom = _bottom.load(std::memory_order_relaxed);
+    auto top = _top.load(std::memory_order_acquire);
+    if (bottom - top >= (int64_t)Capacity)
+    {
+        return false;
+    }
+    _buffer[bottom & Mask].store(task, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+Task* TaskDeque::Pop()
+{
+    auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+    if (top > bottom)
+    {
+        // Empty.
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Task* task = _buffer[bottom & Mask].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // Last element, race against thieves for it.
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            task = nullptr;
+        }
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+Task* TaskDeque::Steal()
+{
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = _bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    Task* task = _buffer[top & Mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        // Lost the race against the owner or another thief.
+        return nullptr;
+    }
+    return task;
+}
+
+bool TaskDeque::IsEmpty() const
+{
+    return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+#pragma region TaskScheduler
+
+TaskScheduler::TaskScheduler(size_t workerCount)
+    : _workerCount(workerCount)
+{
+    for (size_t i = 0; i < _workerCount + MaxExternalThreads; i++)
+    {
+        _slots.push_back(std::make_unique<Slot>());
+    }
+    for (size_t i = 0; i < _workerCount; i++)
+    {
+        _slots[i]->Claimed = true;
+        _threads.emplace_back(&TaskScheduler::WorkerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _shouldStop = true;
+    }
+    _sleepCond.notify_all();
+
+    for (auto& th : _threads)
+    {
+        th.join();
+    }
+}
+
+TaskScheduler& TaskScheduler::Get()
+{
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+size_t TaskScheduler::GetDefaultWorkerCount()
+{
+    // The thread that waits on a group executes work as well.
+    size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    return hardwareThreads - 1;
+}
+
+void TaskScheduler::WorkerLoop(size_t slotIndex)
+{
+    _threadContext.Scheduler = this;
+    _threadContext.Slot = slotIndex;
+
+    size_t idleCount = 0;
+    while (!_shouldStop.load(std::memory_order_relaxed))
+    {
+        if (TryExecuteOne(slotIndex))
+        {
+            idleCount = 0;
+            continue;
+        }
+
+        if (++idleCount < WORKER_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do, park until new tasks are submitted.
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleeping.fetch_add(1, std::memory_order_seq_cst);
+        _sleepCond.wait(lock, [this]() { return _shouldStop || _queued.load(std::memory_order_seq_cst) != 0; });
+        _sleeping.fetch_sub(1, std::memory_order_relaxed);
+        idleCount = 0;
+    }
+}
+
+size_t TaskScheduler::AcquireSlot()
+{
+    for (size_t i = _workerCount; i < _slots.size(); i++)
+    {
+        bool expected = false;
+        if (_slots[i]->Claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return i;
+        }
+    }
+    return InvalidSlot;
+}
+
+void TaskScheduler::ReleaseSlot(size_t slotIndex)
+{
+    Guard::Assert(_slots[slotIndex]->Deque.IsEmpty(), "Released a task slot with work still queued");
+    _slots[slotIndex]->Claimed.store(false, std::memory_order_release);
+}
+
+Task* TaskScheduler::AllocateTask(size_t slotIndex)
+{
+    // Only the owning thread allocates from a slot, tasks are freed by whichever thread executed them.
+    auto& slot = *_slots[slotIndex];
+    for (size_t i = 0; i < slot.Tasks.size(); i++)
+    {
+        auto& task = slot.Tasks[slot.NextTask];
+        slot.NextTask = (slot.NextTask + 1) % slot.Tasks.size();
+        if (!task.InUse.load(std::memory_order_acquire))
+        {
+            task.InUse.store(true, std::memory_order_relaxed);
+            return &task;
+        }
+    }
+    return nullptr;
+}
+
+bool TaskScheduler::Submit(size_t slotIndex, Task* task)
+{
+    if (_workerCount == 0 || !_slots[slotIndex]->Deque.Push(task))
+    {
+        return false;
+    }
+
+    _queued.fetch_add(1, std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_seq_cst) != 0)
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _sleepCond.notify_one();
+    }
+    return true;
+}
+
+Task* TaskScheduler::FindWork(size_t slotIndex)
+{
+    Task* task = _slots[slotIndex]->Deque.Pop();
+    for (size_t i = 1; task == nullptr && i < _slots.size(); i++)
+    {
+        auto& victim = *_slots[(slotIndex + i) % _slots.size()];
+        if (!victim.Deque.IsEmpty())
+        {
+            task = victim.Deque.Steal();
+        }
+    }
+    if (task != nullptr)
+    {
+        _queued.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+void TaskScheduler::Execute(Task* task)
+{
+    auto group = task->Group;
+    task->Invoke(*task);
+    task->Invoke = nullptr;
+    task->Group = nullptr;
+    task->InUse.store(false, std::memory_order_release);
+
+    // The group may be destroyed as soon as the counter reaches zero, do not touch it afterwards.
+    group->_pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool TaskScheduler::TryExecuteOne(size_t slotIndex)
+{
+    Task* task = FindWork(slotIndex);
+    if (task == nullptr)
+    {
+        return false;
+    }
+    Execute(task);
+    return true;
+}
+
+#pragma endregion
+
+#pragma region TaskGroup
+
+TaskGroup::TaskGroup(TaskScheduler& scheduler)
+    : _scheduler(scheduler)
+{
+    if (_threadContext.Scheduler == &_scheduler)
+    {
+        // Worker thread or a nested group, share the slot of this thread.
+        _slot = _threadContext.Slot;
+    }
+    else if (_threadContext.Scheduler == nullptr && _scheduler.GetWorkerCount() != 0)
+    {
+        _slot = _scheduler.AcquireSlot();
+        if (_slot != TaskScheduler::InvalidSlot)
+        {
+            _ownsSlot = true;
+            _threadContext.Scheduler = &_scheduler;
+            _threadContext.Slot = _slot;
+        }
+    }
+}
+
+TaskGroup::~TaskGroup()
+{
+    Wait();
+    if (_ownsSlot)
+    {
+        _threadContext = {};
+        _scheduler.ReleaseSlot(_slot);
+    }
+}
+
+void TaskGroup::Wait()
+{
+    while (_pending.load(std::memory_order_acquire) != 0)
+    {
+        if (!TryHelp())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool TaskGroup::TryHelp()
+{
+    if (_slot == TaskScheduler::InvalidSlot)
+    {
+        return false;
+    }
+    return _scheduler.TryExecuteOne(_slot);
+}
+
+#pragma endregion
@@ -0,0 +1,256 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OpenRCT2
+{
+    class TaskGroup;
+
+    /**
+     * A unit of work with inline storage for its callable, tasks never touch the heap.
+     * The size is chosen so that a lambda capturing a handful of references or values fits.
+     */
+    struct alignas(64) Task
+    {
+        static constexpr size_t StorageSize = 96;
+
+        void (*Invoke)(Task& task) = nullptr;
+        TaskGroup* Group = nullptr;
+        std::atomic_bool InUse = { false };
+        alignas(std::max_align_t) uint8_t Storage[StorageSize];
+    };
+
+    /**
+     * Fixed capacity Chase-Lev work-stealing deque. The owning thread pushes and pops from
+     * the bottom, any other thread can steal from the top.
+     */
+    class TaskDeque
+    {
+    public:
+        static constexpr size_t Capacity = 512;
+
+    private:
+        static constexpr size_t Mask = Capacity - 1;
+        static_assert((Capacity & Mask) == 0, "Capacity must be a power of two");
+
+        alignas(64) std::atomic<int64_t> _top = { 0 };
+        alignas(64) std::atomic<int64_t> _bottom = { 0 };
+        std::array<std::atomic<Task*>, Capacity> _buffer{};
+
+    public:
+        bool Push(Task* task);
+        Task* Pop();
+        Task* Steal();
+        bool IsEmpty() const;
+    };
+
+    /**
+     * Process wide pool of worker threads that execute tasks from per-thread deques. Idle workers
+     * steal from the others. Threads that are not workers (e.g. the main thread) borrow one of the
+     * external slots while they have a TaskGroup alive and help execute tasks while waiting on it.
+     */
+    class TaskScheduler
+    {
+        friend class TaskGroup;
+
+    public:
+        static constexpr size_t InvalidSlot = SIZE_MAX;
+        static constexpr size_t MaxExternalThreads = 8;
+
+    private:
+        struct Slot
+        {
+            TaskDeque Deque;
+            std::array<Task, TaskDeque::Capacity> Tasks;
+            size_t NextTask = 0;
+            std::atomic_bool Claimed = { false };
+        };
+
+        std::vector<std::thread> _threads;
+        std::vector<std::unique_ptr<Slot>> _slots;
+        size_t _workerCount = 0;
+
+        std::atomic_bool _shouldStop = { false };
+        std::atomic<size_t> _queued = { 0 };
+        std::atomic<size_t> _sleeping = { 0 };
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCond;
+
+    public:
+        /**
+         * Creates a scheduler with the given amount of worker threads, by default one less than
+         * the hardware concurrency as the waiting thread will also execute work.
+         */
+        explicit TaskScheduler(size_t workerCount = GetDefaultWorkerCount());
+        ~TaskScheduler();
+
+        TaskScheduler(const TaskScheduler&) = delete;
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+        /**
+         * Returns the persistent scheduler shared by the whole process, created on first use.
+         */
+        static TaskScheduler& Get();
+        static size_t GetDefaultWorkerCount();
+
+        size_t GetWorkerCount() const
+        {
+            return _workerCount;
+        }
+
+    private:
+        void WorkerLoop(size_t slotIndex);
+
+        size_t AcquireSlot();
+        void ReleaseSlot(size_t slotIndex);
+
+        Task* AllocateTask(size_t slotIndex);
+        bool Submit(size_t slotIndex, Task* task);
+        Task* FindWork(size_t slotIndex);
+        void Execute(Task* task);
+        bool TryExecuteOne(size_t slotIndex);
+    };
+
+    /**
+     * Fork/join scope. Tasks started with Run may execute on any worker; Wait blocks until all of them
+     * have completed while executing pending tasks on the calling thread. The destructor waits as well.
+     */
+    class TaskGroup
+    {
+        friend class TaskScheduler;
+
+    private:
+        TaskScheduler& _scheduler;
+        std::atomic<size_t> _pending = { 0 };
+        size_t _slot = TaskScheduler::InvalidSlot;
+        bool _ownsSlot = false;
+
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler = TaskScheduler::Get());
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template<typename TFn> void Run(TFn&& fn)
+        {
+            using TCallable = std::decay_t<TFn>;
+            static_assert(sizeof(TCallable) <= Task::StorageSize, "Task callable is too large, capture by reference");
+            static_assert(alignof(TCallable) <= alignof(std::max_align_t), "Task callable is over-aligned");
+
+            Task* task = nullptr;
+            if (_slot != TaskScheduler::InvalidSlot)
+            {
+                task = _scheduler.AllocateTask(_slot);
+            }
+            if (task == nullptr)
+            {
+                // No worker can pick it up or every task slot is in flight, run it in place.
+                fn();
+                return;
+            }
+
+            new (task->Storage) TCallable(std::forward<TFn>(fn));
+            task->Invoke = [](Task& t) {
+                auto callable = reinterpret_cast<TCallable*>(t.Storage);
+                (*callable)();
+                callable->~TCallable();
+            };
+            task->Group = this;
+            _pending.fetch_add(1, std::memory_order_relaxed);
+            if (!_scheduler.Submit(_slot, task))
+            {
+                _scheduler.Execute(task);
+            }
+        }
+
+        /**
+         * Waits for all tasks, reportFn is invoked on the calling thread each time progress was made.
+         */
+        template<typename TReportFn> void Wait(TReportFn&& reportFn)
+        {
+            size_t lastPending = _pending.load(std::memory_order_acquire);
+            while (lastPending != 0)
+            {
+                if (!TryHelp())
+                {
+                    std::this_thread::yield();
+                }
+                size_t pending = _pending.load(std::memory_order_acquire);
+                if (pending != lastPending)
+                {
+                    reportFn();
+                    lastPending = pending;
+                }
+            }
+        }
+
+        void Wait();
+
+        size_t CountPending() const
+        {
+            return _pending.load(std::memory_order_relaxed);
+        }
+
+    private:
+        bool TryHelp();
+    };
+
+    /**
+     * Invokes fn(begin, end) over sub-ranges of [first, last) of at most grainSize elements in parallel.
+     */
+    template<typename TFn> void ParallelForRange(size_t first, size_t last, size_t grainSize, TFn&& fn)
+    {
+        if (first >= last)
+            return;
+
+        grainSize = std::max<size_t>(grainSize, 1);
+        if (last - first <= grainSize)
+        {
+            fn(first, last);
+            return;
+        }
+
+        TaskGroup group;
+        for (size_t rangeStart = first; rangeStart < last; rangeStart += grainSize)
+        {
+            size_t rangeEnd = std::min(last, rangeStart + grainSize);
+            group.Run([&fn, rangeStart, rangeEnd]() { fn(rangeStart, rangeEnd); });
+        }
+        group.Wait();
+    }
+
+    /**
+     * Invokes fn(i) for every i in [first, last) in parallel.
+     */
+    template<typename TFn> void ParallelFor(size_t first, size_t last, size_t grainSize, TFn&& fn)
+    {
+        ParallelForRange(first, last, grainSize, [&fn](size_t rangeStart, size_t rangeEnd) {
+            for (size_t i = rangeStart; i < rangeEnd; i++)
+            {
+                fn(i);
+            }
+        });
+    }
+} // namespace OpenRCT2
@@ -193,7 +193,7 @@ void mask_scalar(
     }
 }
 
-static std::string gfx_get_csg_header_path()
+std::string gfx_get_csg_header_path()
 {
     auto path = Path::ResolveCasing(Path::Combine(gConfigGeneral.rct1_path, "Data", "csg1i.dat"));
     if (path.empty())
@@ -203,7 +203,7 @@ static std::string gfx_get_csg_header_path()
     return path;
 }
 
-static std::string gfx_get_csg_data_path()
+std::string gfx_get_csg_data_path()
 {
     // csg1.1 and csg1.dat are the same file.
     // In the CD version, it's called csg1.1 on the CD and csg1.dat on the disk.
@@ -860,6 +860,7 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
+            gfx_object_page_in_image((uint32_t)offset);
             return &_imageListElements[idx];
         }
     }
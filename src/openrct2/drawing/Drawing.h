@@ -13,6 +13,10 @@
 #include "../common.h"
 #include "../interface/Colour.h"
 
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace OpenRCT2
 {
     interface IPlatformEnvironment;
@@ -427,9 +431,9 @@ extern uint8_t gGamePalette[256 * 4];
 extern uint32_t gPaletteEffectFrame;
 extern const FILTER_PALETTE_ID GlassPaletteIds[COLOUR_COUNT];
 extern const uint16_t palette_to_g1_offset[];
-extern uint8_t gPeepPalette[256];
-extern uint8_t gOtherPalette[256];
-extern uint8_t text_palette[];
+extern thread_local uint8_t gPeepPalette[256];
+extern thread_local uint8_t gOtherPalette[256];
+extern thread_local uint8_t text_palette[];
 extern const translucent_window_palette TranslucentWindowPalettes[COLOUR_COUNT];
 
 extern thread_local int32_t gLastDrawStringX;
@@ -483,9 +487,19 @@ const rct_g1_element* gfx_get_g1_element(ImageId imageId);
 const rct_g1_element* gfx_get_g1_element(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
 bool is_csg_loaded();
+std::string gfx_get_csg_header_path();
+std::string gfx_get_csg_data_path();
+// Returns the image data that the offsets of deferred images are relative to
+using ImageDataLoader = std::function<std::vector<uint8_t>()>;
+
 uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
+uint32_t gfx_object_allocate_images_deferred(
+    const rct_g1_element* images, uint32_t count, const ImageDataLoader& dataLoader);
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
 void gfx_object_check_all_images_freed();
+void gfx_object_page_in_image(uint32_t imageId);
+void gfx_object_evict_images(size_t budget);
+size_t gfx_object_get_resident_image_bytes();
 size_t ImageListGetUsedCount();
 size_t ImageListGetMaximum();
 void FASTCALL gfx_bmp_sprite_to_buffer(
@@ -14,7 +14,11 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 constexpr uint32_t BASE_IMAGE_ID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
@@ -26,10 +30,31 @@ struct ImageList
     uint32_t Count;
 };
 
+/**
+ * An allocated image list whose data is loaded on first use and can be evicted again when it has not been drawn recently.
+ */
+struct DeferredImageList
+{
+    uint32_t BaseId;
+    uint32_t Count;
+    ImageDataLoader DataLoader;
+    std::vector<rct_g1_element> Elements; // offsets are relative to the loaded data
+    std::vector<uint8_t> Data;
+    std::atomic<bool> Resident{ false };
+    std::atomic<uint32_t> LastUsedFrame{ 0 };
+    std::mutex LoadMutex; // held while the data is loaded, so that other lists can be paged in meanwhile
+};
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+static std::unordered_map<uint32_t, std::unique_ptr<DeferredImageList>> _deferredLists;
+static std::vector<DeferredImageList*> _deferredListOwners; // indexed by image id - BASE_IMAGE_ID
+static std::mutex _deferredListsMutex;
+static size_t _residentImageBytes;
+static uint32_t _imageFrame;
+
 #ifdef DEBUG
 static std::list<ImageList> _allocatedLists;
 
@@ -212,10 +237,171 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
     return baseImageId;
 }
 
+uint32_t gfx_object_allocate_images_deferred(
+    const rct_g1_element* images, uint32_t count, const ImageDataLoader& dataLoader)
+{
+    if (count == 0 || gOpenRCT2NoGraphics)
+    {
+        return INVALID_IMAGE_ID;
+    }
+
+    uint32_t baseImageId = AllocateImageList(count);
+    if (baseImageId == INVALID_IMAGE_ID)
+    {
+        log_error("Reached maximum image limit.");
+        return INVALID_IMAGE_ID;
+    }
+
+    auto list = std::make_unique<DeferredImageList>();
+    list->BaseId = baseImageId;
+    list->Count = count;
+    list->DataLoader = dataLoader;
+    list->Elements.assign(images, images + count);
+    list->LastUsedFrame = _imageFrame;
+
+    // The elements have no data until they are first requested
+    uint32_t imageId = baseImageId;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        rct_g1_element g1 = images[i];
+        g1.offset = nullptr;
+        gfx_set_g1_element(imageId, &g1);
+        drawing_engine_invalidate_image(imageId);
+        imageId++;
+    }
+
+    size_t endIndex = (size_t)baseImageId - BASE_IMAGE_ID + count;
+    if (_deferredListOwners.size() < endIndex)
+    {
+        _deferredListOwners.resize(endIndex);
+    }
+    std::fill_n(_deferredListOwners.begin() + (baseImageId - BASE_IMAGE_ID), count, list.get());
+    _deferredLists[baseImageId] = std::move(list);
+
+    return baseImageId;
+}
+
+static void SetDeferredImageListData(DeferredImageList& list)
+{
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        rct_g1_element g1 = list.Elements[i];
+        if (list.Data.empty())
+        {
+            g1.offset = nullptr;
+        }
+        else
+        {
+            auto dataOffset = std::min<uintptr_t>((uintptr_t)g1.offset, list.Data.size() - 1);
+            g1.offset = list.Data.data() + dataOffset;
+        }
+        gfx_set_g1_element(list.BaseId + i, &g1);
+    }
+}
+
+static void PageInImageList(DeferredImageList& list)
+{
+    // Reading the data can take a while, only storing it needs the lock shared by all lists
+    std::lock_guard<std::mutex> loadLock(list.LoadMutex);
+    if (list.Resident)
+    {
+        return;
+    }
+
+    auto data = list.DataLoader();
+
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+    list.Data = std::move(data);
+    _residentImageBytes += list.Data.size();
+    SetDeferredImageListData(list);
+    list.Resident.store(true, std::memory_order_release);
+}
+
+static void EvictImageList(DeferredImageList& list)
+{
+    // The drawing engines keep their own copies of the images, the data is identical when it is paged in again so there is
+    // no need to invalidate them.
+    list.Resident.store(false, std::memory_order_release);
+    _residentImageBytes -= list.Data.size();
+    list.Data = {};
+    SetDeferredImageListData(list);
+}
+
+void gfx_object_page_in_image(uint32_t imageId)
+{
+    size_t index = (size_t)imageId - BASE_IMAGE_ID;
+    if (imageId < BASE_IMAGE_ID || index >= _deferredListOwners.size())
+    {
+        return;
+    }
+
+    auto list = _deferredListOwners[index];
+    if (list != nullptr)
+    {
+        list->LastUsedFrame.store(_imageFrame, std::memory_order_relaxed);
+        if (!list->Resident.load(std::memory_order_acquire))
+        {
+            PageInImageList(*list);
+        }
+    }
+}
+
+/**
+ * Called once per frame before drawing. Frees the data of the least recently drawn image lists until the resident data
+ * fits within the budget, never touching lists that were drawn in the last frame. A budget of 0 means no limit.
+ */
+void gfx_object_evict_images(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+    _imageFrame++;
+    if (budget == 0 || _residentImageBytes <= budget)
+    {
+        return;
+    }
+
+    std::vector<DeferredImageList*> candidates;
+    for (auto& entry : _deferredLists)
+    {
+        auto list = entry.second.get();
+        if (list->Resident && list->LastUsedFrame + 1 < _imageFrame)
+        {
+            candidates.push_back(list);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const DeferredImageList* a, const DeferredImageList* b) {
+        if (a->LastUsedFrame != b->LastUsedFrame)
+            return a->LastUsedFrame < b->LastUsedFrame;
+        return a->BaseId < b->BaseId;
+    });
+    for (auto list : candidates)
+    {
+        if (_residentImageBytes <= budget)
+        {
+            break;
+        }
+        EvictImageList(*list);
+    }
+}
+
+size_t gfx_object_get_resident_image_bytes()
+{
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+    return _residentImageBytes;
+}
+
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != INVALID_IMAGE_ID)
     {
+        auto deferredList = _deferredLists.find(baseImageId);
+        if (deferredList != _deferredLists.end())
+        {
+            std::lock_guard<std::mutex> lock(_deferredListsMutex);
+            _residentImageBytes -= deferredList->second->Data.size();
+            std::fill_n(_deferredListOwners.begin() + (baseImageId - BASE_IMAGE_ID), count, nullptr);
+            _deferredLists.erase(deferredList);
+        }
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
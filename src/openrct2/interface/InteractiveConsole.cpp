@@ -14,6 +14,7 @@
 #include "../Game.h"
 #include "../OpenRCT2.h"
 #include "../ReplayManager.h"
+#include "../TickProfiler.h"
 #include "../Version.h"
 #include "../actions/ClimateSetAction.hpp"
 #include "../actions/RideSetPriceAction.hpp"
@@ -36,6 +37,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/Painter.h"
 #include "../peep/Staff.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -695,6 +697,16 @@ static int32_t cc_get(InteractiveConsole& console, const arguments_t& argv)
         {
             console.WriteFormatLine("current_rotation %d", get_current_rotation());
         }
+        else if (argv[0] == "paint_arrange_engine")
+        {
+            console.WriteFormatLine("paint_arrange_engine %d", (int32_t)gPaintArrangeEngine);
+        }
+        else if (argv[0] == "paint_entries")
+        {
+            auto painter = OpenRCT2::GetContext()->GetPainter();
+            console.WriteFormatLine(
+                "paint_entries %zu (%zu chunks)", painter->GetPaintEntryPeak(), painter->GetPaintChunkPeak());
+        }
 #ifndef NO_TTF
         else if (argv[0] == "enable_hinting")
         {
@@ -1009,6 +1021,19 @@ static int32_t cc_set(InteractiveConsole& console, const arguments_t& argv)
             }
             console.Execute("get current_rotation");
         }
+        else if (argv[0] == "paint_arrange_engine" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            int32_t engine = int_val[0];
+            if (engine < (int32_t)PaintArrangeEngine::Legacy || engine > (int32_t)PaintArrangeEngine::Flat)
+            {
+                console.WriteLineError("Invalid argument. Valid engines are 0 (legacy) and 1 (flat).");
+            }
+            else
+            {
+                gPaintArrangeEngine = (PaintArrangeEngine)engine;
+            }
+            console.Execute("get paint_arrange_engine");
+        }
 #ifndef NO_TTF
         else if (argv[0] == "enable_hinting" && invalidArguments(&invalidArgs, int_valid[0]))
         {
@@ -1219,8 +1244,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    int32_t tileElementCount = map_get_tile_element_count();
 
     int32_t rideCount = ride_get_count();
     int32_t spriteCount = 0;
@@ -1570,6 +1594,60 @@ static int32_t cc_mp_desync(InteractiveConsole& console, const arguments_t& argv
     return 0;
 }
 
+static int32_t cc_profile_ticks(InteractiveConsole& console, const arguments_t& argv)
+{
+#ifdef DISABLE_TICK_PROFILER
+    console.WriteLineError("The tick profiler is not available in this build.");
+    return 1;
+#else
+    if (argv.size() >= 1)
+    {
+        if (argv[0] == "start")
+        {
+            OpenRCT2::TickProfiler::SetEnabled(true);
+            console.WriteLine("Tick profiler started.");
+        }
+        else if (argv[0] == "stop")
+        {
+            OpenRCT2::TickProfiler::SetEnabled(false);
+            console.WriteLine("Tick profiler stopped.");
+        }
+        else if (argv[0] == "reset")
+        {
+            OpenRCT2::TickProfiler::Reset();
+            console.WriteLine("Tick profiler reset.");
+        }
+        else
+        {
+            console.WriteLineError("Unknown subcommand, expected start, stop or reset.");
+            return 1;
+        }
+        return 0;
+    }
+
+    auto tickCount = OpenRCT2::TickProfiler::GetTickCount();
+    console.WriteFormatLine(
+        "%s, %llu ticks profiled", OpenRCT2::TickProfiler::IsEnabled() ? "Enabled" : "Disabled", (unsigned long long)tickCount);
+    if (tickCount == 0)
+    {
+        return 0;
+    }
+
+    console.WriteFormatLine("%-18s %9s %9s %9s %9s %9s", "section", "avg_us", "max_us", "last_us", "p50_us", "p99_us");
+    for (size_t i = 0; i < (size_t)OpenRCT2::TickSection::Count; i++)
+    {
+        auto section = (OpenRCT2::TickSection)i;
+        const auto& stats = OpenRCT2::TickProfiler::GetStats(section);
+        console.WriteFormatLine(
+            "%-18s %9.1f %9.1f %9.1f %9llu %9llu", OpenRCT2::TickProfiler::GetSectionName(section),
+            stats.TotalNs / 1000.0 / stats.Ticks, stats.MaxNs / 1000.0, stats.LastNs / 1000.0,
+            (unsigned long long)OpenRCT2::TickProfiler::GetPercentileUs(section, 50),
+            (unsigned long long)OpenRCT2::TickProfiler::GetPercentileUs(section, 99));
+    }
+    return 0;
+#endif
+}
+
 #pragma warning(push)
 #pragma warning(disable : 4702) // unreachable code
 static int32_t cc_abort([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -1643,6 +1721,8 @@ static constexpr const utf8* console_variable_table[] = {
     "cheat_disable_clearance_checks",
     "cheat_disable_support_limits",
     "current_rotation",
+    "paint_arrange_engine",
+    "paint_entries",
 };
 static constexpr const utf8* console_window_table[] = {
     "object_selection",
@@ -1670,6 +1750,7 @@ static constexpr const console_command console_command_table[] = {
                                     "load_object <objectfilenodat>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "profile_ticks", cc_profile_ticks, "Shows the time spent in each part of the game logic per tick.", "profile_ticks [start|stop|reset]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -18,6 +18,7 @@
 #include "../core/Console.hpp"
 #include "../core/Imaging.h"
 #include "../core/Optional.hpp"
+#include "../core/TaskScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
@@ -34,6 +35,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -41,6 +43,10 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Width of the strips a large viewport is split into for rendering, in view coordinates. Must be a multiple
+// of the 32 unit column width used by viewport_paint so that every strip paints exactly the same columns.
+constexpr int32_t RENDER_STRIP_WIDTH = 32 * 8;
+
 static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo* dpi, const rct_palette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -349,7 +355,60 @@ static rct_viewport GetGiantViewport(int32_t mapSize, int32_t rotation, int32_t
     return viewport;
 }
 
-static rct_drawpixelinfo RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& viewport)
+static bool CanRenderViewportInStrips()
+{
+    // Light effects are collected into a single global list while painting.
+    return gConfigGeneral.multithreading && !gConfigGeneral.enable_light_fx;
+}
+
+/**
+ * Paints the viewport as vertical strips on the task scheduler, each strip with its own drawing engine.
+ * Strip edges are kept on the paint column grid of viewport_paint so the result is identical to a single pass.
+ */
+static void RenderViewportStrips(const rct_drawpixelinfo& dpi, const rct_viewport& viewport)
+{
+    // Bounds as viewport_render would pass them to viewport_paint for the whole viewport.
+    const int32_t zoomMask = ~((1 << viewport.zoom) - 1);
+    const int32_t left = viewport.view_x & zoomMask;
+    const int32_t right = left + ((viewport.width << viewport.zoom) & zoomMask);
+    const int32_t top = viewport.view_y;
+    const int32_t bottom = viewport.view_y + (viewport.height << viewport.zoom);
+
+    struct RenderStrip
+    {
+        rct_drawpixelinfo DPI;
+        std::unique_ptr<X8DrawingEngine> DrawingEngine;
+        int32_t Left;
+        int32_t Right;
+    };
+
+    std::vector<RenderStrip> strips;
+    for (int32_t stripLeft = left; stripLeft < right;)
+    {
+        int32_t stripRight = std::min(floor2(stripLeft, RENDER_STRIP_WIDTH) + RENDER_STRIP_WIDTH, right);
+
+        // The drawing context of an engine is not thread safe, give each strip its own.
+        auto& strip = strips.emplace_back();
+        strip.DrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+        strip.DPI = dpi;
+        strip.DPI.DrawingEngine = strip.DrawingEngine.get();
+        strip.Left = stripLeft;
+        strip.Right = stripRight;
+
+        stripLeft = stripRight;
+    }
+
+    TaskGroup jobs;
+    for (auto& strip : strips)
+    {
+        jobs.Run([&viewport, &strip, top, bottom]() {
+            viewport_paint(&viewport, &strip.DPI, strip.Left, top, strip.Right, bottom);
+        });
+    }
+    jobs.Wait();
+}
+
+static rct_drawpixelinfo RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& viewport, bool useStrips)
 {
     // Ensure sprites appear regardless of rotation
     reset_all_sprite_quadrant_placements();
@@ -368,6 +427,12 @@ static rct_drawpixelinfo RenderViewport(IDrawingEngine* drawingEngine, const rct
         std::memset(dpi.bits, PALETTE_INDEX_0, (size_t)dpi.width * dpi.height);
     }
 
+    if (drawingEngine == nullptr && useStrips)
+    {
+        RenderViewportStrips(dpi, viewport);
+        return dpi;
+    }
+
     std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
     if (drawingEngine == nullptr)
     {
@@ -379,6 +444,11 @@ static rct_drawpixelinfo RenderViewport(IDrawingEngine* drawingEngine, const rct
     return dpi;
 }
 
+static rct_drawpixelinfo RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& viewport)
+{
+    return RenderViewport(drawingEngine, viewport, CanRenderViewportInStrips());
+}
+
 void screenshot_giant()
 {
     rct_drawpixelinfo dpi;
@@ -466,6 +536,67 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
     free(dpi.bits);
 }
 
+static void benchgfx_render_giant_screenshots(
+    const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
+{
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return;
+    }
+
+    gIntroState = INTRO_STATE_NONE;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    // Text rendering only takes its locks when multithreading is enabled.
+    bool oldMultithreading = gConfigGeneral.multithreading;
+    gConfigGeneral.multithreading = true;
+
+    rct_drawpixelinfo singleDpi;
+    rct_drawpixelinfo stripsDpi;
+    try
+    {
+        auto viewport = GetGiantViewport(gMapSize, get_current_rotation(), 0);
+        size_t imageSize = (size_t)viewport.width * viewport.height;
+
+        std::chrono::duration<float> singleDuration{};
+        std::chrono::duration<float> stripsDuration{};
+        bool identical = true;
+        for (uint32_t i = 0; i < iterationCount; i++)
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            singleDpi = RenderViewport(nullptr, viewport, false);
+            auto midTime = std::chrono::high_resolution_clock::now();
+            stripsDpi = RenderViewport(nullptr, viewport, true);
+            auto endTime = std::chrono::high_resolution_clock::now();
+
+            singleDuration += midTime - startTime;
+            stripsDuration += endTime - midTime;
+            identical &= std::memcmp(singleDpi.bits, stripsDpi.bits, imageSize) == 0;
+
+            free(singleDpi.bits);
+            free(stripsDpi.bits);
+            singleDpi.bits = nullptr;
+            stripsDpi.bits = nullptr;
+        }
+
+        std::printf(
+            "Rendering a %dx%d giant screenshot %u times:\n"
+            "  single pass:  %.2f seconds\n"
+            "  %zu threads: %.2f seconds (%.2fx)\n"
+            "  output is %s\n",
+            viewport.width, viewport.height, iterationCount, singleDuration.count(),
+            TaskScheduler::Get().GetWorkerCount() + 1, stripsDuration.count(),
+            singleDuration.count() / std::max(stripsDuration.count(), 0.001f), identical ? "identical" : "DIFFERENT");
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "%s", e.what());
+    }
+    free(singleDpi.bits);
+    free(stripsDpi.bits);
+    gConfigGeneral.multithreading = oldMultithreading;
+}
+
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
 {
     if (argc != 1 && argc != 2)
@@ -498,6 +629,38 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     return 1;
 }
 
+int32_t cmdline_for_gfxbench_giant(const char** argv, int32_t argc)
+{
+    if (argc != 1 && argc != 2)
+    {
+        printf("Usage: openrct2 benchgfx giant <file> [<iteration_count>]\n");
+        return -1;
+    }
+
+    core_init();
+    int32_t iterationCount = 5;
+    if (argc == 2)
+    {
+        iterationCount = atoi(argv[1]);
+    }
+
+    const char* inputPath = argv[0];
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        drawing_engine_init();
+
+        benchgfx_render_giant_screenshots(inputPath, context, iterationCount);
+
+        drawing_engine_dispose();
+    }
+
+    return 1;
+}
+
 static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewport)
 {
     if (options->weather != 0)
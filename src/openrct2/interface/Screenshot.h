@@ -39,3 +39,4 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
+int32_t cmdline_for_gfxbench_giant(const char** argv, int32_t argc);
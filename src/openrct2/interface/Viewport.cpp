@@ -14,7 +14,7 @@
 #include "../Input.h"
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
-#include "../core/JobPool.hpp"
+#include "../core/TaskScheduler.h"
 #include "../drawing/Drawing.h"
 #include "../paint/Paint.h"
 #include "../peep/Staff.h"
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -43,7 +44,6 @@ rct_viewport g_viewport_list[MAX_VIEWPORT_COUNT];
 rct_viewport* g_music_tracking_viewport;
 
 static TileElement* _interaction_element = nullptr;
-static std::unique_ptr<JobPool> _paintJobs;
 
 int16_t gSavedViewX;
 int16_t gSavedViewY;
@@ -796,7 +796,7 @@ void viewport_update_smart_vehicle_follow(rct_window* window)
  */
 void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
-    std::vector<paint_session>* sessions)
+    std::vector<RecordedPaintSession>* recordedSessions)
 {
     if (right <= viewport->x)
         return;
@@ -826,7 +826,7 @@ void viewport_render(
     top += viewport->view_y;
     bottom += viewport->view_y;
 
-    viewport_paint(viewport, dpi, left, top, right, bottom, sessions);
+    viewport_paint(viewport, dpi, left, top, right, bottom, recordedSessions);
 
 #ifdef DEBUG_SHOW_DIRTY_BOX
     if (viewport != g_viewport_list)
@@ -886,7 +886,7 @@ static void viewport_paint_column(paint_session* session)
  */
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<paint_session>* sessions)
+    std::vector<RecordedPaintSession>* recordedSessions)
 {
     uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
@@ -926,14 +926,13 @@ void viewport_paint(
     bool useMultithreading = gConfigGeneral.multithreading;
     if (window_get_main() != nullptr && viewport != window_get_main()->viewport)
         useMultithreading = false;
+    if (recordedSessions != nullptr)
+        useMultithreading = false;
 
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
+    std::optional<TaskGroup> paintJobs;
+    if (useMultithreading)
     {
-        _paintJobs.reset();
+        paintJobs.emplace();
     }
 
     // Splits the area into 32 pixel columns and renders them
@@ -964,7 +963,14 @@ void viewport_paint(
 
         if (useMultithreading)
         {
-            _paintJobs->AddTask([session]() -> void { viewport_fill_column(session); });
+            paintJobs->Run([session]() -> void { viewport_fill_column(session); });
+        }
+        else if (recordedSessions != nullptr)
+        {
+            // Keep a copy of the unsorted paint structs around for the sprite sort benchmark.
+            paint_session_generate(session);
+            recordedSessions->push_back(paint_session_record(session));
+            paint_session_arrange(session);
         }
         else
         {
@@ -974,7 +980,7 @@ void viewport_paint(
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        paintJobs->Wait();
     }
 
     for (auto&& column : columns)
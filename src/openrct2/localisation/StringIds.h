@@ -3967,6 +3967,7 @@ enum
 
     STR_STRING_STRINGID = 6329,
     STR_DOWNLOADING_OBJECTS_FROM = 6330,
+    STR_MULTIPLAYER_DOWNLOADING_MAP_PARTIAL = 6331,
 
     // Have to include resource strings (from scenarios and objects) for the time being now that language is partially working
     STR_COUNT = 32768
@@ -34,7 +34,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "18"
+#define NETWORK_STREAM_VERSION "22"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -43,6 +43,8 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // General chunk size is 63 KiB, this can not be any larger because the packet size is encoded
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
+// Resync requests carry the block hashes in a single packet, larger parks are downloaded in full
+static constexpr uint32_t RESYNC_MAX_BLOCKS = 8000;
 
 #ifndef DISABLE_NETWORK
 
@@ -71,10 +73,13 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "NetworkAction.h"
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
+#    include "NetworkIOThread.h"
 #    include "NetworkKey.h"
+#    include "NetworkMapSnapshot.h"
 #    include "NetworkPacket.h"
 #    include "NetworkPlayer.h"
 #    include "NetworkServerAdvertiser.h"
+#    include "NetworkStateDelta.h"
 #    include "NetworkUser.h"
 #    include "Socket.h"
 
@@ -87,6 +92,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include <list>
 #    include <map>
 #    include <memory>
+#    include <optional>
 #    include <set>
 #    include <string>
 #    include <vector>
@@ -106,6 +112,7 @@ enum
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUM = 1 << 1,
 };
 
 static void network_chat_show_connected_message();
@@ -141,9 +148,10 @@ public:
     std::vector<std::unique_ptr<NetworkGroup>>::iterator GetGroupIteratorByID(uint8_t id);
     NetworkGroup* GetGroupByID(uint8_t id);
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
-    void SendPacketToClients(NetworkPacket& packet, bool front = false, bool gameCmd = false);
+    void SendPacketToClients(std::unique_ptr<NetworkPacket> packet, bool front = false, bool gameCmd = false);
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool IsDesynchronised();
+    bool IsMapLoaded() const;
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
     NetworkServerState_t GetServerState() const;
@@ -170,6 +178,7 @@ public:
     void CloseServerLog();
 
     void Client_Send_RequestGameState(uint32_t tick);
+    bool Client_Send_REQUEST_RESYNC(bool onJoin);
 
     void Client_Send_TOKEN();
     void Client_Send_AUTH(
@@ -177,6 +186,7 @@ public:
     void Server_Send_AUTH(NetworkConnection& connection);
     void Server_Send_TOKEN(NetworkConnection& connection);
     void Server_Send_MAP(NetworkConnection* connection = nullptr);
+    bool Server_Send_RESYNC(NetworkConnection& connection, uint32_t resyncId, const std::vector<uint64_t>& hashes);
     void Client_Send_CHAT(const char* text);
     void Server_Send_CHAT(const char* text);
     void Client_Send_GAME_ACTION(const GameAction* action);
@@ -219,7 +229,7 @@ private:
 
     bool ProcessConnection(NetworkConnection& connection);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
-    void AddClient(std::unique_ptr<ITcpSocket>&& socket);
+    void AddClient(std::shared_ptr<NetworkIOChannel>&& channel);
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
 
     void RemovePlayer(std::unique_ptr<NetworkConnection>& connection);
@@ -232,6 +242,9 @@ private:
 
     bool LoadMap(IStream* stream);
     bool SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
+    bool SaveResyncBase();
+    void BeginReceivedMap();
+    void LoadReceivedMap(void* data, size_t size);
 
     struct PlayerListUpdate
     {
@@ -243,6 +256,7 @@ private:
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        std::optional<uint64_t> spriteChecksum;
     };
 
     std::map<uint32_t, ServerTickData_t> _serverTickData;
@@ -256,7 +270,7 @@ private:
     bool _requireReconnect = false;
     bool wsa_initialized = false;
     bool _clientMapLoaded = false;
-    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<NetworkIOThread> _ioThread;
     std::unique_ptr<NetworkConnection> _serverConnection;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     uint16_t listening_port = 0;
@@ -264,6 +278,14 @@ private:
     uint32_t last_ping_sent_time = 0;
     uint8_t player_id = 0;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
+    // Shared by the clients that join during the same update
+    std::shared_ptr<NetworkMapSnapshot> _mapSnapshot;
+    // Park serialised for resyncs during the current update
+    std::unique_ptr<MemoryStream> _resyncState;
+    // Park the client had when it asked for a resync, the delta from the server is applied to it
+    std::vector<uint8_t> _resyncBase;
+    uint32_t _resyncId = 0;
+    bool _resyncOnReconnect = false;
     std::vector<uint8_t> chunk_buffer;
     std::string _host;
     uint16_t _port = 0;
@@ -313,8 +335,10 @@ private:
     void Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_REQUEST_RESYNC(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_RESYNC(NetworkConnection& connection, NetworkPacket& packet);
 
-    uint8_t* save_for_network(size_t& out_size, const std::vector<const ObjectRepositoryItem*>& objects) const;
+    std::shared_ptr<NetworkMapSnapshot> GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects);
 
     std::ofstream _chat_log_fs;
     std::ofstream _server_log_fs;
@@ -347,6 +371,7 @@ Network::Network()
     client_command_handlers[NETWORK_COMMAND_TOKEN] = &Network::Client_Handle_TOKEN;
     client_command_handlers[NETWORK_COMMAND_OBJECTS] = &Network::Client_Handle_OBJECTS;
     client_command_handlers[NETWORK_COMMAND_GAMESTATE] = &Network::Client_Handle_GAMESTATE;
+    client_command_handlers[NETWORK_COMMAND_RESYNC] = &Network::Client_Handle_RESYNC;
     server_command_handlers.resize(NETWORK_COMMAND_MAX, nullptr);
     server_command_handlers[NETWORK_COMMAND_AUTH] = &Network::Server_Handle_AUTH;
     server_command_handlers[NETWORK_COMMAND_CHAT] = &Network::Server_Handle_CHAT;
@@ -356,6 +381,7 @@ Network::Network()
     server_command_handlers[NETWORK_COMMAND_TOKEN] = &Network::Server_Handle_TOKEN;
     server_command_handlers[NETWORK_COMMAND_OBJECTS] = &Network::Server_Handle_OBJECTS;
     server_command_handlers[NETWORK_COMMAND_REQUEST_GAMESTATE] = &Network::Server_Handle_REQUEST_GAMESTATE;
+    server_command_handlers[NETWORK_COMMAND_REQUEST_RESYNC] = &Network::Server_Handle_REQUEST_RESYNC;
 
     _chat_log_fs << std::unitbuf;
     _server_log_fs << std::unitbuf;
@@ -386,6 +412,16 @@ bool Network::Init()
 
 void Network::Reconnect()
 {
+    // Keep the park so that only the parts that differ from the server's have to be downloaded again
+    if (_clientMapLoaded && SaveResyncBase())
+    {
+        if (GetMode() == NETWORK_MODE_CLIENT && status == NETWORK_STATUS_CONNECTED && !_requireClose
+            && IsDesynchronised() && Client_Send_REQUEST_RESYNC(false))
+        {
+            return;
+        }
+        _resyncOnReconnect = true;
+    }
     if (status != NETWORK_STATUS_NONE)
     {
         Close();
@@ -453,7 +489,9 @@ void Network::CloseConnection()
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
-        _listenSocket.reset();
+        _mapSnapshot.reset();
+        _resyncState.reset();
+        _ioThread.reset();
         _advertiser.reset();
     }
 
@@ -579,10 +617,11 @@ bool Network::BeginServer(uint16_t port, const std::string& address)
 
     log_verbose("Begin listening for clients");
 
-    _listenSocket = CreateTcpSocket();
     try
     {
-        _listenSocket->Listen(address, port);
+        auto listenSocket = CreateTcpSocket();
+        listenSocket->Listen(address, port);
+        _ioThread = std::make_unique<NetworkIOThread>(std::move(listenSocket));
     }
     catch (const std::exception& ex)
     {
@@ -738,11 +777,15 @@ void Network::UpdateServer()
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    std::shared_ptr<NetworkIOChannel> channel;
+    while ((channel = _ioThread->AcceptChannel()) != nullptr)
     {
-        AddClient(std::move(tcpSocket));
+        AddClient(std::move(channel));
     }
+
+    // The park may change before the next update, connections keep the snapshot they are still sending
+    _mapSnapshot = nullptr;
+    _resyncState = nullptr;
 }
 
 void Network::UpdateClient()
@@ -916,8 +959,11 @@ const char* Network::FormatChat(NetworkPlayer* fromplayer, const char* text)
     return formatted;
 }
 
-void Network::SendPacketToClients(NetworkPacket& packet, bool front, bool gameCmd)
+void Network::SendPacketToClients(std::unique_ptr<NetworkPacket> packet, bool front, bool gameCmd)
 {
+    // Every client queues the same immutable packet instead of a copy
+    packet->Size = (uint16_t)packet->Data->size();
+    std::shared_ptr<const NetworkPacket> sharedPacket(std::move(packet));
     for (auto& client_connection : client_connection_list)
     {
         if (client_connection->IsDisconnected)
@@ -937,7 +983,7 @@ void Network::SendPacketToClients(NetworkPacket& packet, bool front, bool gameCm
                 continue;
             }
         }
-        client_connection->QueuePacket(NetworkPacket::Duplicate(packet), front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -960,6 +1006,18 @@ bool Network::CheckSRAND(uint32_t tick, uint32_t srand0)
         return false;
     }
 
+    if (storedTick.spriteChecksum)
+    {
+        uint64_t checksum = sprite_incremental_checksum();
+        if (checksum != *storedTick.spriteChecksum)
+        {
+            log_info(
+                "Sprite checksum mismatch, client = %016llX, server = %016llX", (unsigned long long)checksum,
+                (unsigned long long)*storedTick.spriteChecksum);
+            return false;
+        }
+    }
+
     if (!storedTick.spriteHash.empty())
     {
         rct_sprite_checksum checksum = sprite_checksum();
@@ -979,6 +1037,11 @@ bool Network::IsDesynchronised()
     return _serverState.state == NETWORK_SERVER_STATE_DESYNCED;
 }
 
+bool Network::IsMapLoaded() const
+{
+    return _clientMapLoaded;
+}
+
 bool Network::CheckDesynchronizaton()
 {
     // Check synchronisation
@@ -1029,7 +1092,7 @@ void Network::KickPlayer(int32_t playerId)
             char str_disconnect_msg[256];
             format_string(str_disconnect_msg, 256, STR_MULTIPLAYER_KICKED_REASON, nullptr);
             Server_Send_SETDISCONNECTMSG(*client_connection, str_disconnect_msg);
-            client_connection->Socket->Disconnect();
+            client_connection->Disconnect();
             break;
         }
     }
@@ -1397,6 +1460,28 @@ void Network::Client_Send_RequestGameState(uint32_t tick)
     _serverConnection->QueuePacket(std::move(packet));
 }
 
+bool Network::Client_Send_REQUEST_RESYNC(bool onJoin)
+{
+    auto hashes = NetworkStateDelta::HashBlocks(_resyncBase.data(), _resyncBase.size());
+    if (hashes.size() > RESYNC_MAX_BLOCKS)
+    {
+        log_verbose("Park is too large for a resync, it will be downloaded in full");
+        return false;
+    }
+
+    log_verbose("Requesting resync for a park of %u bytes", (uint32_t)_resyncBase.size());
+    _resyncId++;
+    std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+    *packet << (uint32_t)NETWORK_COMMAND_REQUEST_RESYNC << _resyncId << (uint8_t)onJoin << NetworkStateDelta::BlockSize
+            << (uint32_t)hashes.size();
+    for (auto hash : hashes)
+    {
+        *packet << hash;
+    }
+    _serverConnection->QueuePacket(std::move(packet));
+    return true;
+}
+
 void Network::Client_Send_TOKEN()
 {
     log_verbose("requesting token");
@@ -1494,12 +1579,23 @@ void Network::Server_Send_AUTH(NetworkConnection& connection)
     connection.QueuePacket(std::move(packet));
     if (connection.AuthStatus != NETWORK_AUTH_OK && connection.AuthStatus != NETWORK_AUTH_REQUIREPASSWORD)
     {
-        connection.Socket->Disconnect();
+        connection.Disconnect();
     }
 }
 
 void Network::Server_Send_MAP(NetworkConnection* connection)
 {
+    // Clients rejoining with the park they already have only get the parts that differ
+    if (connection != nullptr && !connection->ResyncHashes.empty())
+    {
+        auto hashes = std::move(connection->ResyncHashes);
+        connection->ResyncHashes.clear();
+        if (connection->RequestedObjects.empty() && Server_Send_RESYNC(*connection, connection->ResyncId, hashes))
+        {
+            return;
+        }
+    }
+
     std::vector<const ObjectRepositoryItem*> objects;
     if (connection)
     {
@@ -1514,87 +1610,98 @@ void Network::Server_Send_MAP(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    size_t out_size;
-    uint8_t* header = save_for_network(out_size, objects);
-    if (header == nullptr)
+    auto snapshot = GetMapSnapshot(objects);
+    if (snapshot == nullptr)
     {
         if (connection)
         {
             connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-            connection->Socket->Disconnect();
+            connection->Disconnect();
         }
         return;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < out_size; i += chunksize)
+    if (connection)
     {
-        size_t datasize = std::min(chunksize, out_size - i);
-        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
-        *packet << (uint32_t)NETWORK_COMMAND_MAP << (uint32_t)out_size << (uint32_t)i;
-        packet->Write(&header[i], datasize);
-        if (connection)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
+        connection->SendMapSnapshot(snapshot);
+    }
+    else
+    {
+        for (auto& client_connection : client_connection_list)
         {
-            SendPacketToClients(*packet);
+            // MAP packets are only ever sent to authenticated clients
+            if (!client_connection->IsDisconnected && client_connection->AuthStatus == NETWORK_AUTH_OK)
+            {
+                client_connection->SendMapSnapshot(snapshot);
+            }
         }
     }
-    free(header);
 }
 
-uint8_t* Network::save_for_network(size_t& out_size, const std::vector<const ObjectRepositoryItem*>& objects) const
+std::shared_ptr<NetworkMapSnapshot> Network::GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    uint8_t* header = nullptr;
-    out_size = 0;
+    if (_mapSnapshot != nullptr && _mapSnapshot->GetObjects() == objects)
+    {
+        return _mapSnapshot;
+    }
+
     bool RLEState = gUseRLE;
     gUseRLE = false;
-
-    auto ms = MemoryStream();
-    if (!SaveMap(&ms, objects))
+    auto ms = std::make_unique<MemoryStream>();
+    bool saved = SaveMap(ms.get(), objects);
+    gUseRLE = RLEState;
+    if (!saved)
     {
         log_warning("Failed to export map.");
         return nullptr;
     }
-    gUseRLE = RLEState;
 
-    const void* data = ms.GetData();
-    int32_t size = ms.GetLength();
+    // Compression happens on the snapshot's own thread, the packets are sent as they become available
+    _mapSnapshot = std::make_shared<NetworkMapSnapshot>(objects, std::move(ms));
+    return _mapSnapshot;
+}
 
-    uint8_t* compressed = util_zlib_deflate((const uint8_t*)data, size, &out_size);
-    if (compressed != nullptr)
+bool Network::Server_Send_RESYNC(NetworkConnection& connection, uint32_t resyncId, const std::vector<uint64_t>& hashes)
+{
+    if (_resyncState == nullptr)
     {
-        header = (uint8_t*)_strdup("open2_sv6_zlib");
-        size_t header_len = strlen((char*)header) + 1; // account for null terminator
-        header = (uint8_t*)realloc(header, header_len + out_size);
-        if (header == nullptr)
+        bool RLEState = gUseRLE;
+        gUseRLE = false;
+        auto ms = std::make_unique<MemoryStream>();
+        bool saved = SaveMap(ms.get(), {});
+        gUseRLE = RLEState;
+        if (!saved)
         {
-            log_error("Failed to allocate %u bytes.", header_len + out_size);
-        }
-        else
-        {
-            std::memcpy(&header[header_len], compressed, out_size);
-            out_size += header_len;
-            log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, out_size);
+            log_warning("Failed to export map.");
+            return false;
         }
-        free(compressed);
+        _resyncState = std::move(ms);
     }
-    else
+
+    auto delta = NetworkStateDelta::Create(_resyncState->GetData(), _resyncState->GetLength(), hashes);
+    size_t compressedSize;
+    uint8_t* compressed = util_zlib_deflate(delta.data(), delta.size(), &compressedSize);
+    if (compressed == nullptr)
     {
-        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
-        header = (uint8_t*)malloc(size);
-        if (header == nullptr)
-        {
-            log_error("Failed to allocate %u bytes.", size);
-        }
-        else
-        {
-            out_size = size;
-            std::memcpy(header, data, size);
-        }
+        log_warning("Failed to compress the resync.");
+        return false;
+    }
+    log_verbose(
+        "Sending resync of %u bytes for a park of %u bytes, compressed to %u bytes", (uint32_t)delta.size(),
+        (uint32_t)_resyncState->GetLength(), (uint32_t)compressedSize);
+
+    uint32_t totalSize = (uint32_t)compressedSize;
+    uint32_t bytesSent = 0;
+    while (bytesSent < totalSize)
+    {
+        uint32_t dataSize = std::min(CHUNK_SIZE, totalSize - bytesSent);
+        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+        *packet << (uint32_t)NETWORK_COMMAND_RESYNC << resyncId << totalSize << bytesSent << dataSize;
+        packet->Write(&compressed[bytesSent], dataSize);
+        connection.QueuePacket(std::move(packet));
+        bytesSent += dataSize;
     }
-    return header;
+    free(compressed);
+    return true;
 }
 
 void Network::Client_Send_CHAT(const char* text)
@@ -1610,7 +1717,7 @@ void Network::Server_Send_CHAT(const char* text)
     std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
     *packet << (uint32_t)NETWORK_COMMAND_CHAT;
     packet->WriteString(text);
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Client_Send_GAME_ACTION(const GameAction* action)
@@ -1643,14 +1750,16 @@ void Network::Server_Send_GAME_ACTION(const GameAction* action)
 
     *packet << (uint32_t)NETWORK_COMMAND_GAME_ACTION << gCurrentTicks << action->GetType() << stream;
 
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Server_Send_TICK()
 {
     std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
     *packet << (uint32_t)NETWORK_COMMAND_TICK << gCurrentTicks << scenario_rand_state().s0;
-    uint32_t flags = 0;
+    // The incremental checksum is cheap enough to send every tick, the full hash is still sent now and then as it also
+    // covers sprite writes that the incremental checksum only notices once the sprite is moved or relinked.
+    uint32_t flags = NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUM;
     // Simple counter which limits how often a sprite checksum gets sent.
     // This can get somewhat expensive, so we don't want to push it every tick in release,
     // but debug version can check more often.
@@ -1669,8 +1778,12 @@ void Network::Server_Send_TICK()
         rct_sprite_checksum checksum = sprite_checksum();
         packet->WriteString(checksum.ToString().c_str());
     }
+    if (flags & NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUM)
+    {
+        *packet << sprite_incremental_checksum();
+    }
 
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Server_Send_PLAYERINFO(int32_t playerId)
@@ -1683,7 +1796,7 @@ void Network::Server_Send_PLAYERINFO(int32_t playerId)
         return;
 
     player->Write(*packet);
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Server_Send_PLAYERLIST()
@@ -1694,7 +1807,7 @@ void Network::Server_Send_PLAYERLIST()
     {
         player->Write(*packet);
     }
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Client_Send_PING()
@@ -1713,7 +1826,7 @@ void Network::Server_Send_PING()
     {
         client_connection->PingTime = platform_get_ticks();
     }
-    SendPacketToClients(*packet, true);
+    SendPacketToClients(std::move(packet), true);
 }
 
 void Network::Server_Send_PINGLIST()
@@ -1724,7 +1837,7 @@ void Network::Server_Send_PINGLIST()
     {
         *packet << player->Id << player->Ping;
     }
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, const char* msg)
@@ -1795,7 +1908,7 @@ void Network::Server_Send_EVENT_PLAYER_JOINED(const char* playerName)
     *packet << (uint32_t)NETWORK_COMMAND_EVENT;
     *packet << (uint16_t)SERVER_EVENT_PLAYER_JOINED;
     packet->WriteString(playerName);
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 void Network::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, const char* reason)
@@ -1805,7 +1918,7 @@ void Network::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, cons
     *packet << (uint16_t)SERVER_EVENT_PLAYER_DISCONNECTED;
     packet->WriteString(playerName);
     packet->WriteString(reason);
-    SendPacketToClients(*packet);
+    SendPacketToClients(std::move(packet));
 }
 
 bool Network::ProcessConnection(NetworkConnection& connection)
@@ -1826,7 +1939,7 @@ bool Network::ProcessConnection(NetworkConnection& connection)
             case NETWORK_READPACKET_SUCCESS:
                 // done reading in packet
                 ProcessPacket(connection, connection.InboundPacket);
-                if (connection.Socket == nullptr)
+                if (connection.Socket == nullptr && connection.Channel == nullptr)
                 {
                     return false;
                 }
@@ -2002,16 +2115,16 @@ void Network::ProcessDisconnectedClients()
     }
 }
 
-void Network::AddClient(std::unique_ptr<ITcpSocket>&& socket)
+void Network::AddClient(std::shared_ptr<NetworkIOChannel>&& channel)
 {
     // Log connection info.
     char addr[128];
-    snprintf(addr, sizeof(addr), "Client joined from %s", socket->GetHostName());
+    snprintf(addr, sizeof(addr), "Client joined from %s", channel->GetHostName().c_str());
     AppendServerLog(addr);
 
     // Store connection
     auto connection = std::make_unique<NetworkConnection>();
-    connection->Socket = std::move(socket);
+    connection->Channel = std::move(channel);
 
     client_connection_list.push_back(std::move(connection));
 }
@@ -2199,7 +2312,7 @@ void Network::Client_Handle_TOKEN(NetworkConnection& connection, NetworkPacket&
     {
         log_error("Failed to load key %s", keyPath);
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         return;
     }
 
@@ -2216,7 +2329,7 @@ void Network::Client_Handle_TOKEN(NetworkConnection& connection, NetworkPacket&
     {
         log_error("Failed to sign server's challenge.");
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         return;
     }
     // Don't keep private key in memory. There's no need and it may get leaked
@@ -2281,37 +2394,37 @@ void Network::Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& p
             break;
         case NETWORK_AUTH_BADNAME:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_BAD_PLAYER_NAME);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NETWORK_AUTH_BADVERSION:
         {
             const char* version = packet.ReadString();
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_INCORRECT_SOFTWARE_VERSION, &version);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         }
         case NETWORK_AUTH_BADPASSWORD:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_BAD_PASSWORD);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NETWORK_AUTH_VERIFICATIONFAILURE:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NETWORK_AUTH_FULL:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_SERVER_FULL);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NETWORK_AUTH_REQUIREPASSWORD:
             context_open_window_view(WV_NETWORK_PASSWORD);
             break;
         case NETWORK_AUTH_UNKNOWN_KEY_DISALLOWED:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_UNKNOWN_KEY_DISALLOWED);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         default:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_INCORRECT_SOFTWARE_VERSION);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
     }
 }
@@ -2360,7 +2473,7 @@ void Network::Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket
     if (size > OBJECT_ENTRY_COUNT)
     {
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_SERVER_INVALID_REQUEST);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         log_warning("Server sent invalid amount of objects");
         return;
     }
@@ -2387,6 +2500,15 @@ void Network::Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket
                 ori->ObjectEntry.flags, checksum, flags);
         }
     }
+    if (_resyncOnReconnect)
+    {
+        // Objects the client does not have change the park, it has to be downloaded in full then
+        _resyncOnReconnect = false;
+        if (!requested_objects.empty() || !Client_Send_REQUEST_RESYNC(true))
+        {
+            _resyncBase = {};
+        }
+    }
     Client_Send_OBJECTS(requested_objects);
 }
 
@@ -2457,6 +2579,35 @@ void Network::Client_Handle_GAMESTATE(NetworkConnection& connection, NetworkPack
     }
 }
 
+void Network::Server_Handle_REQUEST_RESYNC(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t resyncId, blockSize, hashCount;
+    uint8_t onJoin;
+    packet >> resyncId >> onJoin >> blockSize >> hashCount;
+    if (blockSize != NetworkStateDelta::BlockSize || hashCount > RESYNC_MAX_BLOCKS
+        || packet.BytesRead + hashCount * sizeof(uint64_t) > packet.Size)
+    {
+        log_warning("Client sent an invalid resync request");
+        return;
+    }
+    std::vector<uint64_t> hashes(hashCount);
+    for (auto& hash : hashes)
+    {
+        packet >> hash;
+    }
+
+    if (onJoin)
+    {
+        // Answered instead of the map once the objects have been negotiated
+        connection.ResyncId = resyncId;
+        connection.ResyncHashes = std::move(hashes);
+    }
+    else if (!Server_Send_RESYNC(connection, resyncId, hashes))
+    {
+        Server_Send_MAP(&connection);
+    }
+}
+
 void Network::Server_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t size;
@@ -2464,7 +2615,7 @@ void Network::Server_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket
     if (size > OBJECT_ENTRY_COUNT)
     {
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_CLIENT_INVALID_REQUEST);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         std::string playerName = "(unknown)";
         if (connection.Player)
         {
@@ -2618,24 +2769,21 @@ void Network::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection,
     }
     if (offset == 0)
     {
-        // Start of a new map load, clear the queue now as we have to buffer them
-        // until the map is fully loaded.
-        GameActions::ClearQueue();
-        GameActions::SuspendQueue();
-
-        _serverTickData.clear();
-        _clientMapLoaded = false;
+        BeginReceivedMap();
     }
-    if (size > chunk_buffer.size())
+    // The size is only known from the last chunk, the server sends the map while it is still compressing it
+    if (std::max<size_t>(size, offset + chunksize) > chunk_buffer.size())
     {
-        chunk_buffer.resize(size);
+        chunk_buffer.resize(std::max<size_t>(size, offset + chunksize));
     }
     char str_downloading_map[256];
     uint32_t downloading_map_args[2] = {
         (offset + chunksize) / 1024,
         size / 1024,
     };
-    format_string(str_downloading_map, 256, STR_MULTIPLAYER_DOWNLOADING_MAP, downloading_map_args);
+    format_string(
+        str_downloading_map, 256, size == 0 ? STR_MULTIPLAYER_DOWNLOADING_MAP_PARTIAL : STR_MULTIPLAYER_DOWNLOADING_MAP,
+        downloading_map_args);
 
     auto intent = Intent(WC_NETWORK_STATUS);
     intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_downloading_map });
@@ -2671,28 +2819,7 @@ void Network::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection,
             log_verbose("Assuming received map is in plain sv6 format");
         }
 
-        auto ms = MemoryStream(data, data_size);
-        if (LoadMap(&ms))
-        {
-            game_load_init();
-            _serverState.tick = gCurrentTicks;
-            // window_network_status_open("Loaded new map from network");
-            _serverState.state = NETWORK_SERVER_STATE_OK;
-            _clientMapLoaded = true;
-            gFirstTimeSaving = true;
-
-            // Notify user he is now online and which shortcut key enables chat
-            network_chat_show_connected_message();
-
-            // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
-            fix_invalid_vehicle_sprite_sizes();
-        }
-        else
-        {
-            // Something went wrong, game is not loaded. Return to main screen.
-            auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PM_SAVE_BEFORE_QUIT);
-            GameActions::Execute(&loadOrQuitAction);
-        }
+        LoadReceivedMap(data, data_size);
         if (has_to_free)
         {
             free(data);
@@ -2700,6 +2827,99 @@ void Network::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection,
     }
 }
 
+void Network::Client_Handle_RESYNC([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t resyncId, size, offset, dataSize;
+    packet >> resyncId >> size >> offset >> dataSize;
+    const uint8_t* data = packet.Read(dataSize);
+    // Replies to an earlier request can still arrive after the park has been saved again
+    if (resyncId != _resyncId || _resyncBase.empty() || data == nullptr || dataSize == 0
+        || (uint64_t)offset + dataSize > size)
+    {
+        return;
+    }
+    if (offset == 0)
+    {
+        BeginReceivedMap();
+    }
+    if (size > chunk_buffer.size())
+    {
+        chunk_buffer.resize(size);
+    }
+    char str_downloading_map[256];
+    uint32_t downloading_map_args[2] = {
+        (offset + dataSize) / 1024,
+        size / 1024,
+    };
+    format_string(str_downloading_map, 256, STR_MULTIPLAYER_DOWNLOADING_MAP, downloading_map_args);
+
+    auto intent = Intent(WC_NETWORK_STATUS);
+    intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_downloading_map });
+    intent.putExtra(INTENT_EXTRA_CALLBACK, []() -> void { gNetwork.Close(); });
+    context_open_intent(&intent);
+
+    std::memcpy(&chunk_buffer[offset], data, dataSize);
+    if (offset + dataSize == size)
+    {
+        GameActions::ResumeQueue();
+        context_force_close_window_by_class(WC_NETWORK_STATUS);
+
+        size_t deltaSize;
+        uint8_t* delta = util_zlib_inflate(chunk_buffer.data(), size, &deltaSize);
+        auto park = std::move(_resyncBase);
+        _resyncBase = {};
+        bool applied = delta != nullptr && NetworkStateDelta::Apply(park, delta, deltaSize);
+        free(delta);
+        if (!applied)
+        {
+            // The next reconnect downloads the whole map
+            log_warning("Failed to apply the resync sent from server.");
+            Close();
+            return;
+        }
+        log_verbose("Received resync of %u bytes for a park of %u bytes", (uint32_t)deltaSize, (uint32_t)park.size());
+        LoadReceivedMap(park.data(), park.size());
+    }
+}
+
+void Network::BeginReceivedMap()
+{
+    // Start of a new map load, clear the queue now as we have to buffer them
+    // until the map is fully loaded.
+    GameActions::ClearQueue();
+    GameActions::SuspendQueue();
+
+    _serverTickData.clear();
+    _clientMapLoaded = false;
+}
+
+void Network::LoadReceivedMap(void* data, size_t size)
+{
+    _resyncBase = {};
+    auto ms = MemoryStream(data, size);
+    if (LoadMap(&ms))
+    {
+        game_load_init();
+        _serverState.tick = gCurrentTicks;
+        // window_network_status_open("Loaded new map from network");
+        _serverState.state = NETWORK_SERVER_STATE_OK;
+        _clientMapLoaded = true;
+        gFirstTimeSaving = true;
+
+        // Notify user he is now online and which shortcut key enables chat
+        network_chat_show_connected_message();
+
+        // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
+        fix_invalid_vehicle_sprite_sizes();
+    }
+    else
+    {
+        // Something went wrong, game is not loaded. Return to main screen.
+        auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PM_SAVE_BEFORE_QUIT);
+        GameActions::Execute(&loadOrQuitAction);
+    }
+}
+
 bool Network::LoadMap(IStream* stream)
 {
     bool result = false;
@@ -2720,6 +2940,9 @@ bool Network::LoadMap(IStream* stream)
 
         // Read other data not in normal save files
         stream->Read(gSpriteSpatialIndex, 0x10001 * sizeof(uint16_t));
+        sprite_incremental_checksum_invalidate();
+        sprite_hot_fields_rebuild();
+        sprite_typed_spatial_index_rebuild();
         gGamePaused = stream->ReadValue<uint32_t>();
         _guestGenerationProbability = stream->ReadValue<uint32_t>();
         _suggestedGuestMaximum = stream->ReadValue<uint32_t>();
@@ -2755,10 +2978,26 @@ bool Network::LoadMap(IStream* stream)
     return result;
 }
 
+bool Network::SaveResyncBase()
+{
+    bool RLEState = gUseRLE;
+    gUseRLE = false;
+    MemoryStream ms;
+    bool saved = SaveMap(&ms, {});
+    gUseRLE = RLEState;
+    if (!saved)
+    {
+        _resyncBase = {};
+        return false;
+    }
+    auto data = (const uint8_t*)ms.GetData();
+    _resyncBase.assign(data, data + ms.GetLength());
+    return true;
+}
+
 bool Network::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const
 {
     bool result = false;
-    map_reorganise_elements();
     viewport_set_saved_view();
     try
     {
@@ -2956,6 +3195,12 @@ void Network::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connection,
             tickData.spriteHash = text;
         }
     }
+    if (flags & NETWORK_TICK_FLAG_INCREMENTAL_CHECKSUM)
+    {
+        uint64_t checksum;
+        packet >> checksum;
+        tickData.spriteChecksum = checksum;
+    }
 
     // Don't let the history grow too much.
     while (_serverTickData.size() >= 100)
@@ -3201,6 +3446,11 @@ bool network_is_desynchronised()
     return gNetwork.IsDesynchronised();
 }
 
+bool network_is_map_loaded()
+{
+    return gNetwork.IsMapLoaded();
+}
+
 bool network_check_desynchronisation()
 {
     return gNetwork.CheckDesynchronizaton();
@@ -3875,6 +4125,10 @@ bool network_is_desynchronised()
 {
     return false;
 }
+bool network_is_map_loaded()
+{
+    return false;
+}
 bool network_gamestate_snapshots_enabled()
 {
     return false;
@@ -26,11 +26,28 @@ NetworkConnection::NetworkConnection()
 
 NetworkConnection::~NetworkConnection()
 {
+    if (Channel != nullptr)
+    {
+        Channel->Release();
+    }
     delete[] _lastDisconnectReason;
 }
 
 int32_t NetworkConnection::ReadPacket()
 {
+    if (Channel != nullptr)
+    {
+        auto packet = Channel->ReceivePacket();
+        if (packet == nullptr)
+        {
+            return Channel->IsClosed() ? NETWORK_READPACKET_DISCONNECTED : NETWORK_READPACKET_NO_DATA;
+        }
+        InboundPacket = std::move(*packet);
+        _lastPacketTime = platform_get_ticks();
+        RecordPacketStats(InboundPacket, false);
+        return NETWORK_READPACKET_SUCCESS;
+    }
+
     if (InboundPacket.BytesTransferred < sizeof(InboundPacket.Size))
     {
         // read packet size
@@ -82,61 +99,111 @@ int32_t NetworkConnection::ReadPacket()
     return NETWORK_READPACKET_MORE_DATA;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front)
 {
-    uint16_t sizen = Convert::HostToNetwork(packet.Size);
-    std::vector<uint8_t> tosend;
-    tosend.reserve(sizeof(sizen) + packet.Size);
-    tosend.insert(tosend.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
-    tosend.insert(tosend.end(), packet.Data->begin(), packet.Data->end());
+    packet->Size = (uint16_t)packet->Data->size();
+    QueuePacket(std::shared_ptr<const NetworkPacket>(std::move(packet)), front);
+}
 
-    const void* buffer = &tosend[packet.BytesTransferred];
-    size_t bufferSize = tosend.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer, bufferSize);
-    if (sent > 0)
+void NetworkConnection::QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front)
+{
+    if (AuthStatus == NETWORK_AUTH_OK || !packet->CommandRequiresAuth())
     {
-        packet.BytesTransferred += sent;
+        if (_mapSnapshot != nullptr)
+        {
+            // The client expects the whole map before anything that was sent after it
+            _heldBackPackets.Push(std::move(packet), front);
+        }
+        else
+        {
+            _outboundPackets.Push(std::move(packet), front);
+        }
     }
+}
 
-    bool sendComplete = packet.BytesTransferred == tosend.size();
-    if (sendComplete)
+void NetworkConnection::SendQueuedPackets()
+{
+    if (_mapSnapshot != nullptr)
     {
-        RecordPacketStats(packet, true);
+        QueueMapSnapshotChunks();
     }
-    return sendComplete;
-}
 
-void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front)
-{
-    if (AuthStatus == NETWORK_AUTH_OK || !packet->CommandRequiresAuth())
+    if (Channel != nullptr)
     {
-        packet->Size = (uint16_t)packet->Data->size();
-        if (front)
+        if (!_outboundPackets.IsEmpty())
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front()->BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
+            while (!_outboundPackets.IsEmpty())
             {
-                _outboundPackets.push_front(std::move(packet));
+                auto packet = _outboundPackets.Pop();
+                RecordPacketStats(*packet, true);
+                Channel->SendPacket(std::move(packet));
             }
+            Channel->Flush();
         }
-        else
+        return;
+    }
+
+    _outboundPackets.Send(*Socket, [this](const NetworkPacket& packet) { RecordPacketStats(packet, true); });
+}
+
+void NetworkConnection::SendMapSnapshot(std::shared_ptr<NetworkMapSnapshot> snapshot)
+{
+    if (_mapSnapshot != nullptr)
+    {
+        // A new map replaces the one still being sent, the client starts over once it receives the first chunk
+        EndMapSnapshot();
+    }
+    _mapSnapshot = std::move(snapshot);
+    _mapSnapshotChunks = 0;
+}
+
+void NetworkConnection::QueueMapSnapshotChunks()
+{
+    bool complete;
+    auto chunks = _mapSnapshot->GetChunks(_mapSnapshotChunks, complete);
+    _mapSnapshotChunks += chunks.size();
+    for (auto& chunk : chunks)
+    {
+        _outboundPackets.Push(std::move(chunk));
+    }
+
+    if (complete)
+    {
+        if (_mapSnapshot->HasFailed())
         {
-            _outboundPackets.push_back(std::move(packet));
+            SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            IsDisconnected = true;
         }
+        EndMapSnapshot();
     }
 }
 
-void NetworkConnection::SendQueuedPackets()
+void NetworkConnection::EndMapSnapshot()
+{
+    _mapSnapshot = nullptr;
+    while (!_heldBackPackets.IsEmpty())
+    {
+        _outboundPackets.Push(_heldBackPackets.Pop());
+    }
+}
+
+void NetworkConnection::Disconnect()
 {
-    while (!_outboundPackets.empty() && SendPacket(*_outboundPackets.front()))
+    if (_mapSnapshot != nullptr)
+    {
+        // Do not wait for the rest of the map, the packets held back may explain the disconnect
+        EndMapSnapshot();
+    }
+
+    if (Channel != nullptr)
+    {
+        // Send what has been queued so far first, e.g. the reason for the disconnect
+        SendQueuedPackets();
+        Channel->Disconnect();
+    }
+    else
     {
-        _outboundPackets.remove(_outboundPackets.front());
+        Socket->Disconnect();
     }
 }
 
@@ -186,7 +253,7 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
 
 void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
 {
-    uint32_t packetSize = (uint32_t)packet.BytesTransferred;
+    uint32_t packetSize = (uint32_t)(sizeof(packet.Size) + packet.Size);
     uint32_t trafficGroup = NETWORK_STATISTICS_GROUP_BASE;
 
     switch (packet.GetCommand())
@@ -11,12 +11,14 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "NetworkIOThread.h"
 #    include "NetworkKey.h"
+#    include "NetworkMapSnapshot.h"
 #    include "NetworkPacket.h"
+#    include "NetworkPacketQueue.h"
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
-#    include <list>
 #    include <memory>
 #    include <vector>
 
@@ -27,6 +29,8 @@ class NetworkConnection final
 {
 public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
+    // Used instead of Socket by connections whose socket is owned by the network I/O thread
+    std::shared_ptr<NetworkIOChannel> Channel;
     NetworkPacket InboundPacket;
     NETWORK_AUTH AuthStatus = NETWORK_AUTH_NONE;
     NetworkStats_t Stats = {};
@@ -35,6 +39,9 @@ public:
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
+    // Block hashes of the park the client already has, the map is sent as a resync against them when set
+    std::vector<uint64_t> ResyncHashes;
+    uint32_t ResyncId = 0;
     bool IsDisconnected = false;
 
     NetworkConnection();
@@ -42,7 +49,12 @@ public:
 
     int32_t ReadPacket();
     void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
+    // Queues a packet whose Size has been set, it may be queued by other connections as well
+    void QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front = false);
     void SendQueuedPackets();
+    // Streams the MAP packets of the snapshot as they are produced, packets queued meanwhile are held back
+    void SendMapSnapshot(std::shared_ptr<NetworkMapSnapshot> snapshot);
+    void Disconnect();
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -51,12 +63,16 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::list<std::unique_ptr<NetworkPacket>> _outboundPackets;
+    NetworkPacketQueue _outboundPackets;
+    std::shared_ptr<NetworkMapSnapshot> _mapSnapshot;
+    size_t _mapSnapshotChunks = 0;
+    NetworkPacketQueue _heldBackPackets;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void QueueMapSnapshotChunks();
+    void EndMapSnapshot();
 };
 
 #endif // DISABLE_NETWORK
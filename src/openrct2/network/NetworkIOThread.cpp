@@ -0,0 +1,276 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkIOThread.h"
+
+#    include "../Diagnostic.h"
+
+#    include <algorithm>
+#    include <cstring>
+
+// Packets are received in blocks of this size
+constexpr size_t NETWORK_IO_BUFFER_SIZE = 64 * 1024;
+
+// Nothing needs to happen on a timer, the poller is woken whenever the game thread queues something
+constexpr int32_t NETWORK_IO_POLL_TIMEOUT_MS = 1000;
+
+#    pragma region NetworkIOChannel
+
+NetworkIOChannel::NetworkIOChannel(std::shared_ptr<ISocketPoller> poller, std::string hostName)
+    : _poller(std::move(poller))
+    , _hostName(std::move(hostName))
+{
+}
+
+std::unique_ptr<NetworkPacket> NetworkIOChannel::ReceivePacket()
+{
+    std::unique_ptr<NetworkPacket> packet;
+    _inbound.TryPop(packet);
+    return packet;
+}
+
+bool NetworkIOChannel::IsClosed() const
+{
+    // The I/O thread queues all packets before marking the channel as closed
+    return _closed.load(std::memory_order_acquire) && _inbound.IsEmpty();
+}
+
+void NetworkIOChannel::SendPacket(std::shared_ptr<const NetworkPacket> packet)
+{
+    _outbound.Push(std::move(packet));
+}
+
+void NetworkIOChannel::Flush()
+{
+    _poller->Wake();
+}
+
+void NetworkIOChannel::Disconnect()
+{
+    _outbound.Push(nullptr);
+    _poller->Wake();
+}
+
+void NetworkIOChannel::Release()
+{
+    _released.store(true, std::memory_order_release);
+    _poller->Wake();
+}
+
+#    pragma endregion
+
+#    pragma region NetworkIOThread
+
+NetworkIOThread::NetworkIOThread(std::unique_ptr<ITcpSocket> listenSocket)
+    : _poller(CreateSocketPoller())
+    , _listenSocket(std::move(listenSocket))
+    , _receiveBuffer(NETWORK_IO_BUFFER_SIZE)
+{
+    _poller->Add(*_listenSocket, nullptr);
+    _thread = std::thread([this]() { Run(); });
+}
+
+NetworkIOThread::~NetworkIOThread()
+{
+    _shouldStop.store(true, std::memory_order_release);
+    _poller->Wake();
+    _thread.join();
+}
+
+std::shared_ptr<NetworkIOChannel> NetworkIOThread::AcceptChannel()
+{
+    std::shared_ptr<NetworkIOChannel> channel;
+    _accepted.TryPop(channel);
+    return channel;
+}
+
+void NetworkIOThread::Run()
+{
+    std::vector<SocketPollEvent> events;
+    while (!_shouldStop.load(std::memory_order_acquire))
+    {
+        _poller->Wait(events, NETWORK_IO_POLL_TIMEOUT_MS);
+        for (const auto& ev : events)
+        {
+            if (ev.UserData == nullptr)
+            {
+                AcceptClients();
+                continue;
+            }
+
+            auto& connection = *static_cast<Connection*>(ev.UserData);
+            if (ev.Readable && connection.Socket != nullptr)
+            {
+                ReceivePackets(connection);
+            }
+            if (ev.Writable && connection.Socket != nullptr)
+            {
+                SendPackets(connection);
+            }
+        }
+
+        // Queued packets, disconnects and released channels are only signalled by waking the poller
+        for (auto it = _connections.begin(); it != _connections.end();)
+        {
+            auto& connection = **it;
+            if (connection.Channel->_released.load(std::memory_order_acquire))
+            {
+                CloseConnection(connection);
+                it = _connections.erase(it);
+                continue;
+            }
+            if (connection.Socket != nullptr && !connection.WantWrite)
+            {
+                SendPackets(connection);
+            }
+            it++;
+        }
+    }
+
+    for (auto& connection : _connections)
+    {
+        CloseConnection(*connection);
+    }
+    _connections.clear();
+}
+
+void NetworkIOThread::AcceptClients()
+{
+    std::unique_ptr<ITcpSocket> socket;
+    while ((socket = _listenSocket->Accept()) != nullptr)
+    {
+        auto hostName = socket->GetHostName();
+        auto connection = std::make_unique<Connection>();
+        connection->Channel = std::make_shared<NetworkIOChannel>(_poller, hostName == nullptr ? "" : hostName);
+        connection->Socket = std::move(socket);
+        connection->InboundPacket = NetworkPacket::Allocate();
+        try
+        {
+            _poller->Add(*connection->Socket, connection.get());
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Failed to accept client: %s", e.what());
+            continue;
+        }
+        _accepted.Push(connection->Channel);
+        _connections.push_back(std::move(connection));
+    }
+}
+
+void NetworkIOThread::ReceivePackets(Connection& connection)
+{
+    size_t received;
+    do
+    {
+        auto status = connection.Socket->ReceiveData(_receiveBuffer.data(), _receiveBuffer.size(), &received);
+        if (status == NETWORK_READPACKET_NO_DATA)
+        {
+            return;
+        }
+        if (status != NETWORK_READPACKET_SUCCESS)
+        {
+            CloseConnection(connection);
+            return;
+        }
+
+        // Split the data into packets, each is prefixed with its size
+        const uint8_t* data = _receiveBuffer.data();
+        size_t remaining = received;
+        while (remaining > 0)
+        {
+            auto& packet = *connection.InboundPacket;
+            size_t length;
+            if (packet.BytesTransferred < sizeof(packet.Size))
+            {
+                length = std::min(remaining, sizeof(packet.Size) - packet.BytesTransferred);
+                std::memcpy((uint8_t*)&packet.Size + packet.BytesTransferred, data, length);
+                packet.BytesTransferred += length;
+                if (packet.BytesTransferred == sizeof(packet.Size))
+                {
+                    packet.Size = Convert::NetworkToHost(packet.Size);
+                    if (packet.Size == 0) // Can't have a size 0 packet
+                    {
+                        CloseConnection(connection);
+                        return;
+                    }
+                    packet.Data->resize(packet.Size);
+                }
+            }
+            else
+            {
+                size_t offset = packet.BytesTransferred - sizeof(packet.Size);
+                length = std::min(remaining, packet.Size - offset);
+                std::memcpy(packet.GetData() + offset, data, length);
+                packet.BytesTransferred += length;
+                if (offset + length == packet.Size)
+                {
+                    connection.Channel->_inbound.Push(std::move(connection.InboundPacket));
+                    connection.InboundPacket = NetworkPacket::Allocate();
+                }
+            }
+            data += length;
+            remaining -= length;
+        }
+
+        // Only keep reading while the buffer is filled, so one busy client can not starve the others
+    } while (received == _receiveBuffer.size());
+}
+
+void NetworkIOThread::SendPackets(Connection& connection)
+{
+    std::shared_ptr<const NetworkPacket> packet;
+    while (!connection.DisconnectRequested && connection.Channel->_outbound.TryPop(packet))
+    {
+        if (packet == nullptr)
+        {
+            connection.DisconnectRequested = true;
+            break;
+        }
+        connection.OutboundPackets.Push(std::move(packet));
+    }
+
+    // Everything queued goes out in as few vectored writes as possible
+    if (connection.OutboundPackets.Send(*connection.Socket))
+    {
+        if (connection.DisconnectRequested)
+        {
+            connection.Socket->Disconnect();
+            CloseConnection(connection);
+        }
+        else if (connection.WantWrite)
+        {
+            _poller->SetWriteInterest(*connection.Socket, &connection, false);
+            connection.WantWrite = false;
+        }
+    }
+    else if (!connection.WantWrite)
+    {
+        // The socket buffer is full, continue once it is writable again
+        _poller->SetWriteInterest(*connection.Socket, &connection, true);
+        connection.WantWrite = true;
+    }
+}
+
+void NetworkIOThread::CloseConnection(Connection& connection)
+{
+    if (connection.Socket != nullptr)
+    {
+        _poller->Remove(*connection.Socket);
+        connection.Socket->Close();
+        connection.Socket = nullptr;
+    }
+    connection.Channel->_closed.store(true, std::memory_order_release);
+}
+
+#    pragma endregion
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,127 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+#    include "../core/SpscQueue.h"
+#    include "NetworkPacket.h"
+#    include "NetworkPacketQueue.h"
+#    include "Socket.h"
+
+#    include <atomic>
+#    include <memory>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+/**
+ * The game thread's end of a connection whose socket is owned by the network I/O thread. Packets are
+ * exchanged through lock-free queues, so none of these calls touch the socket or block.
+ */
+class NetworkIOChannel final
+{
+    friend class NetworkIOThread;
+
+private:
+    std::shared_ptr<ISocketPoller> _poller;
+    std::string _hostName;
+
+    // Complete packets received by the I/O thread
+    OpenRCT2::SpscQueue<std::unique_ptr<NetworkPacket>> _inbound;
+    // Packets to send, nullptr requests a disconnect once everything before it has been sent
+    OpenRCT2::SpscQueue<std::shared_ptr<const NetworkPacket>> _outbound;
+
+    // Set by the I/O thread after the last inbound packet has been queued
+    std::atomic_bool _closed = { false };
+    // Set by the game thread when it no longer uses the channel
+    std::atomic_bool _released = { false };
+
+public:
+    NetworkIOChannel(std::shared_ptr<ISocketPoller> poller, std::string hostName);
+
+    const std::string& GetHostName() const
+    {
+        return _hostName;
+    }
+
+    /**
+     * Returns the next received packet or nullptr if there is none yet.
+     */
+    std::unique_ptr<NetworkPacket> ReceivePacket();
+
+    /**
+     * Whether the connection was closed and every packet received before that has been taken.
+     */
+    bool IsClosed() const;
+
+    /**
+     * Queues a packet whose Size has been set, it is sent after the next call to Flush. The packet must not be
+     * modified afterwards.
+     */
+    void SendPacket(std::shared_ptr<const NetworkPacket> packet);
+    void Flush();
+
+    /**
+     * Closes the connection after the packets queued so far have been sent.
+     */
+    void Disconnect();
+    void Release();
+};
+
+/**
+ * Thread that owns the listening socket and the sockets of all connected clients. It accepts clients,
+ * frames inbound data into packets and sends outbound packets without involving the game thread.
+ */
+class NetworkIOThread final
+{
+private:
+    struct Connection
+    {
+        std::shared_ptr<NetworkIOChannel> Channel;
+        std::unique_ptr<ITcpSocket> Socket;
+        std::unique_ptr<NetworkPacket> InboundPacket;
+        NetworkPacketQueue OutboundPackets;
+        bool WantWrite = false;
+        bool DisconnectRequested = false;
+    };
+
+    std::shared_ptr<ISocketPoller> _poller;
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::vector<std::unique_ptr<Connection>> _connections;
+    OpenRCT2::SpscQueue<std::shared_ptr<NetworkIOChannel>> _accepted;
+    std::vector<uint8_t> _receiveBuffer;
+    std::atomic_bool _shouldStop = { false };
+    std::thread _thread;
+
+public:
+    /**
+     * Takes over a socket that is already listening and starts the thread.
+     */
+    explicit NetworkIOThread(std::unique_ptr<ITcpSocket> listenSocket);
+    ~NetworkIOThread();
+
+    NetworkIOThread(const NetworkIOThread&) = delete;
+    NetworkIOThread& operator=(const NetworkIOThread&) = delete;
+
+    /**
+     * Returns the channel of the next newly connected client or nullptr if there is none.
+     */
+    std::shared_ptr<NetworkIOChannel> AcceptChannel();
+
+private:
+    void Run();
+    void AcceptClients();
+    void ReceivePackets(Connection& connection);
+    void SendPackets(Connection& connection);
+    void CloseConnection(Connection& connection);
+};
+
+#endif // DISABLE_NETWORK
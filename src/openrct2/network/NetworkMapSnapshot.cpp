@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMapSnapshot.h"
+
+#    include "../Diagnostic.h"
+#    include "NetworkTypes.h"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <zlib.h>
+
+// Map data carried by each MAP packet
+constexpr size_t NETWORK_MAP_CHUNK_SIZE = 1024 * 63;
+// Input is compressed in blocks of this size so that cancelling does not have to wait for the whole park
+constexpr size_t NETWORK_MAP_COMPRESS_BLOCK_SIZE = 256 * 1024;
+
+// Prefix of compressed maps, including the null terminator
+constexpr char NETWORK_MAP_ZLIB_HEADER[] = "open2_sv6_zlib";
+
+NetworkMapSnapshot::NetworkMapSnapshot(
+    std::vector<const ObjectRepositoryItem*> objects, std::unique_ptr<MemoryStream> data)
+    : _objects(std::move(objects))
+    , _data(std::move(data))
+{
+    _thread = std::thread([this]() { Compress(); });
+}
+
+NetworkMapSnapshot::~NetworkMapSnapshot()
+{
+    _cancel.store(true, std::memory_order_relaxed);
+    _thread.join();
+}
+
+bool NetworkMapSnapshot::HasFailed() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _failed;
+}
+
+std::vector<std::shared_ptr<const NetworkPacket>> NetworkMapSnapshot::GetChunks(size_t first, bool& complete) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    complete = _complete;
+    if (first >= _chunks.size())
+    {
+        return {};
+    }
+    return std::vector<std::shared_ptr<const NetworkPacket>>(_chunks.begin() + first, _chunks.end());
+}
+
+void NetworkMapSnapshot::Compress()
+{
+    auto data = (const uint8_t*)_data->GetData();
+    size_t size = (size_t)_data->GetLength();
+
+    z_stream stream{};
+    if (deflateInit(&stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+    {
+        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
+        for (size_t offset = 0; offset < size; offset += NETWORK_MAP_CHUNK_SIZE)
+        {
+            AddChunk(&data[offset], std::min(NETWORK_MAP_CHUNK_SIZE, size - offset), (uint32_t)offset, (uint32_t)size);
+        }
+        Finish();
+        return;
+    }
+
+    // Chunks are added whenever the output buffer is full, only the last one knows the size of the whole map
+    std::vector<uint8_t> output(NETWORK_MAP_CHUNK_SIZE);
+    std::memcpy(output.data(), NETWORK_MAP_ZLIB_HEADER, sizeof(NETWORK_MAP_ZLIB_HEADER));
+    size_t outputLength = sizeof(NETWORK_MAP_ZLIB_HEADER);
+    size_t inputOffset = 0;
+    size_t chunkOffset = 0;
+    while (!_cancel.load(std::memory_order_relaxed))
+    {
+        if (stream.avail_in == 0 && inputOffset < size)
+        {
+            size_t blockSize = std::min(NETWORK_MAP_COMPRESS_BLOCK_SIZE, size - inputOffset);
+            stream.next_in = (Bytef*)&data[inputOffset];
+            stream.avail_in = (uInt)blockSize;
+            inputOffset += blockSize;
+        }
+        stream.next_out = &output[outputLength];
+        stream.avail_out = (uInt)(output.size() - outputLength);
+        int32_t result = deflate(&stream, inputOffset == size ? Z_FINISH : Z_NO_FLUSH);
+        outputLength = output.size() - stream.avail_out;
+
+        if (result == Z_STREAM_END)
+        {
+            uint32_t totalSize = (uint32_t)(chunkOffset + outputLength);
+            AddChunk(output.data(), outputLength, (uint32_t)chunkOffset, totalSize);
+            log_verbose("Sending map of size %u bytes, compressed to %u bytes", (uint32_t)size, totalSize);
+            break;
+        }
+        if (result != Z_OK && result != Z_BUF_ERROR)
+        {
+            log_error("Failed to compress map: %d", result);
+            std::lock_guard<std::mutex> lock(_mutex);
+            _failed = true;
+            break;
+        }
+        if (outputLength == output.size())
+        {
+            AddChunk(output.data(), outputLength, (uint32_t)chunkOffset, 0);
+            chunkOffset += outputLength;
+            outputLength = 0;
+        }
+    }
+    deflateEnd(&stream);
+    Finish();
+}
+
+void NetworkMapSnapshot::AddChunk(const uint8_t* data, size_t length, uint32_t offset, uint32_t totalSize)
+{
+    auto packet = NetworkPacket::Allocate();
+    *packet << (uint32_t)NETWORK_COMMAND_MAP << totalSize << offset;
+    packet->Write(data, length);
+    packet->Size = (uint16_t)packet->Data->size();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _chunks.push_back(std::move(packet));
+}
+
+void NetworkMapSnapshot::Finish()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _complete = true;
+}
+
+#endif // DISABLE_NETWORK
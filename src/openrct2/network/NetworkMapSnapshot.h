@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+#    include "../core/MemoryStream.h"
+#    include "NetworkPacket.h"
+
+#    include <atomic>
+#    include <memory>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+struct ObjectRepositoryItem;
+
+/**
+ * The park as sent to joining clients, serialised once on the game thread and compressed on a background thread.
+ * The MAP packets are shared by every client that joins during the same update with the same objects, and can be
+ * streamed out while the rest of the park is still being compressed.
+ */
+class NetworkMapSnapshot final
+{
+private:
+    std::vector<const ObjectRepositoryItem*> _objects;
+    std::unique_ptr<MemoryStream> _data;
+
+    mutable std::mutex _mutex;
+    std::vector<std::shared_ptr<const NetworkPacket>> _chunks;
+    bool _complete = false;
+    bool _failed = false;
+
+    std::atomic_bool _cancel = { false };
+    std::thread _thread;
+
+public:
+    /**
+     * Takes the serialised park and starts compressing it.
+     */
+    NetworkMapSnapshot(std::vector<const ObjectRepositoryItem*> objects, std::unique_ptr<MemoryStream> data);
+    ~NetworkMapSnapshot();
+
+    NetworkMapSnapshot(const NetworkMapSnapshot&) = delete;
+    NetworkMapSnapshot& operator=(const NetworkMapSnapshot&) = delete;
+
+    const std::vector<const ObjectRepositoryItem*>& GetObjects() const
+    {
+        return _objects;
+    }
+
+    /**
+     * Whether compression failed, the map can not be sent completely in that case.
+     */
+    bool HasFailed() const;
+
+    /**
+     * Returns the MAP packets from the given index onwards that have been produced so far. Complete is set once
+     * the returned packets include the last one.
+     */
+    std::vector<std::shared_ptr<const NetworkPacket>> GetChunks(size_t first, bool& complete) const;
+
+private:
+    void Compress();
+    void AddChunk(const uint8_t* data, size_t length, uint32_t offset, uint32_t totalSize);
+    void Finish();
+};
+
+#endif // DISABLE_NETWORK
@@ -14,15 +14,72 @@
 #    include "NetworkTypes.h"
 
 #    include <memory>
+#    include <mutex>
+
+// New buffers can hold most packets without growing
+constexpr size_t NETWORK_PACKET_INITIAL_CAPACITY = 256;
+// Larger buffers, e.g. of map chunks, are not worth keeping around
+constexpr size_t NETWORK_PACKET_POOL_MAX_CAPACITY = 16 * 1024;
+constexpr size_t NETWORK_PACKET_POOL_MAX_BUFFERS = 1024;
+
+/**
+ * Buffers of released packets. Packets are released on the network I/O thread as well, so access is locked.
+ */
+class NetworkPacketBufferPool final
+{
+private:
+    std::mutex _mutex;
+    std::vector<std::vector<uint8_t>*> _buffers;
+
+public:
+    std::vector<uint8_t>* Acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_buffers.empty())
+            {
+                auto buffer = _buffers.back();
+                _buffers.pop_back();
+                return buffer;
+            }
+        }
+        auto buffer = new std::vector<uint8_t>();
+        buffer->reserve(NETWORK_PACKET_INITIAL_CAPACITY);
+        return buffer;
+    }
+
+    void Release(std::vector<uint8_t>* buffer)
+    {
+        if (buffer->capacity() <= NETWORK_PACKET_POOL_MAX_CAPACITY)
+        {
+            buffer->clear();
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_buffers.size() < NETWORK_PACKET_POOL_MAX_BUFFERS)
+            {
+                _buffers.push_back(buffer);
+                return;
+            }
+        }
+        delete buffer;
+    }
+};
+
+static NetworkPacketBufferPool& GetBufferPool()
+{
+    // Never destroyed, packets of global objects may still be released during static destruction
+    static auto pool = new NetworkPacketBufferPool();
+    return *pool;
+}
 
 std::unique_ptr<NetworkPacket> NetworkPacket::Allocate()
 {
     return std::make_unique<NetworkPacket>();
 }
 
-std::unique_ptr<NetworkPacket> NetworkPacket::Duplicate(NetworkPacket& packet)
+std::shared_ptr<std::vector<uint8_t>> NetworkPacket::AllocateData()
 {
-    return std::make_unique<NetworkPacket>(packet);
+    return std::shared_ptr<std::vector<uint8_t>>(
+        GetBufferPool().Acquire(), [](std::vector<uint8_t>* buffer) { GetBufferPool().Release(buffer); });
 }
 
 uint8_t* NetworkPacket::GetData()
@@ -49,7 +106,7 @@ void NetworkPacket::Clear()
     Data->clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
     switch (GetCommand())
     {
@@ -20,18 +20,18 @@ class NetworkPacket final
 {
 public:
     uint16_t Size = 0;
-    std::shared_ptr<std::vector<uint8_t>> Data = std::make_shared<std::vector<uint8_t>>();
+    // Taken from a pool of recycled buffers, so writing a packet rarely has to grow the vector
+    std::shared_ptr<std::vector<uint8_t>> Data = AllocateData();
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
 
     static std::unique_ptr<NetworkPacket> Allocate();
-    static std::unique_ptr<NetworkPacket> Duplicate(NetworkPacket& packet);
 
     uint8_t* GetData();
     int32_t GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
 
     const uint8_t* Read(size_t size);
     const utf8* ReadString();
@@ -68,4 +68,7 @@ public:
         Write((const uint8_t*)data.GetStream().GetData(), data.GetStream().GetLength());
         return *this;
     }
+
+private:
+    static std::shared_ptr<std::vector<uint8_t>> AllocateData();
 };
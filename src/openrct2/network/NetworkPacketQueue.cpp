@@ -0,0 +1,109 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkPacketQueue.h"
+
+#    include "../core/Guard.hpp"
+
+#    include <iterator>
+
+// Number of packets gathered for one vectored write, each contributes its size prefix and its payload
+constexpr size_t NETWORK_PACKET_QUEUE_MAX_GATHER = 128;
+
+void NetworkPacketQueue::Push(std::shared_ptr<const NetworkPacket> packet, bool front)
+{
+    auto it = _entries.end();
+    if (front)
+    {
+        it = _entries.begin();
+        if (_frontBytesSent > 0)
+        {
+            it++;
+        }
+    }
+    uint16_t sizen = Convert::HostToNetwork(packet->Size);
+    _entries.insert(it, { std::move(packet), sizen });
+}
+
+std::shared_ptr<const NetworkPacket> NetworkPacketQueue::Pop()
+{
+    Guard::Assert(_frontBytesSent == 0, "Can not pop a packet that has been partially sent");
+    auto packet = std::move(_entries.front().Packet);
+    _entries.pop_front();
+    return packet;
+}
+
+bool NetworkPacketQueue::Send(ITcpSocket& socket, const std::function<void(const NetworkPacket&)>& onPacketSent)
+{
+    SocketBuffer buffers[NETWORK_PACKET_QUEUE_MAX_GATHER * 2];
+    while (!_entries.empty())
+    {
+        size_t count = 0;
+        size_t totalLength = 0;
+        size_t skip = _frontBytesSent;
+        for (auto it = _entries.begin(); it != _entries.end() && count + 2 <= std::size(buffers); it++)
+        {
+            const SocketBuffer packetBuffers[] = {
+                { &it->SizeNetworkOrder, sizeof(it->SizeNetworkOrder) },
+                { it->Packet->Data->data(), it->Packet->Size },
+            };
+            for (auto buffer : packetBuffers)
+            {
+                if (skip >= buffer.Length)
+                {
+                    skip -= buffer.Length;
+                    continue;
+                }
+                buffer.Data = (const uint8_t*)buffer.Data + skip;
+                buffer.Length -= skip;
+                skip = 0;
+                buffers[count++] = buffer;
+                totalLength += buffer.Length;
+            }
+        }
+
+        size_t sent = socket.SendData(buffers, count);
+
+        // Remove the packets that have been sent completely
+        size_t remaining = _frontBytesSent + sent;
+        while (!_entries.empty())
+        {
+            const auto& packet = *_entries.front().Packet;
+            size_t length = sizeof(packet.Size) + packet.Size;
+            if (remaining < length)
+            {
+                break;
+            }
+            remaining -= length;
+            if (onPacketSent)
+            {
+                onPacketSent(packet);
+            }
+            _entries.pop_front();
+        }
+        _frontBytesSent = remaining;
+
+        if (sent < totalLength)
+        {
+            // The socket buffer is full
+            return false;
+        }
+    }
+    return true;
+}
+
+void NetworkPacketQueue::Clear()
+{
+    _entries.clear();
+    _frontBytesSent = 0;
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,70 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+#    include "NetworkPacket.h"
+#    include "Socket.h"
+
+#    include <deque>
+#    include <functional>
+#    include <memory>
+
+/**
+ * Packets waiting to be sent over a socket. Packets are immutable once queued, so a packet broadcast to
+ * all clients is shared by their queues instead of being copied. Sending gathers the size prefixes and
+ * payloads of the queued packets into a single vectored write.
+ */
+class NetworkPacketQueue final
+{
+private:
+    struct Entry
+    {
+        std::shared_ptr<const NetworkPacket> Packet;
+        uint16_t SizeNetworkOrder;
+    };
+
+    std::deque<Entry> _entries;
+    // Bytes of the first packet, including its size prefix, that have already been sent
+    size_t _frontBytesSent = 0;
+
+public:
+    bool IsEmpty() const
+    {
+        return _entries.empty();
+    }
+
+    size_t GetCount() const
+    {
+        return _entries.size();
+    }
+
+    /**
+     * Queues a packet whose Size has been set. A packet pushed to the front is placed after the first packet
+     * if that has already been partially sent.
+     */
+    void Push(std::shared_ptr<const NetworkPacket> packet, bool front = false);
+
+    /**
+     * Takes the first packet off the queue, only valid while nothing has been sent.
+     */
+    std::shared_ptr<const NetworkPacket> Pop();
+
+    /**
+     * Sends as many queued packets as the socket accepts and calls onPacketSent for every packet that has been
+     * sent completely. Returns true if the queue has been emptied.
+     */
+    bool Send(ITcpSocket& socket, const std::function<void(const NetworkPacket&)>& onPacketSent = nullptr);
+
+    void Clear();
+};
+
+#endif // DISABLE_NETWORK
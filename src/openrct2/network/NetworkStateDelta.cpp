@@ -0,0 +1,174 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkStateDelta.h"
+
+#    include <algorithm>
+#    include <cstring>
+
+namespace NetworkStateDelta
+{
+    static size_t GetBlockCount(size_t length)
+    {
+        return (length + BlockSize - 1) / BlockSize;
+    }
+
+    static size_t GetBlockLength(size_t length, size_t index)
+    {
+        return std::min<size_t>(BlockSize, length - index * BlockSize);
+    }
+
+    /**
+     * Hashes the block as little endian words so both ends agree. The length is part of the hash, a block that was
+     * the shorter last block of the base is always sent when the state has grown.
+     */
+    static uint64_t HashBlock(const uint8_t* data, size_t length)
+    {
+        uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (length * 0xC2B2AE3D27D4EB4FULL);
+        for (size_t i = 0; i < length; i += sizeof(uint64_t))
+        {
+            uint64_t word = 0;
+            size_t wordLength = std::min(sizeof(uint64_t), length - i);
+            for (size_t j = 0; j < wordLength; j++)
+            {
+                word |= (uint64_t)data[i + j] << (j * 8);
+            }
+            hash ^= word * 0x87C37B91114253D5ULL;
+            hash = (hash << 31) | (hash >> 33);
+            hash *= 0x4CF5AD432745937FULL;
+        }
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    static void WriteUInt32(std::vector<uint8_t>& buffer, uint32_t value)
+    {
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            buffer.push_back((uint8_t)(value >> (i * 8)));
+        }
+    }
+
+    static bool ReadUInt32(const uint8_t*& src, const uint8_t* end, uint32_t& value)
+    {
+        if ((size_t)(end - src) < sizeof(value))
+        {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            value |= (uint32_t)src[i] << (i * 8);
+        }
+        src += sizeof(value);
+        return true;
+    }
+
+    std::vector<uint64_t> HashBlocks(const void* data, size_t length)
+    {
+        auto bytes = (const uint8_t*)data;
+        std::vector<uint64_t> hashes(GetBlockCount(length));
+        for (size_t i = 0; i < hashes.size(); i++)
+        {
+            hashes[i] = HashBlock(&bytes[i * BlockSize], GetBlockLength(length, i));
+        }
+        return hashes;
+    }
+
+    std::vector<uint8_t> Create(const void* data, size_t length, const std::vector<uint64_t>& baseHashes)
+    {
+        auto bytes = (const uint8_t*)data;
+        auto hashes = HashBlocks(data, length);
+        std::vector<uint32_t> changedBlocks;
+        for (size_t i = 0; i < hashes.size(); i++)
+        {
+            if (i >= baseHashes.size() || hashes[i] != baseHashes[i])
+            {
+                changedBlocks.push_back((uint32_t)i);
+            }
+        }
+
+        std::vector<uint8_t> delta;
+        delta.reserve(2 * sizeof(uint32_t) + changedBlocks.size() * (sizeof(uint32_t) + BlockSize));
+        WriteUInt32(delta, (uint32_t)length);
+        WriteUInt32(delta, (uint32_t)changedBlocks.size());
+        for (auto index : changedBlocks)
+        {
+            WriteUInt32(delta, index);
+            auto block = &bytes[(size_t)index * BlockSize];
+            delta.insert(delta.end(), block, block + GetBlockLength(length, index));
+        }
+        return delta;
+    }
+
+    bool Apply(std::vector<uint8_t>& base, const void* delta, size_t deltaLength)
+    {
+        auto src = (const uint8_t*)delta;
+        auto end = src + deltaLength;
+        uint32_t length, count;
+        if (!ReadUInt32(src, end, length) || !ReadUInt32(src, end, count))
+        {
+            return false;
+        }
+
+        // Check the whole delta before touching the base
+        size_t blockCount = GetBlockCount(length);
+        size_t baseBlockCount = GetBlockCount(base.size());
+        if (count > blockCount)
+        {
+            return false;
+        }
+        // Blocks the base does not have in full must all be part of the delta
+        size_t firstRequiredBlock = base.size() / BlockSize;
+        if (length == base.size())
+        {
+            firstRequiredBlock = baseBlockCount;
+        }
+        std::vector<std::pair<uint32_t, const uint8_t*>> blocks;
+        blocks.reserve(count);
+        size_t requiredBlocks = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t index;
+            if (!ReadUInt32(src, end, index) || index >= blockCount
+                || (!blocks.empty() && index <= blocks.back().first))
+            {
+                return false;
+            }
+            size_t blockLength = GetBlockLength(length, index);
+            if ((size_t)(end - src) < blockLength)
+            {
+                return false;
+            }
+            blocks.emplace_back(index, src);
+            src += blockLength;
+            if (index >= firstRequiredBlock)
+            {
+                requiredBlocks++;
+            }
+        }
+        if (src != end || requiredBlocks != blockCount - std::min(blockCount, firstRequiredBlock))
+        {
+            return false;
+        }
+
+        base.resize(length);
+        for (const auto& block : blocks)
+        {
+            std::memcpy(&base[(size_t)block.first * BlockSize], block.second, GetBlockLength(length, block.first));
+        }
+        return true;
+    }
+} // namespace NetworkStateDelta
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+
+#    include <vector>
+
+/**
+ * Block-wise differences between two serialised game states. The park is saved without RLE when it is sent over the
+ * network, so tile elements, sprites, rides and park parameters always sit at the same offsets and a desync only
+ * changes the few blocks that hold the diverged data.
+ */
+namespace NetworkStateDelta
+{
+    constexpr uint32_t BlockSize = 4096;
+
+    /**
+     * Returns a 64-bit hash for every block of the state, the last block may be shorter than BlockSize.
+     */
+    std::vector<uint64_t> HashBlocks(const void* data, size_t length);
+
+    /**
+     * Returns the blocks of the state whose hashes differ from the hashes of the base state, together with the length
+     * of the state.
+     */
+    std::vector<uint8_t> Create(const void* data, size_t length, const std::vector<uint64_t>& baseHashes);
+
+    /**
+     * Turns the base state into the state the delta was created from. Returns false and leaves the base untouched if
+     * the delta is malformed or does not fit the base.
+     */
+    bool Apply(std::vector<uint8_t>& base, const void* delta, size_t deltaLength);
+} // namespace NetworkStateDelta
+
+#endif // DISABLE_NETWORK
@@ -67,6 +67,8 @@ enum NETWORK_COMMAND
     NETWORK_COMMAND_PLAYERINFO,
     NETWORK_COMMAND_REQUEST_GAMESTATE,
     NETWORK_COMMAND_GAMESTATE,
+    NETWORK_COMMAND_REQUEST_RESYNC,
+    NETWORK_COMMAND_RESYNC,
     NETWORK_COMMAND_MAX,
     NETWORK_COMMAND_INVALID = -1
 };
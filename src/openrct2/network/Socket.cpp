@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -16,6 +17,7 @@
 #    include <future>
 #    include <string>
 #    include <thread>
+#    include <vector>
 
 // clang-format off
 // MSVC: include <math.h> here otherwise PI gets defined twice
@@ -46,6 +48,14 @@
     #include <netinet/tcp.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+    #if defined(__linux__)
+        #include <sys/epoll.h>
+        #include <sys/eventfd.h>
+    #else
+        #include <poll.h>
+    #endif // defined(__linux__)
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -65,6 +75,9 @@
 
 constexpr auto CONNECT_TIMEOUT = std::chrono::milliseconds(3000);
 
+// Vectored writes pass at most this many buffers per system call, well within IOV_MAX everywhere
+constexpr size_t SOCKET_MAX_SEND_BUFFERS = 64;
+
 #    ifdef _WIN32
 static bool _wsaInitialised = false;
 #    endif
@@ -488,6 +501,58 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SOCKET_STATUS_CONNECTED)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        size_t totalSent = 0;
+        for (size_t first = 0; first < count; first += SOCKET_MAX_SEND_BUFFERS)
+        {
+            size_t batchCount = std::min(count - first, SOCKET_MAX_SEND_BUFFERS);
+            size_t batchSize = 0;
+#    ifdef _WIN32
+            WSABUF batch[SOCKET_MAX_SEND_BUFFERS];
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                batch[i].buf = (CHAR*)buffers[first + i].Data;
+                batch[i].len = (ULONG)buffers[first + i].Length;
+                batchSize += buffers[first + i].Length;
+            }
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, batch, (DWORD)batchCount, &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    else
+            iovec batch[SOCKET_MAX_SEND_BUFFERS];
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                batch[i].iov_base = (void*)buffers[first + i].Data;
+                batch[i].iov_len = buffers[first + i].Length;
+                batchSize += buffers[first + i].Length;
+            }
+            msghdr message{};
+            message.msg_iov = batch;
+            message.msg_iovlen = batchCount;
+            ssize_t sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    endif
+            totalSent += sentBytes;
+            if ((size_t)sentBytes < batchSize)
+            {
+                // The socket buffer is full
+                return totalSent;
+            }
+        }
+        return totalSent;
+    }
+
     NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SOCKET_STATUS_CONNECTED)
@@ -546,6 +611,11 @@ public:
         return _hostName.empty() ? nullptr : _hostName.c_str();
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
 private:
     explicit TcpSocket(SOCKET socket, const std::string& hostName)
     {
@@ -565,6 +635,248 @@ private:
     }
 };
 
+#    if defined(__linux__)
+class SocketPoller final : public ISocketPoller
+{
+private:
+    int32_t _epoll = -1;
+    int32_t _wakeEvent = -1;
+    std::atomic_bool _wakePending = { false };
+    std::vector<epoll_event> _epollEvents = std::vector<epoll_event>(256);
+
+public:
+    SocketPoller()
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        _wakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = &_wakeEvent;
+        if (_epoll == -1 || _wakeEvent == -1 || epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeEvent, &ev) != 0)
+        {
+            CloseHandles();
+            throw SocketException("Unable to create socket poller.");
+        }
+    }
+
+    ~SocketPoller() override
+    {
+        CloseHandles();
+    }
+
+    void Add(ITcpSocket& socket, void* userData) override
+    {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.ptr = userData;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, GetSocket(socket), &ev) != 0)
+        {
+            throw SocketException("Unable to poll socket.");
+        }
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, GetSocket(socket), nullptr);
+    }
+
+    void SetWriteInterest(ITcpSocket& socket, void* userData, bool enabled) override
+    {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        if (enabled)
+        {
+            ev.events |= EPOLLOUT;
+        }
+        ev.data.ptr = userData;
+        epoll_ctl(_epoll, EPOLL_CTL_MOD, GetSocket(socket), &ev);
+    }
+
+    void Wait(std::vector<SocketPollEvent>& events, int32_t timeoutMs) override
+    {
+        events.clear();
+        int32_t count = epoll_wait(_epoll, _epollEvents.data(), (int32_t)_epollEvents.size(), timeoutMs);
+        for (int32_t i = 0; i < count; i++)
+        {
+            const auto& ev = _epollEvents[i];
+            if (ev.data.ptr == &_wakeEvent)
+            {
+                _wakePending.store(false, std::memory_order_release);
+                uint64_t value;
+                [[maybe_unused]] auto readBytes = read(_wakeEvent, &value, sizeof(value));
+            }
+            else
+            {
+                bool readable = (ev.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+                bool writable = (ev.events & EPOLLOUT) != 0;
+                events.push_back({ ev.data.ptr, readable, writable });
+            }
+        }
+    }
+
+    void Wake() override
+    {
+        if (!_wakePending.exchange(true, std::memory_order_acq_rel))
+        {
+            uint64_t value = 1;
+            [[maybe_unused]] auto writtenBytes = write(_wakeEvent, &value, sizeof(value));
+        }
+    }
+
+private:
+    static SOCKET GetSocket(ITcpSocket& socket)
+    {
+        return static_cast<TcpSocket&>(socket).GetSocket();
+    }
+
+    void CloseHandles()
+    {
+        if (_wakeEvent != -1)
+        {
+            close(_wakeEvent);
+            _wakeEvent = -1;
+        }
+        if (_epoll != -1)
+        {
+            close(_epoll);
+            _epoll = -1;
+        }
+    }
+};
+#    else
+/**
+ * Fallback for platforms without epoll. A UDP socket connected to itself lets other threads interrupt poll.
+ */
+class SocketPoller final : public ISocketPoller, protected Socket
+{
+private:
+#        ifdef _WIN32
+    using pollfd = WSAPOLLFD;
+#        endif
+
+    std::vector<pollfd> _fds;
+    std::vector<void*> _userData;
+    SOCKET _wakeSocket = INVALID_SOCKET;
+    std::atomic_bool _wakePending = { false };
+
+public:
+    SocketPoller()
+    {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLen = sizeof(address);
+
+        _wakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (_wakeSocket == INVALID_SOCKET || bind(_wakeSocket, (sockaddr*)&address, addressLen) != 0
+            || getsockname(_wakeSocket, (sockaddr*)&address, &addressLen) != 0
+            || connect(_wakeSocket, (sockaddr*)&address, addressLen) != 0 || !SetNonBlocking(_wakeSocket, true))
+        {
+            if (_wakeSocket != INVALID_SOCKET)
+            {
+                closesocket(_wakeSocket);
+            }
+            throw SocketException("Unable to create socket poller.");
+        }
+        _fds.push_back({ _wakeSocket, POLLIN, 0 });
+        _userData.push_back(nullptr);
+    }
+
+    ~SocketPoller() override
+    {
+        closesocket(_wakeSocket);
+    }
+
+    void Add(ITcpSocket& socket, void* userData) override
+    {
+        _fds.push_back({ GetSocket(socket), POLLIN, 0 });
+        _userData.push_back(userData);
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        auto index = IndexOf(socket);
+        if (index != 0)
+        {
+            _fds[index] = _fds.back();
+            _fds.pop_back();
+            _userData[index] = _userData.back();
+            _userData.pop_back();
+        }
+    }
+
+    void SetWriteInterest(ITcpSocket& socket, void* userData, bool enabled) override
+    {
+        auto index = IndexOf(socket);
+        if (index != 0)
+        {
+            _fds[index].events = enabled ? (POLLIN | POLLOUT) : POLLIN;
+            _userData[index] = userData;
+        }
+    }
+
+    void Wait(std::vector<SocketPollEvent>& events, int32_t timeoutMs) override
+    {
+        events.clear();
+#        ifdef _WIN32
+        int32_t count = WSAPoll(_fds.data(), (ULONG)_fds.size(), timeoutMs);
+#        else
+        int32_t count = poll(_fds.data(), (nfds_t)_fds.size(), timeoutMs);
+#        endif
+        if (count <= 0)
+        {
+            return;
+        }
+        if (_fds[0].revents != 0)
+        {
+            _wakePending.store(false, std::memory_order_release);
+            char buffer[64];
+            while (recv(_wakeSocket, buffer, sizeof(buffer), 0) > 0)
+            {
+            }
+        }
+        for (size_t i = 1; i < _fds.size(); i++)
+        {
+            auto revents = _fds[i].revents;
+            if (revents != 0)
+            {
+                bool readable = (revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+                bool writable = (revents & POLLOUT) != 0;
+                events.push_back({ _userData[i], readable, writable });
+            }
+        }
+    }
+
+    void Wake() override
+    {
+        if (!_wakePending.exchange(true, std::memory_order_acq_rel))
+        {
+            char value = 0;
+            send(_wakeSocket, &value, sizeof(value), 0);
+        }
+    }
+
+private:
+    static SOCKET GetSocket(ITcpSocket& socket)
+    {
+        return static_cast<TcpSocket&>(socket).GetSocket();
+    }
+
+    size_t IndexOf(ITcpSocket& socket) const
+    {
+        auto s = GetSocket(socket);
+        for (size_t i = 1; i < _fds.size(); i++)
+        {
+            if (_fds[i].fd == s)
+            {
+                return i;
+            }
+        }
+        return 0;
+    }
+};
+#    endif // defined(__linux__)
+
 class UdpSocket final : public IUdpSocket, protected Socket
 {
 private:
@@ -805,6 +1117,11 @@ std::unique_ptr<ITcpSocket> CreateTcpSocket()
     return std::make_unique<TcpSocket>();
 }
 
+std::unique_ptr<ISocketPoller> CreateSocketPoller()
+{
+    return std::make_unique<SocketPoller>();
+}
+
 std::unique_ptr<IUdpSocket> CreateUdpSocket()
 {
     return std::make_unique<UdpSocket>();
@@ -44,6 +44,15 @@ interface INetworkEndpoint
     virtual std::string GetHostname() const abstract;
 };
 
+/**
+ * A block of memory to send as part of a vectored write.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Length;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -64,6 +73,8 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    // Sends the buffers one after another with as few system calls as possible
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void Disconnect() abstract;
@@ -93,10 +104,39 @@ public:
     virtual void Close() abstract;
 };
 
+struct SocketPollEvent
+{
+    void* UserData;
+    bool Readable;
+    bool Writable;
+};
+
+/**
+ * Waits for many TCP sockets to become readable or writable, using epoll where available. Errors and
+ * hang-ups are reported as readable so that the next read reports the disconnection. Only Wake may be
+ * called from a thread other than the one that waits.
+ */
+interface ISocketPoller
+{
+public:
+    virtual ~ISocketPoller() = default;
+
+    virtual void Add(ITcpSocket & socket, void* userData) abstract;
+    virtual void Remove(ITcpSocket & socket) abstract;
+    virtual void SetWriteInterest(ITcpSocket & socket, void* userData, bool enabled) abstract;
+
+    /**
+     * Waits until a socket is ready, Wake is called or the timeout passes, events is replaced by what happened.
+     */
+    virtual void Wait(std::vector<SocketPollEvent> & events, int32_t timeoutMs) abstract;
+    virtual void Wake() abstract;
+};
+
 bool InitialiseWSA();
 void DisposeWSA();
 std::unique_ptr<ITcpSocket> CreateTcpSocket();
 std::unique_ptr<IUdpSocket> CreateUdpSocket();
+std::unique_ptr<ISocketPoller> CreateSocketPoller();
 std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
@@ -44,6 +44,7 @@ int32_t network_begin_server(int32_t port, const std::string& address);
 int32_t network_get_mode();
 int32_t network_get_status();
 bool network_is_desynchronised();
+bool network_is_map_loaded();
 bool network_check_desynchronisation();
 void network_request_gamestate_snapshot();
 void network_send_tick();
@@ -11,7 +11,9 @@
 
 #include "../OpenRCT2.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "Object.h"
+#include "ObjectCache.h"
 
 #include <algorithm>
 #include <memory>
@@ -19,7 +21,7 @@
 
 ImageTable::~ImageTable()
 {
-    if (_data == nullptr)
+    if (_data == nullptr && _dataLoader == nullptr && _cacheOwner == nullptr)
     {
         for (auto& entry : _entries)
         {
@@ -49,6 +51,14 @@ void ImageTable::Read(IReadObjectContext* context, IStream* stream)
         }
 
         auto dataSize = (size_t)imageDataSize;
+        auto dataPosition = stream->GetPosition() + headerTableSize;
+        auto dataLoader = context->GetDeferredData(dataPosition, dataSize);
+        if (dataLoader != nullptr)
+        {
+            ReadDeferred(context, stream, numImages, dataSize, std::move(dataLoader));
+            return;
+        }
+
         auto data = std::make_unique<uint8_t[]>(dataSize);
         if (data == nullptr)
         {
@@ -97,6 +107,41 @@ void ImageTable::Read(IReadObjectContext* context, IStream* stream)
     }
 }
 
+void ImageTable::ReadDeferred(
+    IReadObjectContext* context, IStream* stream, uint32_t numImages, size_t dataSize, ImageDataLoader dataLoader)
+{
+    // Read g1 element headers, keeping the offsets relative to the image data
+    std::vector<rct_g1_element> newEntries;
+    for (uint32_t i = 0; i < numImages; i++)
+    {
+        rct_g1_element g1Element;
+
+        uintptr_t imageDataOffset = (uintptr_t)stream->ReadValue<uint32_t>();
+        g1Element.offset = (uint8_t*)imageDataOffset;
+
+        g1Element.width = stream->ReadValue<int16_t>();
+        g1Element.height = stream->ReadValue<int16_t>();
+        g1Element.x_offset = stream->ReadValue<int16_t>();
+        g1Element.y_offset = stream->ReadValue<int16_t>();
+        g1Element.flags = stream->ReadValue<uint16_t>();
+        g1Element.zoomed_offset = stream->ReadValue<uint16_t>();
+
+        newEntries.push_back(g1Element);
+    }
+
+    // Skip the image data, it is read again when the images are first drawn
+    uint64_t remainingBytes = stream->GetLength() - stream->GetPosition();
+    if (remainingBytes < dataSize)
+    {
+        context->LogWarning(OBJECT_ERROR_BAD_IMAGE_TABLE, "Image table size shorter than expected.");
+        dataSize = (size_t)remainingBytes;
+    }
+    stream->Seek(dataSize, STREAM_SEEK_CURRENT);
+
+    _dataLoader = std::move(dataLoader);
+    _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+}
+
 void ImageTable::AddImage(const rct_g1_element* g1)
 {
     rct_g1_element newg1 = *g1;
@@ -112,3 +157,97 @@ void ImageTable::AddImage(const rct_g1_element* g1)
     }
     _entries.push_back(newg1);
 }
+
+void ImageTable::ReadCacheData(IReadObjectContext* context, const ObjectCacheData& data)
+{
+    try
+    {
+        auto stream = MemoryStream(data.Data, data.Length);
+        uint32_t numImages = stream.ReadValue<uint32_t>();
+        uint64_t dataSize = stream.ReadValue<uint64_t>();
+
+        uint64_t headerTableSize = numImages * 16ULL;
+        if (stream.GetLength() - stream.GetPosition() != headerTableSize + dataSize)
+        {
+            throw IOException("Cached image table has an unexpected size.");
+        }
+
+        // Entries point straight into the cache data
+        auto imageDataBase = data.Data + stream.GetPosition() + headerTableSize;
+        std::vector<rct_g1_element> newEntries;
+        newEntries.reserve(numImages);
+        for (uint32_t i = 0; i < numImages; i++)
+        {
+            rct_g1_element g1Element;
+
+            auto imageDataOffset = stream.ReadValue<uint32_t>();
+            g1Element.offset = imageDataOffset == UINT32_MAX ? nullptr : (uint8_t*)(imageDataBase + imageDataOffset);
+
+            g1Element.width = stream.ReadValue<int16_t>();
+            g1Element.height = stream.ReadValue<int16_t>();
+            g1Element.x_offset = stream.ReadValue<int16_t>();
+            g1Element.y_offset = stream.ReadValue<int16_t>();
+            g1Element.flags = stream.ReadValue<uint16_t>();
+            g1Element.zoomed_offset = stream.ReadValue<int16_t>();
+
+            newEntries.push_back(g1Element);
+        }
+
+        _cacheOwner = data.Owner;
+        _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+    }
+    catch (const std::exception&)
+    {
+        context->LogError(OBJECT_ERROR_BAD_IMAGE_TABLE, "Bad cached image table.");
+        throw;
+    }
+}
+
+std::vector<uint8_t> ImageTable::GetCacheData() const
+{
+    uint64_t dataSize = 0;
+    for (const auto& entry : _entries)
+    {
+        if (entry.offset != nullptr)
+        {
+            dataSize += g1_calculate_data_size(&entry);
+        }
+    }
+
+    auto stream = MemoryStream();
+    stream.WriteValue<uint32_t>(GetCount());
+    stream.WriteValue<uint64_t>(dataSize);
+
+    uint32_t imageDataOffset = 0;
+    for (const auto& entry : _entries)
+    {
+        auto length = entry.offset == nullptr ? 0 : g1_calculate_data_size(&entry);
+        stream.WriteValue<uint32_t>(entry.offset == nullptr ? UINT32_MAX : imageDataOffset);
+        stream.WriteValue<int16_t>(entry.width);
+        stream.WriteValue<int16_t>(entry.height);
+        stream.WriteValue<int16_t>(entry.x_offset);
+        stream.WriteValue<int16_t>(entry.y_offset);
+        stream.WriteValue<uint16_t>(entry.flags);
+        stream.WriteValue<int16_t>((int16_t)entry.zoomed_offset);
+        imageDataOffset += (uint32_t)length;
+    }
+    for (const auto& entry : _entries)
+    {
+        if (entry.offset != nullptr)
+        {
+            stream.Write(entry.offset, g1_calculate_data_size(&entry));
+        }
+    }
+
+    auto data = (const uint8_t*)stream.GetData();
+    return std::vector<uint8_t>(data, data + stream.GetLength());
+}
+
+uint32_t ImageTable::AllocateImages() const
+{
+    if (_dataLoader != nullptr)
+    {
+        return gfx_object_allocate_images_deferred(_entries.data(), GetCount(), _dataLoader);
+    }
+    return gfx_object_allocate_images(_entries.data(), GetCount());
+}
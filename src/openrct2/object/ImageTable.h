@@ -17,6 +17,7 @@
 
 interface IReadObjectContext;
 interface IStream;
+struct ObjectCacheData;
 
 class ImageTable
 {
@@ -24,6 +25,15 @@ private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
 
+    // Set when the image data is not kept in memory, the entry offsets are then relative to the data it returns
+    ImageDataLoader _dataLoader;
+
+    // Set when the image data points into the object cache, which is kept alive for as long as the table exists
+    std::shared_ptr<const void> _cacheOwner;
+
+    void ReadDeferred(
+        IReadObjectContext* context, IStream* stream, uint32_t numImages, size_t dataSize, ImageDataLoader dataLoader);
+
 public:
     ImageTable() = default;
     ImageTable(const ImageTable&) = delete;
@@ -40,4 +50,15 @@ public:
         return (uint32_t)_entries.size();
     }
     void AddImage(const rct_g1_element* g1);
+
+    /**
+     * Reads or writes the whole table in the format used by the object cache. Reading does not copy the image data.
+     */
+    void ReadCacheData(IReadObjectContext* context, const ObjectCacheData& data);
+    std::vector<uint8_t> GetCacheData() const;
+
+    /**
+     * Allocates the images in the global image list. Images with deferred data are paged in on their first use.
+     */
+    uint32_t AllocateImages() const;
 };
@@ -13,6 +13,7 @@
 #include "ImageTable.h"
 #include "StringTable.h"
 
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -138,6 +139,7 @@ assert_struct_size(rct_object_filters, 3);
 
 interface IObjectRepository;
 interface IStream;
+struct ObjectCacheData;
 struct ObjectRepositoryItem;
 struct rct_drawpixelinfo;
 struct json_t;
@@ -150,6 +152,28 @@ interface IReadObjectContext
     virtual bool ShouldLoadImages() abstract;
     virtual std::vector<uint8_t> GetData(const std::string_view& path) abstract;
 
+    /**
+     * Returns a loader that reads the given range of the object data again when needed, or nullptr if the range has to be
+     * read now.
+     */
+    virtual ImageDataLoader GetDeferredData(uint64_t position, size_t length) abstract;
+
+    /**
+     * Gets or sets the cached data for the file the object is read from, std::nullopt if there is none or it is stale.
+     */
+    virtual std::optional<ObjectCacheData> GetCachedData() abstract;
+    virtual void SetCachedData(std::vector<uint8_t> data) abstract;
+
+    /**
+     * Records a file outside of the object's own file that the cached data is built from.
+     */
+    virtual void AddCacheDependency(const std::string& path) abstract;
+
+    /**
+     * Marks the data as built without some of its sources, so it is not cached. The same applies when a warning is logged.
+     */
+    virtual void SetCacheIncomplete() abstract;
+
     virtual void LogWarning(uint32_t code, const utf8* text) abstract;
     virtual void LogError(uint32_t code, const utf8* text) abstract;
 };
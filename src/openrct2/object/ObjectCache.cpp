@@ -0,0 +1,273 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectCache.h"
+
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileStream.hpp"
+#include "../core/MappedFile.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+
+#include <algorithm>
+#include <zlib.h>
+
+struct ObjectCacheHeader
+{
+    uint32_t HeaderSize = sizeof(ObjectCacheHeader);
+    uint32_t MagicNumber = 0;
+    uint16_t Version = 0;
+    uint16_t Reserved = 0;
+    uint32_t NumEntries = 0;
+};
+
+static constexpr uint32_t OBJECT_CACHE_MAGIC_NUMBER = 0x4348434F; // OCHC
+
+// Cache file format version which when incremented discards the cache
+static constexpr uint16_t OBJECT_CACHE_VERSION = 2;
+
+// Entries not used in the current session are dropped when the cache grows larger than this
+static constexpr uint64_t OBJECT_CACHE_MAX_SIZE = 512 * 1024 * 1024;
+
+static uint32_t GetChecksum(const uint8_t* data, size_t length)
+{
+    return (uint32_t)crc32(0, data, (uInt)length);
+}
+
+ObjectCache::ObjectCache(std::string path)
+    : _path(path)
+{
+}
+
+void ObjectCache::Open()
+{
+    _opened = true;
+    if (!File::Exists(_path))
+    {
+        return;
+    }
+
+    try
+    {
+        log_verbose("ObjectCache:Loading cache: '%s'", _path.c_str());
+        auto mappedFile = std::make_shared<MappedFile>(_path);
+        auto data = (const uint8_t*)mappedFile->GetData();
+        auto stream = MemoryStream(data, mappedFile->GetLength());
+
+        auto header = stream.ReadValue<ObjectCacheHeader>();
+        if (header.HeaderSize != sizeof(ObjectCacheHeader) || header.MagicNumber != OBJECT_CACHE_MAGIC_NUMBER
+            || header.Version != OBJECT_CACHE_VERSION)
+        {
+            Console::WriteLine("Object cache out of date");
+            return;
+        }
+
+        for (uint32_t i = 0; i < header.NumEntries; i++)
+        {
+            auto sourcePath = stream.ReadStdString();
+            Entry entry;
+            entry.SourceSize = stream.ReadValue<uint64_t>();
+            entry.SourceLastModified = stream.ReadValue<uint64_t>();
+            auto numDependencies = stream.ReadValue<uint32_t>();
+            for (uint32_t j = 0; j < numDependencies; j++)
+            {
+                Dependency dependency;
+                dependency.Path = stream.ReadStdString();
+                dependency.Size = stream.ReadValue<uint64_t>();
+                dependency.LastModified = stream.ReadValue<uint64_t>();
+                entry.Dependencies.push_back(std::move(dependency));
+            }
+            entry.Checksum = stream.ReadValue<uint32_t>();
+            auto length = stream.ReadValue<uint64_t>();
+            if (length > stream.GetLength() - stream.GetPosition())
+            {
+                throw IOException("Object cache is truncated.");
+            }
+
+            // The entry points into the mapped file rather than being read
+            entry.Data = { mappedFile, data + stream.GetPosition(), (size_t)length };
+            stream.Seek(length, STREAM_SEEK_CURRENT);
+            _entries[sourcePath] = std::move(entry);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to load object cache: '%s'.", _path.c_str());
+        Console::Error::WriteLine("%s", e.what());
+        _entries.clear();
+    }
+}
+
+bool ObjectCache::IsCurrent(const std::string& sourcePath, const Entry& entry)
+{
+    if (File::GetSize(sourcePath) != entry.SourceSize || File::GetLastModified(sourcePath) != entry.SourceLastModified)
+    {
+        return false;
+    }
+    for (const auto& dependency : entry.Dependencies)
+    {
+        if (File::GetSize(dependency.Path) != dependency.Size
+            || File::GetLastModified(dependency.Path) != dependency.LastModified)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<ObjectCacheData> ObjectCache::Get(const std::string& sourcePath)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_opened)
+    {
+        Open();
+    }
+
+    auto it = _entries.find(sourcePath);
+    if (it == _entries.end())
+    {
+        return std::nullopt;
+    }
+
+    auto& entry = it->second;
+    if (!IsCurrent(sourcePath, entry))
+    {
+        return std::nullopt;
+    }
+    if (!entry.Verified)
+    {
+        if (GetChecksum(entry.Data.Data, entry.Data.Length) != entry.Checksum)
+        {
+            log_warning("Object cache entry for '%s' is corrupt.", sourcePath.c_str());
+            _entries.erase(it);
+            _dirty = true;
+            return std::nullopt;
+        }
+        entry.Verified = true;
+    }
+    entry.Used = true;
+    return entry.Data;
+}
+
+ObjectCacheData ObjectCache::Set(
+    const std::string& sourcePath, std::vector<uint8_t> data, const std::vector<std::string>& dependencies)
+{
+    Entry entry;
+    entry.SourceSize = File::GetSize(sourcePath);
+    entry.SourceLastModified = File::GetLastModified(sourcePath);
+    for (const auto& path : dependencies)
+    {
+        entry.Dependencies.push_back({ path, File::GetSize(path), File::GetLastModified(path) });
+    }
+    entry.Checksum = GetChecksum(data.data(), data.size());
+    entry.Verified = true;
+    entry.Used = true;
+    auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(data));
+    entry.Data = { buffer, buffer->data(), buffer->size() };
+    auto result = entry.Data;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_opened)
+    {
+        Open();
+    }
+    _entries[sourcePath] = std::move(entry);
+    _dirty = true;
+    return result;
+}
+
+void ObjectCache::Save()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_dirty)
+    {
+        return;
+    }
+
+    // Entries used in this session are kept first, others only while their source is unchanged and there is room
+    std::vector<std::pair<const std::string*, const Entry*>> entries;
+    for (const auto& [sourcePath, entry] : _entries)
+    {
+        entries.emplace_back(&sourcePath, &entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        if (a.second->Used != b.second->Used)
+            return a.second->Used;
+        return *a.first < *b.first;
+    });
+
+    uint64_t totalSize = 0;
+    auto newEnd = std::remove_if(entries.begin(), entries.end(), [&totalSize](const auto& item) {
+        const auto& sourcePath = *item.first;
+        const auto& entry = *item.second;
+        if (!entry.Used && (totalSize + entry.Data.Length > OBJECT_CACHE_MAX_SIZE || !IsCurrent(sourcePath, entry)))
+        {
+            return true;
+        }
+        totalSize += entry.Data.Length;
+        return false;
+    });
+    entries.erase(newEnd, entries.end());
+
+    // Write to a new file as the current one may still be mapped
+    auto tempPath = _path + ".tmp";
+    try
+    {
+        log_verbose("ObjectCache:Writing cache: '%s'", _path.c_str());
+        Path::CreateDirectory(Path::GetDirectory(_path));
+        auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+
+        ObjectCacheHeader header;
+        header.MagicNumber = OBJECT_CACHE_MAGIC_NUMBER;
+        header.Version = OBJECT_CACHE_VERSION;
+        header.NumEntries = (uint32_t)entries.size();
+        fs.WriteValue(header);
+
+        for (const auto& [sourcePath, entry] : entries)
+        {
+            fs.WriteString(*sourcePath);
+            fs.WriteValue<uint64_t>(entry->SourceSize);
+            fs.WriteValue<uint64_t>(entry->SourceLastModified);
+            fs.WriteValue<uint32_t>((uint32_t)entry->Dependencies.size());
+            for (const auto& dependency : entry->Dependencies)
+            {
+                fs.WriteString(dependency.Path);
+                fs.WriteValue<uint64_t>(dependency.Size);
+                fs.WriteValue<uint64_t>(dependency.LastModified);
+            }
+            fs.WriteValue<uint32_t>(entry->Checksum);
+            fs.WriteValue<uint64_t>(entry->Data.Length);
+            fs.Write(entry->Data.Data, entry->Data.Length);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to save object cache: '%s'.", _path.c_str());
+        Console::Error::WriteLine("%s", e.what());
+        File::Delete(tempPath);
+        return;
+    }
+
+    if (File::Exists(_path))
+    {
+        File::Delete(_path);
+    }
+    if (!File::Move(tempPath, _path))
+    {
+        Console::Error::WriteLine("Unable to replace object cache: '%s'.", _path.c_str());
+        File::Delete(tempPath);
+        return;
+    }
+    _dirty = false;
+
+    // Map the new file so the added entries no longer need to be held in memory
+    _entries.clear();
+    Open();
+}
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A view of data held by the object cache. The data stays valid for as long as the view exists.
+ */
+struct ObjectCacheData
+{
+    std::shared_ptr<const void> Owner;
+    const uint8_t* Data{};
+    size_t Length{};
+};
+
+/**
+ * A binary cache of decoded object data, such as the decoded chunks of DAT files and the image tables of JSON objects,
+ * keyed by the path of the source file. Entries are ignored once the size or modification time of their source file,
+ * or of any other file they were built from, changes. The cache file is memory mapped, so reading an entry does not
+ * copy it.
+ */
+class ObjectCache final
+{
+private:
+    struct Dependency
+    {
+        std::string Path;
+        uint64_t Size{};
+        uint64_t LastModified{};
+    };
+
+    struct Entry
+    {
+        uint64_t SourceSize{};
+        uint64_t SourceLastModified{};
+        std::vector<Dependency> Dependencies;
+        uint32_t Checksum{};
+        bool Verified{};
+        bool Used{};
+        ObjectCacheData Data;
+    };
+
+    std::string const _path;
+    std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    bool _opened = false;
+    bool _dirty = false;
+
+public:
+    explicit ObjectCache(std::string path);
+
+    std::optional<ObjectCacheData> Get(const std::string& sourcePath);
+
+    /**
+     * Adds an entry for the source file. The dependencies are the other files the data was built from, such as images
+     * taken from other objects or graphics files.
+     */
+    ObjectCacheData Set(
+        const std::string& sourcePath, std::vector<uint8_t> data, const std::vector<std::string>& dependencies = {});
+
+    /**
+     * Writes the cache file if any entries were added since it was read.
+     */
+    void Save();
+
+private:
+    void Open();
+    static bool IsCurrent(const std::string& sourcePath, const Entry& entry);
+};
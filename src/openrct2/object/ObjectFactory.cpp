@@ -26,6 +26,7 @@
 #include "FootpathObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectLimits.h"
 #include "ObjectList.h"
 #include "RideObject.h"
@@ -44,6 +45,11 @@ interface IFileDataRetriever
 {
     virtual ~IFileDataRetriever() = default;
     virtual std::vector<uint8_t> GetData(const std::string_view& path) const abstract;
+
+    /**
+     * Gets the path of the file on disk, or an empty string when the data is part of the file the object is read from.
+     */
+    virtual std::string GetFilePath(const std::string_view& path) const abstract;
 };
 
 class FileSystemDataRetriever : public IFileDataRetriever
@@ -59,8 +65,12 @@ public:
 
     std::vector<uint8_t> GetData(const std::string_view& path) const override
     {
-        auto absolutePath = Path::Combine(_basePath, path.data());
-        return File::ReadAllBytes(absolutePath);
+        return File::ReadAllBytes(GetFilePath(path));
+    }
+
+    std::string GetFilePath(const std::string_view& path) const override
+    {
+        return Path::Combine(_basePath, std::string(path));
     }
 };
 
@@ -79,17 +89,63 @@ public:
     {
         return _zipArchive.GetFileData(path);
     }
+
+    std::string GetFilePath(const std::string_view& path) const override
+    {
+        return {};
+    }
 };
 
+/**
+ * Reads a range of the decoded object data from a DAT file, or from the object cache when it holds the file. Missing data
+ * is filled with zeros, the same as when the image table is shorter than expected.
+ */
+static std::vector<uint8_t> ReadLegacyObjectData(
+    ObjectCache* cache, const std::string& path, uint64_t position, size_t length)
+{
+    std::vector<uint8_t> result(length);
+    auto cached = cache != nullptr ? cache->Get(path) : std::nullopt;
+    if (cached)
+    {
+        // Cached data starts with the object entry
+        position += sizeof(rct_object_entry);
+        if (position < cached->Length)
+        {
+            auto available = (size_t)std::min<uint64_t>(length, cached->Length - position);
+            std::copy_n(cached->Data + position, available, result.begin());
+        }
+        return result;
+    }
+
+    try
+    {
+        // Only the range is kept, the rest of the chunk is decoded without being stored
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        auto chunkReader = SawyerChunkReader(&fs);
+        fs.Seek(sizeof(rct_object_entry), STREAM_SEEK_CURRENT);
+        chunkReader.ReadChunkRange(result.data(), (size_t)position, length);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Error: %s when reading images of object %s", e.what(), path.c_str());
+    }
+    return result;
+}
+
 class ReadObjectContext : public IReadObjectContext
 {
 private:
     IObjectRepository& _objectRepository;
     const IFileDataRetriever* _fileDataRetriever;
+    ObjectCache* _cache;
 
     std::string _objectName;
     bool _loadImages;
     std::string _basePath;
+    std::string _deferredDataPath;
+    std::string _cachePath;
+    std::vector<std::string> _cacheDependencies;
+    bool _cacheIncomplete = false;
     bool _wasWarning = false;
     bool _wasError = false;
 
@@ -105,9 +161,10 @@ public:
 
     ReadObjectContext(
         IObjectRepository& objectRepository, const std::string& objectName, bool loadImages,
-        const IFileDataRetriever* fileDataRetriever)
+        const IFileDataRetriever* fileDataRetriever, ObjectCache* cache = nullptr)
         : _objectRepository(objectRepository)
         , _fileDataRetriever(fileDataRetriever)
+        , _cache(cache)
         , _objectName(objectName)
         , _loadImages(loadImages)
     {
@@ -123,10 +180,67 @@ public:
         return _loadImages;
     }
 
+    void SetDeferredDataPath(const std::string& path)
+    {
+        _deferredDataPath = path;
+    }
+
+    void SetCachePath(const std::string& path)
+    {
+        _cachePath = path;
+    }
+
+    ImageDataLoader GetDeferredData(uint64_t position, size_t length) override
+    {
+        if (_deferredDataPath.empty())
+        {
+            return nullptr;
+        }
+        return [cache = _cache, path = _deferredDataPath, position, length]() {
+            return ReadLegacyObjectData(cache, path, position, length);
+        };
+    }
+
+    std::optional<ObjectCacheData> GetCachedData() override
+    {
+        if (_cache == nullptr || _cachePath.empty())
+        {
+            return std::nullopt;
+        }
+        return _cache->Get(_cachePath);
+    }
+
+    void SetCachedData(std::vector<uint8_t> data) override
+    {
+        // Data that was built with missing or broken sources would otherwise be kept once they are fixed
+        if (_cache != nullptr && !_cachePath.empty() && !_cacheIncomplete && !_wasWarning && !_wasError)
+        {
+            _cache->Set(_cachePath, std::move(data), _cacheDependencies);
+        }
+    }
+
+    void AddCacheDependency(const std::string& path) override
+    {
+        if (std::find(_cacheDependencies.begin(), _cacheDependencies.end(), path) == _cacheDependencies.end())
+        {
+            _cacheDependencies.push_back(path);
+        }
+    }
+
+    void SetCacheIncomplete() override
+    {
+        _cacheIncomplete = true;
+    }
+
     std::vector<uint8_t> GetData(const std::string_view& path) override
     {
         if (_fileDataRetriever != nullptr)
         {
+            auto filePath = _fileDataRetriever->GetFilePath(path);
+            if (!filePath.empty())
+            {
+                AddCacheDependency(filePath);
+            }
             return _fileDataRetriever->GetData(path);
         }
         return {};
@@ -156,7 +270,8 @@ public:
 namespace ObjectFactory
 {
     static Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever);
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever,
+        ObjectCache* cache, const std::string& sourcePath);
 
     static uint8_t ParseSourceGame(const std::string& s)
     {
@@ -191,17 +306,43 @@ namespace ObjectFactory
         }
     }
 
-    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path)
+    Object* CreateObjectFromLegacyFile(
+        IObjectRepository& objectRepository, const utf8* path, bool deferImages, ObjectCache* cache)
     {
         log_verbose("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
         Object* result = nullptr;
         try
         {
-            auto fs = FileStream(path, FILE_MODE_OPEN);
-            auto chunkReader = SawyerChunkReader(&fs);
+            // The cache holds the object entry followed by the decoded chunk, a hit skips reading and decoding the file
+            auto cached = cache != nullptr ? cache->Get(path) : std::nullopt;
+            if (!cached)
+            {
+                auto fs = FileStream(path, FILE_MODE_OPEN);
+                auto chunkReader = SawyerChunkReader(&fs);
+                auto fileEntry = fs.ReadValue<rct_object_entry>();
+                auto chunk = chunkReader.ReadChunk();
+
+                std::vector<uint8_t> data(sizeof(rct_object_entry) + chunk->GetLength());
+                std::memcpy(data.data(), &fileEntry, sizeof(rct_object_entry));
+                std::memcpy(data.data() + sizeof(rct_object_entry), chunk->GetData(), chunk->GetLength());
+                if (cache != nullptr)
+                {
+                    cached = cache->Set(path, std::move(data));
+                }
+                else
+                {
+                    auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(data));
+                    cached = ObjectCacheData{ buffer, buffer->data(), buffer->size() };
+                }
+            }
+            if (cached->Length < sizeof(rct_object_entry))
+            {
+                throw IOException("Object data is truncated.");
+            }
 
-            rct_object_entry entry = fs.ReadValue<rct_object_entry>();
+            rct_object_entry entry;
+            std::memcpy(&entry, cached->Data, sizeof(rct_object_entry));
 
             if (object_entry_get_type(&entry) != OBJECT_TYPE_SCENARIO_TEXT)
             {
@@ -211,11 +352,16 @@ namespace ObjectFactory
                 object_entry_get_name_fixed(objectName, sizeof(objectName), &entry);
                 log_verbose("  entry: { 0x%08X, \"%s\", 0x%08X }", entry.flags, objectName, entry.checksum);
 
-                auto chunk = chunkReader.ReadChunk();
-                log_verbose("  size: %zu", chunk->GetLength());
+                auto chunkLength = cached->Length - sizeof(rct_object_entry);
+                log_verbose("  size: %zu", chunkLength);
 
-                auto chunkStream = MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+                auto chunkStream = MemoryStream(cached->Data + sizeof(rct_object_entry), chunkLength);
+                auto readContext = ReadObjectContext(
+                    objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr, cache);
+                if (deferImages)
+                {
+                    readContext.SetDeferredDataPath(path);
+                }
                 ReadObjectLegacy(result, &readContext, &chunkStream);
                 if (readContext.WasError())
                 {
@@ -347,7 +493,8 @@ namespace ObjectFactory
         return 0xFF;
     }
 
-    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path)
+    Object* CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, const std::string_view& path, ObjectCache* cache)
     {
         Object* result = nullptr;
         try
@@ -367,7 +514,7 @@ namespace ObjectFactory
             }
 
             auto fileDataRetriever = ZipDataRetriever(*archive);
-            Object* obj = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            Object* obj = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, cache, std::string(path));
             json_decref(jRoot);
             return obj;
         }
@@ -381,7 +528,7 @@ namespace ObjectFactory
         return result;
     }
 
-    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path)
+    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path, ObjectCache* cache)
     {
         log_verbose("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
@@ -390,7 +537,7 @@ namespace ObjectFactory
         {
             auto jRoot = Json::ReadFromFile(path.c_str());
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, cache, path);
             json_decref(jRoot);
         }
         catch (const std::runtime_error& err)
@@ -404,7 +551,8 @@ namespace ObjectFactory
     }
 
     Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever)
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever,
+        ObjectCache* cache, const std::string& sourcePath)
     {
         log_verbose("CreateObjectFromJson(...)");
 
@@ -430,7 +578,8 @@ namespace ObjectFactory
                 std::memcpy(entry.name, originalName.c_str(), minLength);
 
                 result = CreateObject(entry);
-                auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever);
+                auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever, cache);
+                readContext.SetCachePath(sourcePath);
                 result->ReadJson(&readContext, jRoot);
                 if (readContext.WasError())
                 {
@@ -15,15 +15,23 @@
 
 interface IObjectRepository;
 class Object;
+class ObjectCache;
 struct rct_object_entry;
 
 namespace ObjectFactory
 {
-    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path);
+    /**
+     * Creates an object from a DAT file. With deferImages set, the image data is not kept in memory but read from the file
+     * again when the images are first drawn. Given a cache, decoded data is read from and added to it.
+     */
+    Object* CreateObjectFromLegacyFile(
+        IObjectRepository& objectRepository, const utf8* path, bool deferImages, ObjectCache* cache = nullptr);
     Object* CreateObjectFromLegacyData(
         IObjectRepository& objectRepository, const rct_object_entry* entry, const void* data, size_t dataSize);
-    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path);
+    Object* CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, const std::string_view& path, ObjectCache* cache = nullptr);
     Object* CreateObject(const rct_object_entry& entry);
 
-    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path);
+    Object* CreateObjectFromJsonFile(
+        IObjectRepository& objectRepository, const std::string& path, ObjectCache* cache = nullptr);
 } // namespace ObjectFactory
@@ -23,6 +23,7 @@
 #include "../localisation/Language.h"
 #include "../sprites.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectFactory.h"
 
 #include <algorithm>
@@ -313,9 +314,11 @@ namespace ObjectJsonHelpers
     {
         std::vector<std::unique_ptr<RequiredImage>> result;
         auto objectPath = FindLegacyObject(name);
-        auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+        auto obj = ObjectFactory::CreateObjectFromLegacyFile(
+            context->GetObjectRepository(), objectPath.c_str(), false);
         if (obj != nullptr)
         {
+            context->AddCacheDependency(objectPath);
             auto& imgTable = static_cast<const Object*>(obj)->GetImageTable();
             auto numImages = (int32_t)imgTable.GetCount();
             auto images = imgTable.GetImages();
@@ -365,6 +368,8 @@ namespace ObjectJsonHelpers
         {
             if (is_csg_loaded())
             {
+                context->AddCacheDependency(gfx_get_csg_header_path());
+                context->AddCacheDependency(gfx_get_csg_data_path());
                 auto range = ParseRange(s.substr(4));
                 if (!range.empty())
                 {
@@ -376,9 +381,16 @@ namespace ObjectJsonHelpers
                     }
                 }
             }
+            else
+            {
+                // The images are left out, keep them from being cached for when RCT1 is set up later
+                context->SetCacheIncomplete();
+            }
         }
         else if (String::StartsWith(s, "$G1"))
         {
+            const auto env = GetContext()->GetPlatformEnvironment();
+            context->AddCacheDependency(Path::Combine(env->GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat"));
             auto range = ParseRange(s.substr(3));
             if (!range.empty())
             {
@@ -502,6 +514,18 @@ namespace ObjectJsonHelpers
     {
         if (context->ShouldLoadImages())
         {
+            // Decoding the images is the slowest part of reading an object, so the finished table is cached
+            auto useCache = imageTable.GetCount() == 0;
+            if (useCache)
+            {
+                auto cached = context->GetCachedData();
+                if (cached)
+                {
+                    imageTable.ReadCacheData(context, *cached);
+                    return;
+                }
+            }
+
             // First gather all the required images from inspecting the JSON
             std::vector<std::unique_ptr<RequiredImage>> allImages;
             auto jsonImages = json_object_get(root, "images");
@@ -558,6 +582,11 @@ namespace ObjectJsonHelpers
                     }
                 }
             }
+
+            if (useCache)
+            {
+                context->SetCachedData(imageTable.GetCacheData());
+            }
         }
     }
 } // namespace ObjectJsonHelpers
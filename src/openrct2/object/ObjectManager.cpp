@@ -17,6 +17,7 @@
 #include "FootpathItemObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectList.h"
 #include "ObjectRepository.h"
 #include "SceneryGroupObject.h"
@@ -140,6 +141,12 @@ public:
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
         log_verbose("%u / %u new objects loaded", numNewLoadedObjects, requiredObjects.size());
+
+        // Store what was decoded for objects that were not cached yet, so the next load of the park can map it instead
+        if (numNewLoadedObjects > 0)
+        {
+            _objectRepository.GetObjectCache().Save();
+        }
     }
 
     void UnloadObjects(const rct_object_entry* entries, size_t count) override
@@ -32,6 +32,7 @@
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectFactory.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
@@ -103,7 +104,7 @@ public:
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str());
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), true);
         }
         if (object != nullptr)
         {
@@ -209,6 +210,7 @@ class ObjectRepository final : public IObjectRepository
 {
     std::shared_ptr<IPlatformEnvironment> const _env;
     ObjectFileIndex const _fileIndex;
+    ObjectCache _objectCache;
     std::vector<ObjectRepositoryItem> _items;
     ObjectEntryMap _itemMap;
 
@@ -216,12 +218,14 @@ public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
         , _fileIndex(*this, *env)
+        , _objectCache(env->GetFilePath(PATHID::CACHE_OBJECT_DATA))
     {
     }
 
     ~ObjectRepository() final
     {
         ClearItems();
+        _objectCache.Save();
     }
 
     void LoadOrConstruct(int32_t language) override
@@ -281,15 +285,15 @@ public:
         auto extension = Path::GetExtension(ori->Path);
         if (String::Equals(extension, ".json", true))
         {
-            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, &_objectCache);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, &_objectCache);
         }
         else
         {
-            return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str());
+            return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), true, &_objectCache);
         }
     }
 
@@ -310,6 +314,11 @@ public:
         }
     }
 
+    ObjectCache& GetObjectCache() override
+    {
+        return _objectCache;
+    }
+
     void AddObject(const rct_object_entry* objectEntry, const void* data, size_t dataSize) override
     {
         utf8 objectName[9];
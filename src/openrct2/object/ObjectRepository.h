@@ -18,6 +18,7 @@
 
 interface IStream;
 class Object;
+class ObjectCache;
 namespace OpenRCT2
 {
     interface IPlatformEnvironment;
@@ -73,6 +74,7 @@ interface IObjectRepository
     virtual Object* LoadObject(const ObjectRepositoryItem* ori) abstract;
     virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) abstract;
     virtual void UnregisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) abstract;
+    virtual ObjectCache& GetObjectCache() abstract;
 
     virtual void AddObject(const rct_object_entry* objectEntry, const void* data, size_t dataSize) abstract;
     virtual void AddObjectFromFile(const std::string_view& objectName, const void* data, size_t dataSize) abstract;
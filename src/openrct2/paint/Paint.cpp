@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -49,6 +50,7 @@ static constexpr const uint8_t BoundBoxDebugColours[] = {
 bool gShowDirtyVisuals;
 bool gPaintBoundingBoxes;
 bool gPaintBlockedTiles;
+PaintArrangeEngine gPaintArrangeEngine = PaintArrangeEngine::Legacy;
 
 static void paint_attached_ps(rct_drawpixelinfo* dpi, paint_struct* ps, uint32_t viewFlags);
 static void paint_ps_image_with_bounding_boxes(
@@ -74,15 +76,13 @@ static paint_struct* sub_9819_c(
     paint_session* session, uint32_t image_id, const CoordsXYZ& offset, LocationXYZ16 boundBoxSize,
     LocationXYZ16 boundBoxOffset)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-        return nullptr;
     auto g1 = gfx_get_g1_element(image_id & 0x7FFFF);
     if (g1 == nullptr)
     {
         return nullptr;
     }
 
-    paint_struct* ps = &session->NextFreePaintStruct->basic;
+    paint_struct* ps = &session->PaintEntries.Reserve()->basic;
     ps->image_id = image_id;
 
     uint8_t swappedRotation = (session->CurrentRotation * 3) % 4; // swaps 1 and 3
@@ -420,7 +420,7 @@ paint_struct* paint_arrange_structs_helper(paint_struct* ps_next, uint16_t quadr
  *
  *  rct2: 0x00688217
  */
-void paint_session_arrange(paint_session* session)
+static void paint_session_arrange_legacy(paint_session* session)
 {
     paint_struct* psHead = &session->PaintHead;
 
@@ -456,6 +456,172 @@ void paint_session_arrange(paint_session* session)
     }
 }
 
+/**
+ * Flat copy of the fields of a paint struct that take part in arranging, so the passes below only touch a compact
+ * array instead of chasing the quadrant lists.
+ */
+struct paint_sort_key
+{
+    paint_struct_bound_box bounds;
+    uint16_t quadrant_index;
+    uint8_t quadrant_flags;
+    paint_struct* ps;
+};
+
+/**
+ * Array version of paint_arrange_structs_helper_rotation. The keys are in quadrant order, so only the structs of this
+ * and the following quadrant are compared, moving a struct in front of the current one is a rotation of the range
+ * in between. Produces exactly the same order as the linked list version.
+ */
+template<uint8_t _TRotation>
+static size_t paint_arrange_keys_rotation(std::vector<paint_sort_key>& keys, size_t start, uint16_t quadrantIndex, uint8_t flag)
+{
+    const size_t count = keys.size();
+
+    size_t ps = start;
+    while (true)
+    {
+        if (ps + 1 >= count)
+            return ps;
+        if (quadrantIndex <= keys[ps + 1].quadrant_index)
+            break;
+        ps++;
+    }
+
+    // Cache the last visited position so we don't have to walk the whole array again
+    const size_t psCache = ps;
+
+    for (size_t i = ps + 1; i < count; i++)
+    {
+        auto& key = keys[i];
+        if (key.quadrant_index > quadrantIndex + 1)
+        {
+            key.quadrant_flags = PAINT_QUADRANT_FLAG_BIGGER;
+            break;
+        }
+        else if (key.quadrant_index == quadrantIndex + 1)
+        {
+            key.quadrant_flags = PAINT_QUADRANT_FLAG_NEXT | PAINT_QUADRANT_FLAG_IDENTICAL;
+        }
+        else if (key.quadrant_index == quadrantIndex)
+        {
+            key.quadrant_flags = flag | PAINT_QUADRANT_FLAG_IDENTICAL;
+        }
+    }
+
+    while (true)
+    {
+        size_t initial;
+        while (true)
+        {
+            initial = ps + 1;
+            if (initial >= count)
+                return psCache;
+            if (keys[initial].quadrant_flags & PAINT_QUADRANT_FLAG_BIGGER)
+                return psCache;
+            if (keys[initial].quadrant_flags & PAINT_QUADRANT_FLAG_IDENTICAL)
+                break;
+            ps = initial;
+        }
+
+        keys[initial].quadrant_flags &= ~PAINT_QUADRANT_FLAG_IDENTICAL;
+        const size_t insertAt = initial;
+
+        // Copied as the initial key itself shifts every time a struct is moved in front of it.
+        const paint_struct_bound_box initialBBox = keys[initial].bounds;
+
+        for (size_t current = initial + 1; current < count; current++)
+        {
+            const auto& key = keys[current];
+            if (key.quadrant_flags & PAINT_QUADRANT_FLAG_BIGGER)
+                break;
+            if (!(key.quadrant_flags & PAINT_QUADRANT_FLAG_NEXT))
+                continue;
+
+            if (check_bounding_box<_TRotation>(initialBBox, key.bounds))
+            {
+                std::rotate(keys.begin() + insertAt, keys.begin() + current, keys.begin() + current + 1);
+            }
+        }
+
+        ps = insertAt - 1;
+    }
+}
+
+static size_t paint_arrange_keys(
+    std::vector<paint_sort_key>& keys, size_t start, uint16_t quadrantIndex, uint8_t flag, uint8_t rotation)
+{
+    switch (rotation)
+    {
+        case 0:
+            return paint_arrange_keys_rotation<0>(keys, start, quadrantIndex, flag);
+        case 1:
+            return paint_arrange_keys_rotation<1>(keys, start, quadrantIndex, flag);
+        case 2:
+            return paint_arrange_keys_rotation<2>(keys, start, quadrantIndex, flag);
+        case 3:
+            return paint_arrange_keys_rotation<3>(keys, start, quadrantIndex, flag);
+    }
+    return start;
+}
+
+static void paint_session_arrange_flat(paint_session* session)
+{
+    // Sessions are arranged on several threads at once, each keeps its own scratch buffer between frames.
+    static thread_local std::vector<paint_sort_key> keys;
+
+    paint_struct* psHead = &session->PaintHead;
+    keys.clear();
+    keys.push_back({ {}, 0, 0, psHead });
+
+    if (session->QuadrantBackIndex != UINT32_MAX)
+    {
+        for (uint32_t quadrantIndex = session->QuadrantBackIndex; quadrantIndex <= session->QuadrantFrontIndex;
+             quadrantIndex++)
+        {
+            for (auto ps = session->Quadrants[quadrantIndex]; ps != nullptr; ps = ps->next_quadrant_ps)
+            {
+                keys.push_back({ ps->bounds, ps->quadrant_index, ps->quadrant_flags, ps });
+            }
+        }
+
+        size_t psCache = paint_arrange_keys(
+            keys, 0, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT, session->CurrentRotation);
+
+        uint32_t quadrantIndex = session->QuadrantBackIndex;
+        while (++quadrantIndex < session->QuadrantFrontIndex)
+        {
+            psCache = paint_arrange_keys(keys, psCache, quadrantIndex & 0xFFFF, 0, session->CurrentRotation);
+        }
+    }
+
+    // Relink the structs in their final order.
+    for (size_t i = 1; i < keys.size(); i++)
+    {
+        keys[i].ps->quadrant_flags = keys[i].quadrant_flags;
+        keys[i - 1].ps->next_quadrant_ps = keys[i].ps;
+    }
+    keys.back().ps->next_quadrant_ps = nullptr;
+}
+
+void paint_session_arrange(paint_session* session, PaintArrangeEngine engine)
+{
+    switch (engine)
+    {
+        case PaintArrangeEngine::Legacy:
+            paint_session_arrange_legacy(session);
+            break;
+        case PaintArrangeEngine::Flat:
+            paint_session_arrange_flat(session);
+            break;
+    }
+}
+
+void paint_session_arrange(paint_session* session)
+{
+    paint_session_arrange(session, gPaintArrangeEngine);
+}
+
 static void paint_draw_struct(paint_session* session, paint_struct* ps)
 {
     rct_drawpixelinfo* dpi = &session->DPI;
@@ -699,6 +865,112 @@ static void draw_pixel_info_crop_by_zoom(rct_drawpixelinfo* dpi)
     dpi->height >>= zoom;
 }
 
+size_t PaintEntryChain::GetCount() const
+{
+    size_t count = 0;
+    for (auto chunk = Head; chunk != nullptr; chunk = chunk->Next)
+    {
+        count += chunk->Count;
+    }
+    return count;
+}
+
+size_t PaintEntryChain::GetChunkCount() const
+{
+    size_t count = 0;
+    for (auto chunk = Head; chunk != nullptr; chunk = chunk->Next)
+    {
+        count++;
+    }
+    return count;
+}
+
+void PaintEntryChain::Clear()
+{
+    Pool->FreeChunks(Head);
+    Head = nullptr;
+    Current = nullptr;
+}
+
+void PaintEntryChain::Grow()
+{
+    auto chunk = Pool->AllocateChunk();
+    if (Current == nullptr)
+    {
+        Head = chunk;
+    }
+    else
+    {
+        Current->Next = chunk;
+    }
+    Current = chunk;
+}
+
+PaintEntryPool::~PaintEntryPool()
+{
+    for (auto chunk : _freeChunks)
+    {
+        delete chunk;
+    }
+}
+
+PaintEntryChain PaintEntryPool::Create()
+{
+    return PaintEntryChain{ this, nullptr, nullptr };
+}
+
+PaintEntryChain::Chunk* PaintEntryPool::AllocateChunk()
+{
+    PaintEntryChain::Chunk* chunk = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _chunksInUse++;
+        _chunksInUsePeak = std::max(_chunksInUsePeak, _chunksInUse);
+        if (!_freeChunks.empty())
+        {
+            chunk = _freeChunks.back();
+            _freeChunks.pop_back();
+        }
+    }
+    if (chunk == nullptr)
+    {
+        chunk = new PaintEntryChain::Chunk;
+    }
+    chunk->Next = nullptr;
+    chunk->Count = 0;
+    return chunk;
+}
+
+void PaintEntryPool::FreeChunks(PaintEntryChain::Chunk* head)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    while (head != nullptr)
+    {
+        auto next = head->Next;
+        _freeChunks.push_back(head);
+        _chunksInUse--;
+        head = next;
+    }
+}
+
+void PaintEntryPool::Trim()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t keep = _chunksInUsePeak > _chunksInUse ? _chunksInUsePeak - _chunksInUse : 0;
+    while (_freeChunks.size() > keep)
+    {
+        delete _freeChunks.back();
+        _freeChunks.pop_back();
+    }
+    _chunksInUsePeak = _chunksInUse;
+}
+
+size_t PaintEntryPool::GetChunksInUsePeak()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _chunksInUsePeak;
+}
+
 paint_session* paint_session_alloc(rct_drawpixelinfo* dpi, uint32_t viewFlags)
 {
     return GetContext()->GetPainter()->CreateSession(dpi, viewFlags);
@@ -709,6 +981,45 @@ void paint_session_free([[maybe_unused]] paint_session* session)
     GetContext()->GetPainter()->ReleaseSession(session);
 }
 
+RecordedPaintSession paint_session_record(const paint_session* session)
+{
+    RecordedPaintSession recorded;
+    recorded.Session = *session;
+    recorded.Session.PaintEntries = {};
+
+    std::vector<const PaintEntryChain::Chunk*> chunks;
+    for (auto chunk = session->PaintEntries.Head; chunk != nullptr; chunk = chunk->Next)
+    {
+        chunks.push_back(chunk);
+        recorded.Entries.insert(recorded.Entries.end(), chunk->Entries, chunk->Entries + chunk->Count);
+    }
+
+    const size_t nullIndex = recorded.Entries.size();
+    auto toIndex = [&chunks, nullIndex](const paint_struct* ps) -> paint_struct* {
+        auto entry = reinterpret_cast<const paint_entry*>(ps);
+        size_t base = 0;
+        for (auto chunk : chunks)
+        {
+            if (entry >= chunk->Entries && entry < chunk->Entries + chunk->Count)
+            {
+                return reinterpret_cast<paint_struct*>(base + (entry - chunk->Entries));
+            }
+            base += chunk->Count;
+        }
+        return reinterpret_cast<paint_struct*>(nullIndex);
+    };
+
+    for (auto& entry : recorded.Entries)
+    {
+        entry.basic.next_quadrant_ps = toIndex(entry.basic.next_quadrant_ps);
+    }
+    for (auto& quadrant : recorded.Session.Quadrants)
+    {
+        quadrant = toIndex(quadrant);
+    }
+    return recorded;
+}
+
 /**
  *  rct2: 0x006861AC, 0x00686337, 0x006864D0, 0x0068666B, 0x0098196C
  *
@@ -731,18 +1042,13 @@ paint_struct* sub_98196C(
     session->LastRootPS = nullptr;
     session->UnkF1AD2C = nullptr;
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return nullptr;
-    }
-
     auto g1Element = gfx_get_g1_element(image_id & 0x7FFFF);
     if (g1Element == nullptr)
     {
         return nullptr;
     }
 
-    paint_struct* ps = &session->NextFreePaintStruct->basic;
+    paint_struct* ps = &session->PaintEntries.Reserve()->basic;
     ps->image_id = image_id;
 
     CoordsXYZ coord_3d = {
@@ -850,7 +1156,7 @@ paint_struct* sub_98196C(
     }
     paint_session_add_ps_to_quadrant(session, ps, positionHash);
 
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
 
     return ps;
 }
@@ -910,7 +1216,7 @@ paint_struct* sub_98197C(
     int32_t positionHash = attach.x + attach.y;
     paint_session_add_ps_to_quadrant(session, ps, positionHash);
 
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
     return ps;
 }
 
@@ -952,7 +1258,7 @@ paint_struct* sub_98198C(
     }
 
     session->LastRootPS = ps;
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
     return ps;
 }
 
@@ -1001,7 +1307,7 @@ paint_struct* sub_98199C(
     old_ps->children = ps;
 
     session->LastRootPS = ps;
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
     return ps;
 }
 
@@ -1020,11 +1326,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
         return paint_attach_to_previous_ps(session, image_id, x, y);
     }
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return false;
-    }
-    attached_paint_struct* ps = &session->NextFreePaintStruct->attached;
+    attached_paint_struct* ps = &session->PaintEntries.Reserve()->attached;
     ps->image_id = image_id;
     ps->x = x;
     ps->y = y;
@@ -1037,7 +1339,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
 
     session->UnkF1AD2C = ps;
 
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
 
     return true;
 }
@@ -1052,11 +1354,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
  */
 bool paint_attach_to_previous_ps(paint_session* session, uint32_t image_id, uint16_t x, uint16_t y)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return false;
-    }
-    attached_paint_struct* ps = &session->NextFreePaintStruct->attached;
+    attached_paint_struct* ps = &session->PaintEntries.Reserve()->attached;
 
     ps->image_id = image_id;
     ps->x = x;
@@ -1069,7 +1367,7 @@ bool paint_attach_to_previous_ps(paint_session* session, uint32_t image_id, uint
         return false;
     }
 
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
 
     attached_paint_struct* oldFirstAttached = masterPs->attached_ps;
     masterPs->attached_ps = ps;
@@ -1095,12 +1393,7 @@ void paint_floating_money_effect(
     paint_session* session, money32 amount, rct_string_id string_id, int16_t y, int16_t z, int8_t y_offsets[], int16_t offset_x,
     uint32_t rotation)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return;
-    }
-
-    paint_string_struct* ps = &session->NextFreePaintStruct->string;
+    paint_string_struct* ps = &session->PaintEntries.Reserve()->string;
     ps->string_id = string_id;
     ps->next = nullptr;
     ps->args[0] = amount;
@@ -1119,7 +1412,7 @@ void paint_floating_money_effect(
     ps->x = coord.x + offset_x;
     ps->y = coord.y;
 
-    session->NextFreePaintStruct++;
+    session->PaintEntries.Commit();
 
     if (session->LastPSString == nullptr)
     {
@@ -14,6 +14,9 @@
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
 
+#include <mutex>
+#include <vector>
+
 struct TileElement;
 
 #pragma pack(push, 1)
@@ -108,6 +111,77 @@ union paint_entry
     paint_string_struct string;
 };
 
+class PaintEntryPool;
+
+/**
+ * The paint entries of a session, stored in fixed size chunks that are borrowed from a PaintEntryPool on demand.
+ * Entries never move once handed out, so paint structs can keep pointing at each other.
+ */
+struct PaintEntryChain
+{
+    struct Chunk
+    {
+        static constexpr size_t Capacity = 512;
+
+        Chunk* Next;
+        size_t Count;
+        paint_entry Entries[Capacity];
+    };
+
+    PaintEntryPool* Pool;
+    Chunk* Head;
+    Chunk* Current;
+
+    /**
+     * Returns the next free entry, it is only consumed once Commit is called.
+     */
+    paint_entry* Reserve()
+    {
+        if (Current == nullptr || Current->Count == Chunk::Capacity)
+        {
+            Grow();
+        }
+        return &Current->Entries[Current->Count];
+    }
+
+    void Commit()
+    {
+        Current->Count++;
+    }
+
+    size_t GetCount() const;
+    size_t GetChunkCount() const;
+    void Clear();
+
+private:
+    void Grow();
+};
+
+/**
+ * Thread-safe free list of paint entry chunks shared by all sessions of a painter. Chunks are kept across frames,
+ * Trim releases the ones that were not needed since the previous call.
+ */
+class PaintEntryPool
+{
+private:
+    std::mutex _mutex;
+    std::vector<PaintEntryChain::Chunk*> _freeChunks;
+    size_t _chunksInUse = 0;
+    size_t _chunksInUsePeak = 0;
+
+public:
+    PaintEntryPool() = default;
+    PaintEntryPool(const PaintEntryPool&) = delete;
+    PaintEntryPool& operator=(const PaintEntryPool&) = delete;
+    ~PaintEntryPool();
+
+    PaintEntryChain Create();
+    PaintEntryChain::Chunk* AllocateChunk();
+    void FreeChunks(PaintEntryChain::Chunk* head);
+    void Trim();
+    size_t GetChunksInUsePeak();
+};
+
 struct sprite_bb
 {
     uint32_t sprite_id;
@@ -121,6 +195,14 @@ enum PAINT_STRUCT_FLAGS
     PAINT_STRUCT_FLAG_IS_MASKED = (1 << 0)
 };
 
+enum class PaintArrangeEngine : uint8_t
+{
+    // Original linked list walk over the quadrants.
+    Legacy,
+    // Same ordering, computed on a flat array of sort keys. Opt in with the paint_arrange_engine console variable.
+    Flat,
+};
+
 struct support_height
 {
     uint16_t height;
@@ -140,15 +222,13 @@ struct tunnel_entry
 struct paint_session
 {
     rct_drawpixelinfo DPI;
-    paint_entry PaintStructs[4000];
+    PaintEntryChain PaintEntries;
     paint_struct* Quadrants[MAX_PAINT_QUADRANTS];
     paint_struct PaintHead;
     uint32_t ViewFlags;
     uint32_t QuadrantBackIndex;
     uint32_t QuadrantFrontIndex;
     const void* CurrentlyDrawnItem;
-    paint_entry* EndOfPaintStructArray;
-    paint_entry* NextFreePaintStruct;
     LocationXY16 SpritePosition;
     paint_struct* LastRootPS;
     attached_paint_struct* UnkF1AD2C;
@@ -174,6 +254,16 @@ struct paint_session
     uint32_t TrackColours[4];
 };
 
+/**
+ * Copy of a generated session and its paint entries in a single array, as used by the sprite sort benchmark.
+ * The quadrant links are stored as indices into Entries, with Entries.size() standing in for nullptr.
+ */
+struct RecordedPaintSession
+{
+    paint_session Session;
+    std::vector<paint_entry> Entries;
+};
+
 extern paint_session gPaintSession;
 
 // Globals for paint clipping
@@ -187,6 +277,7 @@ extern bool gShowDirtyVisuals;
 extern bool gPaintBoundingBoxes;
 extern bool gPaintBlockedTiles;
 extern bool gPaintWidePathsAsGhost;
+extern PaintArrangeEngine gPaintArrangeEngine;
 
 paint_struct* sub_98196C(
     paint_session* session, uint32_t image_id, int8_t x_offset, int8_t y_offset, int16_t bound_box_length_x,
@@ -226,8 +317,10 @@ void paint_floating_money_effect(
 
 paint_session* paint_session_alloc(rct_drawpixelinfo* dpi, uint32_t viewFlags);
 void paint_session_free(paint_session* session);
+RecordedPaintSession paint_session_record(const paint_session* session);
 void paint_session_generate(paint_session* session);
 void paint_session_arrange(paint_session* session);
+void paint_session_arrange(paint_session* session, PaintArrangeEngine engine);
 paint_struct* paint_arrange_structs_helper(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag, uint8_t rotation);
 void paint_draw_structs(paint_session* session);
 void paint_draw_money_structs(rct_drawpixelinfo* dpi, paint_string_struct* ps);
@@ -77,6 +77,8 @@ void Painter::Paint(IDrawingEngine& de)
         PaintFPS(dpi);
     }
     gCurrentDrawCount++;
+
+    EndPaintEntryFrame();
 }
 
 void Painter::PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text)
@@ -142,10 +144,25 @@ void Painter::MeasureFPS()
     _lastSecond = currentTime;
 }
 
+void Painter::EndPaintEntryFrame()
+{
+    {
+        std::lock_guard<std::mutex> lock(_paintSessionPoolMutex);
+        _lastFramePaintEntryPeak = _paintEntryPeak;
+        _paintEntryPeak = 0;
+    }
+    _lastFramePaintChunkPeak = _paintEntryPool.GetChunksInUsePeak();
+
+    // Keep enough chunks around for the next frame to look like this one, release the rest.
+    _paintEntryPool.Trim();
+}
+
 paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags)
 {
     paint_session* session = nullptr;
 
+    // Sessions may be requested from several paint jobs at once.
+    std::unique_lock<std::mutex> lock(_paintSessionPoolMutex);
     if (_freePaintSessions.empty() == false)
     {
         // Re-use.
@@ -161,10 +178,10 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
         _paintSessionPool.emplace_back(std::make_unique<paint_session>());
         session = _paintSessionPool.back().get();
     }
+    lock.unlock();
 
     session->DPI = *dpi;
-    session->EndOfPaintStructArray = &session->PaintStructs[4000 - 1];
-    session->NextFreePaintStruct = session->PaintStructs;
+    session->PaintEntries = _paintEntryPool.Create();
     session->LastRootPS = nullptr;
     session->UnkF1AD2C = nullptr;
     session->ViewFlags = viewFlags;
@@ -185,5 +202,11 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 
 void Painter::ReleaseSession(paint_session* session)
 {
+    // Idle sessions hand their chunks back so they only take up memory while painting.
+    size_t entryCount = session->PaintEntries.GetCount();
+    session->PaintEntries.Clear();
+
+    std::lock_guard<std::mutex> lock(_paintSessionPoolMutex);
+    _paintEntryPeak = std::max(_paintEntryPeak, entryCount);
     _freePaintSessions.push_back(session);
 }
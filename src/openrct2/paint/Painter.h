@@ -14,6 +14,7 @@
 
 #include <ctime>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 struct rct_drawpixelinfo;
@@ -38,6 +39,11 @@ namespace OpenRCT2
             std::shared_ptr<Ui::IUiContext> const _uiContext;
             std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
             std::vector<paint_session*> _freePaintSessions;
+            std::mutex _paintSessionPoolMutex;
+            PaintEntryPool _paintEntryPool;
+            size_t _paintEntryPeak = 0;
+            size_t _lastFramePaintEntryPeak = 0;
+            size_t _lastFramePaintChunkPeak = 0;
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
@@ -49,10 +55,27 @@ namespace OpenRCT2
             paint_session* CreateSession(rct_drawpixelinfo * dpi, uint32_t viewFlags);
             void ReleaseSession(paint_session * session);
 
+            /**
+             * Largest amount of paint entries used by a single session during the last frame.
+             */
+            size_t GetPaintEntryPeak() const
+            {
+                return _lastFramePaintEntryPeak;
+            }
+
+            /**
+             * Largest amount of paint entry chunks in use at once during the last frame.
+             */
+            size_t GetPaintChunkPeak() const
+            {
+                return _lastFramePaintChunkPeak;
+            }
+
         private:
             void PaintReplayNotice(rct_drawpixelinfo * dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo * dpi);
             void MeasureFPS();
+            void EndPaintEntryFrame();
         };
     } // namespace Paint
 } // namespace OpenRCT2
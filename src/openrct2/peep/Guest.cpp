@@ -393,8 +393,7 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
 static void peep_update_hunger(Peep* peep);
 static void peep_decide_whether_to_leave_park(Peep* peep);
 static void peep_leave_park(Peep* peep);
-static void peep_head_for_nearest_ride_type(Guest* peep, int32_t rideType);
-static void peep_head_for_nearest_ride_with_flags(Guest* peep, int32_t rideTypeFlags);
+static void peep_head_for_nearest_ride_in(Guest* peep, bool considerOnlyCloseRides, const std::bitset<MAX_RIDES>& rides);
 bool loc_690FD0(Peep* peep, uint8_t* rideToView, uint8_t* rideSeatToView, TileElement* tileElement);
 
 bool Guest::GuestHasValidXY() const
@@ -689,7 +688,7 @@ int32_t Guest::CheckEasterEggName(int32_t index) const
     return _stricmp(buffer, gPeepEasterEggNames[index]) == 0;
 }
 
-void Guest::Tick128UpdateGuest(int32_t index)
+void Guest::Tick128UpdateGuest(int32_t index, const GuestTick128Batch& batch)
 {
     if ((uint32_t)(index & 0x1FF) == (gCurrentTicks & 0x1FF))
     {
@@ -808,7 +807,7 @@ void Guest::Tick128UpdateGuest(int32_t index)
 
             if (time_duration >= 5)
             {
-                PickRideToGoOn();
+                PickRideToGoOn(batch);
 
                 if (guest_heading_to_ride_id == RIDE_ID_NULL)
                 {
@@ -822,7 +821,7 @@ void Guest::Tick128UpdateGuest(int32_t index)
 
         if ((scenario_rand() & 0xFFFF) <= ((item_standard_flags & PEEP_ITEM_MAP) ? 8192U : 2184U))
         {
-            PickRideToGoOn();
+            PickRideToGoOn(batch);
         }
 
         if ((uint32_t)(index & 0x3FF) == (gCurrentTicks & 0x3FF))
@@ -887,16 +886,19 @@ void Guest::Tick128UpdateGuest(int32_t index)
                     switch (chosen_thought)
                     {
                         case PEEP_THOUGHT_TYPE_HUNGRY:
-                            peep_head_for_nearest_ride_with_flags(this, RIDE_TYPE_FLAG_SELLS_FOOD);
+                            peep_head_for_nearest_ride_in(this, false, batch.FoodStalls);
                             break;
                         case PEEP_THOUGHT_TYPE_THIRSTY:
-                            peep_head_for_nearest_ride_with_flags(this, RIDE_TYPE_FLAG_SELLS_DRINKS);
+                            peep_head_for_nearest_ride_in(this, false, batch.DrinkStalls);
                             break;
                         case PEEP_THOUGHT_TYPE_BATHROOM:
-                            peep_head_for_nearest_ride_with_flags(this, RIDE_TYPE_FLAG_IS_BATHROOM);
+                            if (!HasFood())
+                            {
+                                peep_head_for_nearest_ride_in(this, false, batch.Toilets);
+                            }
                             break;
                         case PEEP_THOUGHT_TYPE_RUNNING_OUT:
-                            peep_head_for_nearest_ride_type(this, RIDE_TYPE_CASH_MACHINE);
+                            peep_head_for_nearest_ride_in(this, false, batch.CashMachines);
                             break;
                         default:
                             break;
@@ -916,7 +918,7 @@ void Guest::Tick128UpdateGuest(int32_t index)
                 if (nausea >= 200)
                 {
                     thought_type = PEEP_THOUGHT_TYPE_VERY_SICK;
-                    peep_head_for_nearest_ride_type(this, RIDE_TYPE_FIRST_AID);
+                    peep_head_for_nearest_ride_in(this, true, batch.FirstAidRooms);
                 }
                 InsertNewThought(thought_type, PEEP_THOUGHT_ITEM_NONE);
             }
@@ -1841,11 +1843,49 @@ bool Guest::HasFood() const
     return HasFoodStandardFlag() || HasFoodExtraFlag();
 }
 
+void GuestTick128Batch::Prepare()
+{
+    TallRides.reset();
+    FoodStalls.reset();
+    DrinkStalls.reset();
+    Toilets.reset();
+    CashMachines.reset();
+    FirstAidRooms.reset();
+
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
+        {
+            TallRides[ride.id] = true;
+        }
+        if (ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_SELLS_FOOD))
+        {
+            FoodStalls[ride.id] = true;
+        }
+        if (ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_SELLS_DRINKS))
+        {
+            DrinkStalls[ride.id] = true;
+        }
+        if (ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_IS_BATHROOM))
+        {
+            Toilets[ride.id] = true;
+        }
+        if (ride.type == RIDE_TYPE_CASH_MACHINE)
+        {
+            CashMachines[ride.id] = true;
+        }
+        if (ride.type == RIDE_TYPE_FIRST_AID)
+        {
+            FirstAidRooms[ride.id] = true;
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x00695DD2
  */
-void Guest::PickRideToGoOn()
+void Guest::PickRideToGoOn(const GuestTick128Batch& batch)
 {
     if (state != PEEP_STATE_WALKING)
         return;
@@ -1858,7 +1898,7 @@ void Guest::PickRideToGoOn()
     if (x == LOCATION_NULL)
         return;
 
-    auto ride = FindBestRideToGoOn();
+    auto ride = FindBestRideToGoOn(batch);
     if (ride != nullptr)
     {
         // Head to that ride
@@ -1875,10 +1915,10 @@ void Guest::PickRideToGoOn()
     }
 }
 
-Ride* Guest::FindBestRideToGoOn()
+Ride* Guest::FindBestRideToGoOn(const GuestTick128Batch& batch)
 {
     // Pick the most exciting ride
-    auto rideConsideration = FindRidesToGoOn();
+    auto rideConsideration = FindRidesToGoOn(batch);
     Ride* mostExcitingRide = nullptr;
     for (auto& ride : GetRideManager())
     {
@@ -1899,7 +1939,7 @@ Ride* Guest::FindBestRideToGoOn()
     return mostExcitingRide;
 }
 
-std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
+std::bitset<MAX_RIDES> Guest::FindRidesToGoOn(const GuestTick128Batch& batch)
 {
     std::bitset<MAX_RIDES> rideConsideration;
 
@@ -1946,13 +1986,7 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
         }
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
-            {
-                rideConsideration[ride.id] = true;
-            }
-        }
+        rideConsideration |= batch.TallRides;
     }
 
     return rideConsideration;
@@ -3015,18 +3049,15 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    rct_litter* litter;
-    for (uint16_t sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next)
-    {
-        litter = &(get_sprite(sprite_idx)->litter);
-
+    sprite_query_radius<rct_litter>(centre_x, centre_y, 160, [&](rct_litter* litter) {
         int16_t dist_x = abs(litter->x - centre_x);
         int16_t dist_y = abs(litter->y - centre_y);
         if (std::max(dist_x, dist_y) <= 160)
         {
             num_rubbish++;
         }
-    }
+        return false;
+    });
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PEEP_THOUGHT_TYPE_FOUNTAINS;
@@ -3252,21 +3283,9 @@ template<typename T> static void peep_head_for_nearest_ride(Guest* peep, bool co
     }
 }
 
-static void peep_head_for_nearest_ride_type(Guest* peep, int32_t rideType)
+static void peep_head_for_nearest_ride_in(Guest* peep, bool considerOnlyCloseRides, const std::bitset<MAX_RIDES>& rides)
 {
-    auto considerOnlyCloseRides = rideType == RIDE_TYPE_FIRST_AID;
-    return peep_head_for_nearest_ride(
-        peep, considerOnlyCloseRides, [rideType](const Ride& ride) { return ride.type == rideType; });
-}
-
-static void peep_head_for_nearest_ride_with_flags(Guest* peep, int32_t rideTypeFlags)
-{
-    if ((rideTypeFlags & RIDE_TYPE_FLAG_IS_BATHROOM) && peep->HasFood())
-    {
-        return;
-    }
-    peep_head_for_nearest_ride(
-        peep, false, [rideTypeFlags](const Ride& ride) { return ride_type_has_flag(ride.type, rideTypeFlags); });
+    peep_head_for_nearest_ride(peep, considerOnlyCloseRides, [&rides](const Ride& ride) { return rides[ride.id]; });
 }
 
 /**
@@ -5497,25 +5516,13 @@ void Guest::UpdateWalking()
         return;
 
     // Check if there is a peep watching (and if there is place for us)
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->generic.next_in_quadrant)
-    {
-        sprite = get_sprite(sprite_id);
-
-        if (sprite->generic.linked_list_index != SPRITE_LIST_PEEP)
-            continue;
-
-        if (sprite->peep.state != PEEP_STATE_WATCHING)
-            continue;
-
-        if (z != sprite->peep.z)
-            continue;
-
-        if ((sprite->peep.var_37 & 0x3) != chosen_edge)
-            continue;
-
-        positions_free &= ~(1 << ((sprite->peep.var_37 & 0x1C) >> 2));
-    }
+    sprite_query_tile<Peep>(x, y, [&](Peep* otherPeep) {
+        if (otherPeep->state == PEEP_STATE_WATCHING && z == otherPeep->z && (otherPeep->var_37 & 0x3) == chosen_edge)
+        {
+            positions_free &= ~(1 << ((otherPeep->var_37 & 0x1C) >> 2));
+        }
+        return false;
+    });
 
     if (!positions_free)
         return;
@@ -6072,28 +6079,16 @@ bool Guest::UpdateWalkingFindBench()
     for (; !(edges & (1 << chosen_edge));)
         chosen_edge = (chosen_edge + 1) & 0x3;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
     uint8_t free_edge = 3;
 
     // Check if there is no peep sitting in chosen_edge
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->generic.next_in_quadrant)
-    {
-        sprite = get_sprite(sprite_id);
-
-        if (sprite->generic.linked_list_index != SPRITE_LIST_PEEP)
-            continue;
-
-        if (sprite->peep.state != PEEP_STATE_SITTING)
-            continue;
-
-        if (z != sprite->peep.z)
-            continue;
-
-        if ((sprite->peep.var_37 & 0x3) != chosen_edge)
-            continue;
-
-        free_edge &= ~(1 << ((sprite->peep.var_37 & 0x4) >> 2));
-    }
+    sprite_query_tile<Peep>(x, y, [&](Peep* otherPeep) {
+        if (otherPeep->state == PEEP_STATE_SITTING && z == otherPeep->z && (otherPeep->var_37 & 0x3) == chosen_edge)
+        {
+            free_edge &= ~(1 << ((otherPeep->var_37 & 0x4) >> 2));
+        }
+        return false;
+    });
 
     if (!free_edge)
         return false;
@@ -6263,39 +6258,23 @@ static void peep_update_walking_break_scenery(Peep* peep)
     if (edges == 0xF)
         return;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(peep->x, peep->y);
-
     // Check if a peep is already sitting on the bench. If so, do not vandalise it.
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->generic.next_in_quadrant)
-    {
-        sprite = get_sprite(sprite_id);
-
-        if ((sprite->generic.linked_list_index != SPRITE_LIST_PEEP) || (sprite->peep.state != PEEP_STATE_SITTING)
-            || (peep->z != sprite->peep.z))
-        {
-            continue;
-        }
-
+    bool benchInUse = sprite_query_tile<Peep>(peep->x, peep->y, [peep](Peep* otherPeep) {
+        return otherPeep->state == PEEP_STATE_SITTING && peep->z == otherPeep->z;
+    });
+    if (benchInUse)
         return;
-    }
 
-    Peep* inner_peep;
-    uint16_t sprite_index;
-
-    FOR_ALL_STAFF (sprite_index, inner_peep)
-    {
-        if (inner_peep->staff_type != STAFF_TYPE_SECURITY)
-            continue;
-
-        if (inner_peep->x == LOCATION_NULL)
-            continue;
+    bool securityNearby = sprite_query_radius<Peep>(peep->x, peep->y, 223, [peep](Peep* inner_peep) {
+        if (inner_peep->type != PEEP_TYPE_STAFF || inner_peep->staff_type != STAFF_TYPE_SECURITY)
+            return false;
 
         int32_t x_diff = abs(inner_peep->x - peep->x);
         int32_t y_diff = abs(inner_peep->y - peep->y);
-
-        if (std::max(x_diff, y_diff) < 224)
-            return;
-    }
+        return std::max(x_diff, y_diff) < 224;
+    });
+    if (securityNearby)
+        return;
 
     tileElement->AsPath()->SetIsBroken(true);
 
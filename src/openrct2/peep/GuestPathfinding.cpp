@@ -16,7 +16,14 @@
 #include "../world/Footpath.h"
 #include "Peep.h"
 
+#include <algorithm>
+#include <bitset>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 static bool _peepPathFindIsStaff;
 static int8_t _peepPathFindNumJunctions;
@@ -257,9 +264,51 @@ static uint8_t footpath_element_next_in_direction(TileCoordsXYZ loc, PathElement
     return PATH_SEARCH_FAILED;
 }
 
+/* The junction graph of the footpaths.
+ * A segment is the run of thin path tiles from a tile edge up to the next
+ * junction, wide path, dead end or destination, as walked by
+ * footpath_element_destination_in_direction. Segments are walked on first use
+ * and kept until a path near one of their tiles changes, the junctions at
+ * their ends link them into a graph. */
+struct PathSegment
+{
+    // The tile the segment ends on, for junctions and wide paths the path height.
+    TileCoordsXYZ End;
+    // Direction of the last step, for PATH_SEARCH_LIMIT_REACHED the direction to continue in.
+    Direction EndDirection;
+    uint8_t Result;
+    uint8_t Length;
+    ride_id_t RideIndex;
+};
+
+// Segments are indexed by the blocks of tiles they pass through to drop them when paths change.
+static constexpr int32_t PATH_SEGMENT_BLOCK_SHIFT = 3;
+static constexpr int32_t PATH_SEGMENT_BLOCKS_PER_ROW = MAXIMUM_MAP_SIZE_TECHNICAL >> PATH_SEGMENT_BLOCK_SHIFT;
+
+static std::unordered_map<uint32_t, PathSegment> _pathSegments;
+static std::vector<uint32_t> _pathSegmentBlocks[PATH_SEGMENT_BLOCKS_PER_ROW * PATH_SEGMENT_BLOCKS_PER_ROW];
+
+static uint32_t path_segment_get_key(const TileCoordsXYZ& loc, Direction direction)
+{
+    // No entry signs only apply to guests.
+    return loc.x | (loc.y << 8) | (loc.z << 16) | (direction << 24) | (_peepPathFindIsStaff ? (1 << 26) : 0);
+}
+
+static void path_segment_add_block(std::vector<uint32_t>& blocks, const TileCoordsXY& loc)
+{
+    if (loc.x < 0 || loc.y < 0 || loc.x >= MAXIMUM_MAP_SIZE_TECHNICAL || loc.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    uint32_t block = (loc.x >> PATH_SEGMENT_BLOCK_SHIFT) + (loc.y >> PATH_SEGMENT_BLOCK_SHIFT) * PATH_SEGMENT_BLOCKS_PER_ROW;
+    if (std::find(blocks.begin(), blocks.end(), block) == blocks.end())
+    {
+        blocks.push_back(block);
+    }
+}
+
 /**
  *
- * Returns:
+ * Returns the result of the segment in Result:
  *   0 - PATH_SEARCH_DEAD_END (path is a dead end, i.e. < 2 edges)
  *   1 - PATH_SEARCH_WIDE (path with wide flag set)
  *   3 - PATH_SEARCH_JUNCTION (path is a junction, i.e. > 2 edges)
@@ -269,105 +318,173 @@ static uint8_t footpath_element_next_in_direction(TileCoordsXYZ loc, PathElement
  *   8 - PATH_SEARCH_SHOP_ENTRANCE (map element is a shop entrance)
  *   9 - PATH_SEARCH_LIMIT_REACHED (search limit reached without reaching path end)
  *   12 - PATH_SEARCH_FAILED (no path element found)
- * For return values 5, 6 & 8 the rideIndex is stored in outRideIndex.
+ * For results 5, 6 & 8 the ride index is stored in RideIndex.
  *
  *  rct2: 0x006949B9
- *
- * This is the recursive portion of footpath_element_destination_in_direction().
  */
-static uint8_t footpath_element_dest_in_dir(
-    TileCoordsXYZ loc, Direction chosenDirection, ride_id_t* outRideIndex, int32_t level)
+static PathSegment path_segment_walk(TileCoordsXYZ loc, Direction chosenDirection, std::vector<uint32_t>& blocks)
 {
-    TileElement* tileElement;
-    Direction direction;
-
-    if (level > 25)
-        return PATH_SEARCH_LIMIT_REACHED;
+    PathSegment segment = {};
+    segment.RideIndex = RIDE_ID_NULL;
+    path_segment_add_block(blocks, { loc.x, loc.y });
 
-    loc += TileDirectionDelta[chosenDirection];
-    tileElement = map_get_first_element_at(loc.x, loc.y);
-    if (tileElement == nullptr)
-    {
-        return PATH_SEARCH_FAILED;
-    }
-    do
+    for (int32_t level = 0;; level++)
     {
-        if (tileElement->IsGhost())
-            continue;
+        segment.End = loc;
+        segment.EndDirection = chosenDirection;
+        segment.Length = level;
+        if (level > 25)
+        {
+            segment.Result = PATH_SEARCH_LIMIT_REACHED;
+            return segment;
+        }
 
-        switch (tileElement->GetType())
+        loc += TileDirectionDelta[chosenDirection];
+        segment.End = loc;
+        segment.Length = level + 1;
+        path_segment_add_block(blocks, { loc.x, loc.y });
+
+        TileElement* tileElement = map_get_first_element_at(loc.x, loc.y);
+        if (tileElement == nullptr)
         {
-            case TILE_ELEMENT_TYPE_TRACK:
+            segment.Result = PATH_SEARCH_FAILED;
+            return segment;
+        }
+
+        bool continues = false;
+        do
+        {
+            if (tileElement->IsGhost())
+                continue;
+
+            switch (tileElement->GetType())
             {
-                if (loc.z != tileElement->base_height)
-                    continue;
-                ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
-                auto ride = get_ride(rideIndex);
-                if (ride != nullptr && ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP))
-                {
-                    *outRideIndex = rideIndex;
-                    return PATH_SEARCH_SHOP_ENTRANCE;
-                }
-            }
-            break;
-            case TILE_ELEMENT_TYPE_ENTRANCE:
-                if (loc.z != tileElement->base_height)
-                    continue;
-                switch (tileElement->AsEntrance()->GetEntranceType())
+                case TILE_ELEMENT_TYPE_TRACK:
                 {
-                    case ENTRANCE_TYPE_RIDE_ENTRANCE:
-                        direction = tileElement->GetDirection();
-                        if (direction == chosenDirection)
-                        {
-                            *outRideIndex = tileElement->AsEntrance()->GetRideIndex();
-                            return PATH_SEARCH_RIDE_ENTRANCE;
-                        }
-                        break;
-                    case ENTRANCE_TYPE_RIDE_EXIT:
-                        direction = tileElement->GetDirection();
-                        if (direction == chosenDirection)
-                        {
-                            *outRideIndex = tileElement->AsEntrance()->GetRideIndex();
-                            return PATH_SEARCH_RIDE_EXIT;
-                        }
-                        break;
-                    case ENTRANCE_TYPE_PARK_ENTRANCE:
-                        return PATH_SEARCH_PARK_EXIT;
+                    if (loc.z != tileElement->base_height)
+                        continue;
+                    ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
+                    auto ride = get_ride(rideIndex);
+                    if (ride != nullptr && ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP))
+                    {
+                        segment.RideIndex = rideIndex;
+                        segment.Result = PATH_SEARCH_SHOP_ENTRANCE;
+                        return segment;
+                    }
                 }
                 break;
-            case TILE_ELEMENT_TYPE_PATH:
-                if (!is_valid_path_z_and_direction(tileElement, loc.z, chosenDirection))
-                    continue;
-                if (tileElement->AsPath()->IsWide())
-                    return PATH_SEARCH_WIDE;
-
-                uint8_t edges = path_get_permitted_edges(tileElement->AsPath());
-                edges &= ~(1 << direction_reverse(chosenDirection));
-                loc.z = tileElement->base_height;
-
-                for (Direction dir : ALL_DIRECTIONS)
+                case TILE_ELEMENT_TYPE_ENTRANCE:
+                    if (loc.z != tileElement->base_height)
+                        continue;
+                    switch (tileElement->AsEntrance()->GetEntranceType())
+                    {
+                        case ENTRANCE_TYPE_RIDE_ENTRANCE:
+                            if (tileElement->GetDirection() == chosenDirection)
+                            {
+                                segment.RideIndex = tileElement->AsEntrance()->GetRideIndex();
+                                segment.Result = PATH_SEARCH_RIDE_ENTRANCE;
+                                return segment;
+                            }
+                            break;
+                        case ENTRANCE_TYPE_RIDE_EXIT:
+                            if (tileElement->GetDirection() == chosenDirection)
+                            {
+                                segment.RideIndex = tileElement->AsEntrance()->GetRideIndex();
+                                segment.Result = PATH_SEARCH_RIDE_EXIT;
+                                return segment;
+                            }
+                            break;
+                        case ENTRANCE_TYPE_PARK_ENTRANCE:
+                            segment.Result = PATH_SEARCH_PARK_EXIT;
+                            return segment;
+                    }
+                    break;
+                case TILE_ELEMENT_TYPE_PATH:
                 {
-                    if (!(edges & (1 << dir)))
+                    if (!is_valid_path_z_and_direction(tileElement, loc.z, chosenDirection))
                         continue;
 
-                    edges &= ~(1 << dir);
-                    if (edges != 0)
-                        return PATH_SEARCH_JUNCTION;
+                    segment.End.z = tileElement->base_height;
+                    if (tileElement->AsPath()->IsWide())
+                    {
+                        segment.Result = PATH_SEARCH_WIDE;
+                        return segment;
+                    }
+
+                    uint8_t edges = path_get_permitted_edges(tileElement->AsPath());
+                    edges &= ~(1 << direction_reverse(chosenDirection));
+                    loc.z = tileElement->base_height;
 
-                    if (tileElement->AsPath()->IsSloped())
+                    int32_t dir = bitscanforward(edges);
+                    if (dir == -1)
                     {
-                        if (tileElement->AsPath()->GetSlopeDirection() == dir)
-                        {
-                            loc.z += 2;
-                        }
+                        segment.Result = PATH_SEARCH_DEAD_END;
+                        return segment;
+                    }
+                    if (edges & ~(1 << dir))
+                    {
+                        segment.Result = PATH_SEARCH_JUNCTION;
+                        return segment;
+                    }
+
+                    if (tileElement->AsPath()->IsSloped() && tileElement->AsPath()->GetSlopeDirection() == dir)
+                    {
+                        loc.z += 2;
                     }
-                    return footpath_element_dest_in_dir(loc, dir, outRideIndex, level + 1);
+                    chosenDirection = dir;
+                    continues = true;
                 }
-                return PATH_SEARCH_DEAD_END;
+                break;
+            }
+        } while (!continues && !(tileElement++)->IsLastForTile());
+
+        if (!continues)
+        {
+            segment.Result = PATH_SEARCH_FAILED;
+            return segment;
         }
-    } while (!(tileElement++)->IsLastForTile());
+    }
+}
 
-    return PATH_SEARCH_FAILED;
+/**
+ * Gets the segment starting at loc (the height after any slope of the path) in the given direction,
+ * walking it if it is not known yet.
+ */
+static const PathSegment& path_segment_get(const TileCoordsXYZ& loc, Direction direction)
+{
+    uint32_t key = path_segment_get_key(loc, direction);
+    auto it = _pathSegments.find(key);
+    if (it != _pathSegments.end())
+        return it->second;
+
+    std::vector<uint32_t> blocks;
+    auto segment = path_segment_walk(loc, direction, blocks);
+    for (auto block : blocks)
+    {
+        _pathSegmentBlocks[block].push_back(key);
+    }
+    return _pathSegments.emplace(key, segment).first->second;
+}
+
+static void path_segment_invalidate(int32_t tileX, int32_t tileY)
+{
+    int32_t firstX = std::max(tileX - 2, 0) >> PATH_SEGMENT_BLOCK_SHIFT;
+    int32_t firstY = std::max(tileY - 2, 0) >> PATH_SEGMENT_BLOCK_SHIFT;
+    int32_t lastX = std::min(tileX + 2, MAXIMUM_MAP_SIZE_TECHNICAL - 1) >> PATH_SEGMENT_BLOCK_SHIFT;
+    int32_t lastY = std::min(tileY + 2, MAXIMUM_MAP_SIZE_TECHNICAL - 1) >> PATH_SEGMENT_BLOCK_SHIFT;
+    for (int32_t y = firstY; y <= lastY; y++)
+    {
+        for (int32_t x = firstX; x <= lastX; x++)
+        {
+            // Keys can also be listed in other blocks, erasing them twice is harmless.
+            auto& keys = _pathSegmentBlocks[x + y * PATH_SEGMENT_BLOCKS_PER_ROW];
+            for (auto key : keys)
+            {
+                _pathSegments.erase(key);
+            }
+            keys.clear();
+        }
+    }
 }
 
 /**
@@ -404,7 +521,16 @@ static uint8_t footpath_element_destination_in_direction(
         }
     }
 
-    return footpath_element_dest_in_dir(loc, chosenDirection, outRideIndex, 0);
+    const auto& segment = path_segment_get(loc, chosenDirection);
+    switch (segment.Result)
+    {
+        case PATH_SEARCH_RIDE_ENTRANCE:
+        case PATH_SEARCH_RIDE_EXIT:
+        case PATH_SEARCH_SHOP_ENTRANCE:
+            *outRideIndex = segment.RideIndex;
+            break;
+    }
+    return segment.Result;
 }
 
 /**
@@ -1534,6 +1660,408 @@ Direction peep_pathfind_choose_direction(TileCoordsXYZ loc, Peep* peep)
     return chosen_edge;
 }
 
+/* Distance fields for guests heading to a ride or leaving the park.
+ * A field holds the number of steps from every path tile (and height) to a
+ * goal, taking the same steps as peep_pathfind_heuristic_search: ghosts are
+ * ignored and wide paths and queues of other rides end a route. Fields are
+ * built on first use by searching back from the goal and dropped as soon as
+ * the paths near any of their tiles change, so a guest can take the shortest
+ * direction at each junction without searching. */
+static constexpr size_t PATH_DISTANCE_MAX_FIELDS = 256;
+
+struct PathDistanceField
+{
+    uint64_t LastUsed;
+    std::unordered_map<uint32_t, uint16_t> Distances;
+    // The tiles holding the goal or a path with a distance.
+    std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> Tiles;
+};
+
+struct PathDistanceNode
+{
+    PathElement* FirstPath;
+    uint8_t Edges;
+    bool CanPass;
+};
+
+static std::unordered_map<uint32_t, std::unique_ptr<PathDistanceField>> _pathDistanceFields;
+static uint64_t _pathDistanceUseCount;
+
+static uint32_t path_distance_get_key(const TileCoordsXYZ& loc)
+{
+    return loc.x | (loc.y << 8) | (loc.z << 16);
+}
+
+static bool path_distance_is_foreign_queue(PathElement* pathElement, ride_id_t queueRideIndex)
+{
+    return pathElement->IsQueue() && pathElement->GetRideIndex() != queueRideIndex && pathElement->GetRideIndex() != 0xFF
+        && bitcount(pathElement->GetEdges()) == 2;
+}
+
+/**
+ * Merges the (non ghost) path elements at the given height as peep_pathfind_choose_direction does.
+ */
+static PathDistanceNode path_distance_get_node(const TileCoordsXYZ& loc, ride_id_t queueRideIndex)
+{
+    PathDistanceNode node = {};
+    TileElement* tileElement = map_get_first_element_at(loc.x, loc.y);
+    if (tileElement == nullptr)
+        return node;
+
+    do
+    {
+        if (tileElement->IsGhost())
+            continue;
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (tileElement->base_height != loc.z)
+            continue;
+
+        PathElement* pathElement = tileElement->AsPath();
+        if (node.FirstPath == nullptr)
+        {
+            node.FirstPath = pathElement;
+        }
+        node.Edges |= path_get_permitted_edges(pathElement);
+        if (!pathElement->IsWide() && !path_distance_is_foreign_queue(pathElement, queueRideIndex))
+        {
+            node.CanPass = true;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return node;
+}
+
+static int32_t path_distance_get_step_height(const TileCoordsXYZ& loc, const PathDistanceNode& node, Direction direction)
+{
+    if (node.FirstPath->IsSloped() && node.FirstPath->GetSlopeDirection() == direction)
+    {
+        return loc.z + 2;
+    }
+    return loc.z;
+}
+
+/**
+ * Checks if a step in the given direction at the given height ends on loc, either a path at that
+ * height or, for the goal, anything that peep_pathfind_heuristic_search accepts as the goal.
+ */
+static bool path_distance_arrives_at(const TileCoordsXYZ& loc, int32_t height, Direction direction, bool isGoal)
+{
+    TileElement* tileElement = map_get_first_element_at(loc.x, loc.y);
+    if (tileElement == nullptr)
+        return false;
+
+    do
+    {
+        if (tileElement->IsGhost())
+            continue;
+
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+                if (tileElement->base_height == loc.z && is_valid_path_z_and_direction(tileElement, height, direction))
+                    return true;
+                break;
+            case TILE_ELEMENT_TYPE_TRACK:
+                if (isGoal && height == loc.z && tileElement->base_height == height)
+                {
+                    auto ride = get_ride(tileElement->AsTrack()->GetRideIndex());
+                    if (ride != nullptr && ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP))
+                        return true;
+                }
+                break;
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+                if (isGoal && height == loc.z && tileElement->base_height == height)
+                {
+                    switch (tileElement->AsEntrance()->GetEntranceType())
+                    {
+                        case ENTRANCE_TYPE_RIDE_ENTRANCE:
+                        case ENTRANCE_TYPE_RIDE_EXIT:
+                            if (tileElement->GetDirection() == direction)
+                                return true;
+                            break;
+                        case ENTRANCE_TYPE_PARK_ENTRANCE:
+                            return true;
+                    }
+                }
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return false;
+}
+
+static void path_distance_build_field(PathDistanceField& field, const TileCoordsXYZ& goal, ride_id_t queueRideIndex)
+{
+    // Distance fields are only used by guests, so no entry signs always apply.
+    _peepPathFindIsStaff = false;
+
+    field.Tiles.set(goal.x + goal.y * MAXIMUM_MAP_SIZE_TECHNICAL);
+
+    // Breadth first search back from the goal, every path is added with its distance when first reached.
+    std::vector<TileCoordsXYZ> queue = { goal };
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        const TileCoordsXYZ loc = queue[i];
+        const bool isGoal = i == 0;
+        const uint16_t distance = isGoal ? 0 : field.Distances[path_distance_get_key(loc)];
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            // Look for paths on the tile behind that step onto loc in this direction.
+            TileCoordsXY fromTile = { loc.x - TileDirectionDelta[direction].x, loc.y - TileDirectionDelta[direction].y };
+            if (fromTile.x < 0 || fromTile.y < 0 || fromTile.x >= MAXIMUM_MAP_SIZE_TECHNICAL
+                || fromTile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+                continue;
+
+            TileElement* tileElement = map_get_first_element_at(fromTile.x, fromTile.y);
+            if (tileElement == nullptr)
+                continue;
+
+            do
+            {
+                if (tileElement->IsGhost())
+                    continue;
+                if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+                    continue;
+                if (abs(tileElement->base_height - loc.z) > 2)
+                    continue;
+
+                TileCoordsXYZ from = { fromTile.x, fromTile.y, tileElement->base_height };
+                if (from == goal || field.Distances.count(path_distance_get_key(from)) != 0)
+                    continue;
+
+                auto node = path_distance_get_node(from, queueRideIndex);
+                if (!node.CanPass || !(node.Edges & (1 << direction)))
+                    continue;
+                if (!path_distance_arrives_at(loc, path_distance_get_step_height(from, node, direction), direction, isGoal))
+                    continue;
+
+                field.Distances[path_distance_get_key(from)] = distance + 1;
+                field.Tiles.set(from.x + from.y * MAXIMUM_MAP_SIZE_TECHNICAL);
+                queue.push_back(from);
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+}
+
+static const PathDistanceField& path_distance_get_field(const TileCoordsXYZ& goal, ride_id_t queueRideIndex)
+{
+    uint32_t key = path_distance_get_key(goal) | (queueRideIndex << 24);
+    auto& field = _pathDistanceFields[key];
+    if (field == nullptr)
+    {
+        if (_pathDistanceFields.size() > PATH_DISTANCE_MAX_FIELDS)
+        {
+            // Drop the field that has not been used for the longest time.
+            auto oldest = _pathDistanceFields.end();
+            for (auto it = _pathDistanceFields.begin(); it != _pathDistanceFields.end(); it++)
+            {
+                if (it->second == nullptr)
+                    continue;
+                if (oldest == _pathDistanceFields.end() || it->second->LastUsed < oldest->second->LastUsed)
+                {
+                    oldest = it;
+                }
+            }
+            _pathDistanceFields.erase(oldest);
+        }
+        field = std::make_unique<PathDistanceField>();
+        path_distance_build_field(*field, goal, queueRideIndex);
+    }
+    field->LastUsed = ++_pathDistanceUseCount;
+    return *field;
+}
+
+/**
+ * Chooses the direction with the shortest route from loc to gPeepPathFindGoalPosition.
+ *
+ * Returns INVALID_DIRECTION if the goal can not be reached over thin paths, the heuristic search
+ * (peep_pathfind_choose_direction) is used then. Guests only use it with gPeepPathFindUseDistanceFields
+ * set, as the routes taken differ from the heuristic search and with it the recorded replays.
+ */
+Direction peep_pathfind_choose_direction_by_distance(const TileCoordsXYZ& loc)
+{
+    const TileCoordsXYZ goal = gPeepPathFindGoalPosition;
+    auto node = path_distance_get_node(loc, gPeepPathFindQueueRideIndex);
+    if (node.FirstPath == nullptr)
+        return INVALID_DIRECTION;
+
+    const auto& field = path_distance_get_field(goal, gPeepPathFindQueueRideIndex);
+
+    Direction chosenDirection = INVALID_DIRECTION;
+    uint32_t chosenDistance = std::numeric_limits<uint32_t>::max();
+    for (Direction direction : ALL_DIRECTIONS)
+    {
+        if (!(node.Edges & (1 << direction)))
+            continue;
+
+        int32_t height = path_distance_get_step_height(loc, node, direction);
+        TileCoordsXY tile = { loc.x + TileDirectionDelta[direction].x, loc.y + TileDirectionDelta[direction].y };
+        if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+            continue;
+
+        if (tile.x == goal.x && tile.y == goal.y && path_distance_arrives_at(goal, height, direction, true))
+            return direction;
+
+        // The path stepped onto is either at the same height or sloped down.
+        for (int32_t z = height; z >= height - 2 && z >= 0; z -= 2)
+        {
+            TileCoordsXYZ next = { tile.x, tile.y, z };
+            auto it = field.Distances.find(path_distance_get_key(next));
+            if (it != field.Distances.end() && it->second < chosenDistance
+                && path_distance_arrives_at(next, height, direction, false))
+            {
+                chosenDirection = direction;
+                chosenDistance = it->second;
+            }
+        }
+    }
+    return chosenDirection;
+}
+
+void peep_pathfind_invalidate_paths(const CoordsXY& loc)
+{
+    // Path changes can affect how the neighbouring paths connect as well.
+    int32_t tileX = loc.x / 32;
+    int32_t tileY = loc.y / 32;
+    path_segment_invalidate(tileX, tileY);
+    for (auto it = _pathDistanceFields.begin(); it != _pathDistanceFields.end();)
+    {
+        bool touched = false;
+        for (int32_t y = std::max(tileY - 2, 0); y <= std::min(tileY + 2, MAXIMUM_MAP_SIZE_TECHNICAL - 1) && !touched; y++)
+        {
+            for (int32_t x = std::max(tileX - 2, 0); x <= std::min(tileX + 2, MAXIMUM_MAP_SIZE_TECHNICAL - 1); x++)
+            {
+                if (it->second->Tiles.test(x + y * MAXIMUM_MAP_SIZE_TECHNICAL))
+                {
+                    touched = true;
+                    break;
+                }
+            }
+        }
+
+        if (touched)
+            it = _pathDistanceFields.erase(it);
+        else
+            it++;
+    }
+}
+
+void peep_pathfind_reset_paths()
+{
+    _pathDistanceFields.clear();
+    _pathSegments.clear();
+    for (auto& keys : _pathSegmentBlocks)
+    {
+        keys.clear();
+    }
+}
+
+static PathElement* path_segment_get_path(const TileCoordsXYZ& loc)
+{
+    TileElement* tileElement = map_get_first_element_at(loc.x, loc.y);
+    if (tileElement == nullptr)
+        return nullptr;
+
+    do
+    {
+        if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH && !tileElement->IsGhost() && tileElement->base_height == loc.z)
+            return tileElement->AsPath();
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
+}
+
+static TileCoordsXYZ path_segment_get_start(const TileCoordsXYZ& loc, PathElement* pathElement, Direction direction)
+{
+    auto start = loc;
+    if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == direction)
+    {
+        start.z += 2;
+    }
+    return start;
+}
+
+int32_t peep_pathfind_get_segment_length(const TileCoordsXYZ& loc, Direction direction)
+{
+    auto pathElement = path_segment_get_path(loc);
+    if (pathElement == nullptr)
+        return -1;
+
+    _peepPathFindIsStaff = false;
+    int32_t length = 0;
+    auto start = path_segment_get_start(loc, pathElement, direction);
+    // A ring of thin path without junctions never ends, its length is capped.
+    for (int32_t i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL; i++)
+    {
+        const auto& segment = path_segment_get(start, direction);
+        length += segment.Length;
+        if (segment.Result != PATH_SEARCH_LIMIT_REACHED)
+            break;
+
+        start = segment.End;
+        direction = segment.EndDirection;
+    }
+    return length;
+}
+
+std::vector<ride_id_t> peep_pathfind_get_reachable_rides(const TileCoordsXYZ& loc)
+{
+    std::vector<ride_id_t> rides;
+    if (path_segment_get_path(loc) == nullptr)
+        return rides;
+
+    // Walks the junction graph, segments continuing past the search limit are followed as well.
+    _peepPathFindIsStaff = false;
+    std::unordered_set<uint32_t> visited;
+    std::vector<std::pair<TileCoordsXYZ, Direction>> open;
+    auto addJunction = [&visited, &open](const TileCoordsXYZ& junctionLoc) {
+        auto pathElement = path_segment_get_path(junctionLoc);
+        if (pathElement == nullptr)
+            return;
+
+        uint8_t edges = path_get_permitted_edges(pathElement);
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (edges & (1 << direction))
+            {
+                auto start = path_segment_get_start(junctionLoc, pathElement, direction);
+                if (visited.insert(path_segment_get_key(start, direction)).second)
+                {
+                    open.emplace_back(start, direction);
+                }
+            }
+        }
+    };
+
+    addJunction(loc);
+    while (!open.empty())
+    {
+        auto [start, direction] = open.back();
+        open.pop_back();
+
+        const auto& segment = path_segment_get(start, direction);
+        switch (segment.Result)
+        {
+            case PATH_SEARCH_RIDE_ENTRANCE:
+            case PATH_SEARCH_SHOP_ENTRANCE:
+                rides.push_back(segment.RideIndex);
+                break;
+            case PATH_SEARCH_JUNCTION:
+            case PATH_SEARCH_WIDE:
+                addJunction(segment.End);
+                break;
+            case PATH_SEARCH_LIMIT_REACHED:
+                if (visited.insert(path_segment_get_key(segment.End, segment.EndDirection)).second)
+                {
+                    open.emplace_back(segment.End, segment.EndDirection);
+                }
+                break;
+        }
+    }
+
+    std::sort(rides.begin(), rides.end());
+    rides.erase(std::unique(rides.begin(), rides.end()), rides.end());
+    return rides;
+}
+
 /**
  * Gets the nearest park entrance relative to point, by using Manhattan distance.
  * @param x x coordinate of location
@@ -1695,7 +2223,12 @@ static int32_t guest_path_find_park_entrance(Peep* peep, uint8_t edges)
     pathfind_logging_enable(peep);
 #endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 
-    Direction chosenDirection = peep_pathfind_choose_direction({ peep->next_x / 32, peep->next_y / 32, peep->next_z }, peep);
+    TileCoordsXYZ loc = { peep->next_x / 32, peep->next_y / 32, peep->next_z };
+    Direction chosenDirection = INVALID_DIRECTION;
+    if (gPeepPathFindUseDistanceFields)
+        chosenDirection = peep_pathfind_choose_direction_by_distance(loc);
+    if (chosenDirection == INVALID_DIRECTION)
+        chosenDirection = peep_pathfind_choose_direction(loc, peep);
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
     pathfind_logging_disable();
@@ -2133,7 +2666,12 @@ int32_t guest_path_finding(Guest* peep)
     gPeepPathFindGoalPosition = loc;
     gPeepPathFindIgnoreForeignQueues = true;
 
-    direction = peep_pathfind_choose_direction({ peep->next_x / 32, peep->next_y / 32, peep->next_z }, peep);
+    loc = { peep->next_x / 32, peep->next_y / 32, peep->next_z };
+    direction = INVALID_DIRECTION;
+    if (gPeepPathFindUseDistanceFields)
+        direction = peep_pathfind_choose_direction_by_distance(loc);
+    if (direction == INVALID_DIRECTION)
+        direction = peep_pathfind_choose_direction(loc, peep);
 
     if (direction == INVALID_DIRECTION)
     {
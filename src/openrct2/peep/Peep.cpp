@@ -14,6 +14,7 @@
 #include "../Game.h"
 #include "../Input.h"
 #include "../OpenRCT2.h"
+#include "../TickProfiler.h"
 #include "../audio/AudioMixer.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
@@ -71,6 +72,7 @@ uint8_t gPeepWarningThrottle[16];
 TileCoordsXYZ gPeepPathFindGoalPosition;
 bool gPeepPathFindIgnoreForeignQueues;
 ride_id_t gPeepPathFindQueueRideIndex;
+bool gPeepPathFindUseDistanceFields;
 // uint32_t gPeepPathFindAltStationNum;
 
 static uint8_t _unk_F1AEF0;
@@ -78,7 +80,7 @@ static TileElement* _peepRideEntranceExitElement;
 
 static void* _crowdSoundChannel = nullptr;
 
-static void peep_128_tick_update(Peep* peep, int32_t index);
+static void peep_128_tick_update(Peep* peep, int32_t index, const GuestTick128Batch& batch);
 static void peep_release_balloon(Guest* peep, int16_t spawn_height);
 // clang-format off
 
@@ -411,12 +413,18 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    // Rides are not changed by peeps, so the ride data for the 128 tick update is gathered once for the whole batch
+    static GuestTick128Batch batch;
+    bool batchPrepared = false;
+
+    const auto& hotFields = sprite_hot_fields();
     spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP];
     i = 0;
     while (spriteIndex != SPRITE_INDEX_NULL)
     {
         peep = &(get_sprite(spriteIndex)->peep);
-        spriteIndex = peep->next;
+        spriteIndex = hotFields.Next[spriteIndex];
+        sprite_prefetch(spriteIndex);
 
         if ((uint32_t)(i & 0x7F) != (gCurrentTicks & 0x7F))
         {
@@ -424,7 +432,15 @@ void peep_update_all()
         }
         else
         {
-            peep_128_tick_update(peep, i);
+            {
+                PROFILE_TICK_NESTED(Peeps, PeepHousekeeping);
+                if (!batchPrepared)
+                {
+                    batch.Prepare();
+                    batchPrepared = true;
+                }
+                peep_128_tick_update(peep, i, batch);
+            }
             if (peep->linked_list_index == SPRITE_LIST_PEEP)
             {
                 peep->Update();
@@ -440,12 +456,12 @@ void peep_update_all()
  *  rct2: 0x0068F41A
  *  Called every 128 ticks
  */
-static void peep_128_tick_update(Peep* peep, int32_t index)
+static void peep_128_tick_update(Peep* peep, int32_t index, const GuestTick128Batch& batch)
 {
     auto guest = peep->AsGuest();
     if (guest != nullptr)
     {
-        guest->Tick128UpdateGuest(index);
+        guest->Tick128UpdateGuest(index, batch);
     }
     else
     {
@@ -1018,6 +1034,7 @@ void Peep::SetState(PeepState new_state)
 {
     peep_decrement_num_riders(this);
     state = new_state;
+    sprite_hot_fields_set_state(sprite_index, state);
     peep_window_state_update(this);
 }
 
@@ -1469,12 +1486,16 @@ void peep_applause()
  */
 void peep_update_days_in_queue()
 {
-    uint16_t sprite_index;
-    Peep* peep;
-
-    FOR_ALL_GUESTS (sprite_index, peep)
+    // Only the queuing peeps are read, the state of the others comes from the hot field copy
+    const auto& hotFields = sprite_hot_fields();
+    for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP]; spriteIndex != SPRITE_INDEX_NULL;
+         spriteIndex = hotFields.Next[spriteIndex])
     {
-        if (peep->outside_of_park == 0 && peep->state == PEEP_STATE_QUEUING)
+        if (hotFields.State[spriteIndex] != PEEP_STATE_QUEUING)
+            continue;
+
+        Peep* peep = GET_PEEP(spriteIndex);
+        if (peep->type == PEEP_TYPE_GUEST && peep->outside_of_park == 0)
         {
             if (peep->days_in_queue < 255)
             {
@@ -1622,6 +1643,7 @@ Peep* Peep::Generate(const CoordsXYZ coords)
     peep->sprite_type = PEEP_SPRITE_TYPE_NORMAL;
     peep->outside_of_park = 1;
     peep->state = PEEP_STATE_FALLING;
+    sprite_hot_fields_set_state(peep->sprite_index, peep->state);
     peep->action = PEEP_ACTION_NONE_2;
     peep->special_sprite = 0;
     peep->action_sprite_image_offset = 0;
@@ -2518,6 +2540,7 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
         if (!(gParkFlags & PARK_FLAGS_PARK_OPEN))
         {
             peep->state = PEEP_STATE_LEAVING_PARK;
+            sprite_hot_fields_set_state(peep->sprite_index, peep->state);
             peep->var_37 = 1;
             decrement_guests_heading_for_park();
             peep_window_state_update(peep);
@@ -2583,6 +2606,7 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
         if (!found)
         {
             peep->state = PEEP_STATE_LEAVING_PARK;
+            sprite_hot_fields_set_state(peep->sprite_index, peep->state);
             peep->var_37 = 1;
             decrement_guests_heading_for_park();
             peep_window_state_update(peep);
@@ -2611,6 +2635,7 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
             if (entranceFee > peep->cash_in_pocket)
             {
                 peep->state = PEEP_STATE_LEAVING_PARK;
+                sprite_hot_fields_set_state(peep->sprite_index, peep->state);
                 peep->var_37 = 1;
                 decrement_guests_heading_for_park();
                 peep_window_state_update(peep);
@@ -2683,35 +2708,27 @@ static void peep_footpath_move_forward(Peep* peep, int16_t x, int16_t y, TileEle
     uint16_t crowded = 0;
     uint8_t litter_count = 0;
     uint8_t sick_count = 0;
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->generic.next_in_quadrant)
-    {
-        sprite = get_sprite(sprite_id);
-        if (sprite->generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
+    sprite_query_tile<Peep>(x, y, [&](Peep* other_peep) {
+        if (other_peep->state == PEEP_STATE_WALKING && abs(other_peep->z - peep->next_z * 8) <= 16)
         {
-            Peep* other_peep = (Peep*)sprite;
-            if (other_peep->state != PEEP_STATE_WALKING)
-                continue;
-
-            if (abs(other_peep->z - peep->next_z * 8) > 16)
-                continue;
             crowded++;
-            continue;
         }
-        else if (sprite->generic.sprite_identifier == SPRITE_IDENTIFIER_LITTER)
+        return false;
+    });
+    sprite_query_tile<rct_litter>(x, y, [&](rct_litter* litter) {
+        if (abs(litter->z - peep->next_z * 8) <= 16)
         {
-            rct_litter* litter = (rct_litter*)sprite;
-            if (abs(litter->z - peep->next_z * 8) > 16)
-                continue;
-
-            litter_count++;
-            if (litter->type != LITTER_TYPE_SICK && litter->type != LITTER_TYPE_SICK_ALT)
-                continue;
-
-            litter_count--;
-            sick_count++;
+            if (litter->type == LITTER_TYPE_SICK || litter->type == LITTER_TYPE_SICK_ALT)
+            {
+                sick_count++;
+            }
+            else
+            {
+                litter_count++;
+            }
         }
-    }
+        return false;
+    });
 
     if (crowded >= 10 && peep->state == PEEP_STATE_WALKING && (scenario_rand() & 0xFFFF) <= 21845)
     {
@@ -2860,6 +2877,7 @@ static void peep_interact_with_path(Peep* peep, int16_t x, int16_t y, TileElemen
                     peep->current_ride = rideIndex;
                     peep->current_ride_station = stationNum;
                     peep->state = PEEP_STATE_QUEUING;
+                    sprite_hot_fields_set_state(peep->sprite_index, peep->state);
                     peep->days_in_queue = 0;
                     peep_window_state_update(peep);
 
@@ -3352,6 +3370,7 @@ void peep_update_name_sort(Peep* peep)
 
 finish_peep_sort:
     // This is required at the moment because this function reorders peeps in the sprite list
+    sprite_hot_fields_rebuild();
     sprite_position_tween_reset();
 }
 
@@ -3387,6 +3406,7 @@ void peep_sort()
     }
     // Make sure the first peep is set
     gSpriteListHead[SPRITE_LIST_PEEP] = peep_list[0];
+    sprite_hot_fields_rebuild();
 
     free(peep_list);
 
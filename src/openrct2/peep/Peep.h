@@ -19,6 +19,7 @@
 #include "../world/SpriteBase.h"
 
 #include <bitset>
+#include <vector>
 
 #define PEEP_MAX_THOUGHTS 5
 #define PEEP_THOUGHT_ITEM_NONE 255
@@ -739,11 +740,28 @@ private:
     void UpdatePicked();
 };
 
+/**
+ * The rides the 128 tick update of guests chooses from. Rides do not change while peeps are updated, so this is gathered
+ * once for all guests updated in the same tick instead of scanning every ride for each guest.
+ */
+struct GuestTick128Batch
+{
+    // Rides that can be seen from anywhere in the park.
+    std::bitset<MAX_RIDES> TallRides;
+    std::bitset<MAX_RIDES> FoodStalls;
+    std::bitset<MAX_RIDES> DrinkStalls;
+    std::bitset<MAX_RIDES> Toilets;
+    std::bitset<MAX_RIDES> CashMachines;
+    std::bitset<MAX_RIDES> FirstAidRooms;
+
+    void Prepare();
+};
+
 struct Guest : Peep
 {
 public:
     void UpdateGuest();
-    void Tick128UpdateGuest(int32_t index);
+    void Tick128UpdateGuest(int32_t index, const GuestTick128Batch& batch);
     bool HasItem(int32_t peepItem) const;
     bool HasFood() const;
     bool HasDrink() const;
@@ -755,7 +773,7 @@ public:
     void StopPurchaseThought(uint8_t ride_type);
     void TryGetUpFromSitting();
     void ChoseNotToGoOnRide(Ride* ride, bool peepAtRide, bool updateLastRide);
-    void PickRideToGoOn();
+    void PickRideToGoOn(const GuestTick128Batch& batch);
     void ReadMap();
     bool ShouldGoOnRide(Ride* ride, int32_t entranceNum, bool atQueue, bool thinking);
     bool ShouldGoToShop(Ride* ride, bool peepAtShop);
@@ -821,8 +839,8 @@ private:
     void GivePassingPeepsPizza(Guest* passingPeep);
     void MakePassingPeepsSick(Guest* passingPeep);
     void GivePassingPeepsIceCream(Guest* passingPeep);
-    Ride* FindBestRideToGoOn();
-    std::bitset<MAX_RIDES> FindRidesToGoOn();
+    Ride* FindBestRideToGoOn(const GuestTick128Batch& batch);
+    std::bitset<MAX_RIDES> FindRidesToGoOn(const GuestTick128Batch& batch);
 };
 
 struct Staff : Peep
@@ -954,6 +972,7 @@ extern uint8_t gPeepWarningThrottle[16];
 extern TileCoordsXYZ gPeepPathFindGoalPosition;
 extern bool gPeepPathFindIgnoreForeignQueues;
 extern ride_id_t gPeepPathFindQueueRideIndex;
+extern bool gPeepPathFindUseDistanceFields;
 
 Peep* try_get_guest(uint16_t spriteIndex);
 int32_t peep_get_staff_count();
@@ -984,7 +1003,12 @@ void peep_update_names(bool realNames);
 void guest_set_name(uint16_t spriteIndex, const char* name);
 
 Direction peep_pathfind_choose_direction(TileCoordsXYZ loc, Peep* peep);
+Direction peep_pathfind_choose_direction_by_distance(const TileCoordsXYZ& loc);
 void peep_reset_pathfind_goal(Peep* peep);
+void peep_pathfind_invalidate_paths(const CoordsXY& loc);
+void peep_pathfind_reset_paths();
+int32_t peep_pathfind_get_segment_length(const TileCoordsXYZ& loc, Direction direction);
+std::vector<ride_id_t> peep_pathfind_get_reachable_rides(const TileCoordsXYZ& loc);
 
 bool is_valid_path_z_and_direction(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
 int32_t guest_path_finding(Guest* peep);
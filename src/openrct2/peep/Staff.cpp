@@ -421,28 +421,50 @@ void staff_toggle_patrol_area(int32_t staffIndex, int32_t x, int32_t y)
  */
 static uint8_t staff_handyman_direction_to_nearest_litter(Peep* peep)
 {
+    auto getLitterDistance = [peep](const rct_litter* litter) -> uint16_t {
+        return abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
+    };
+
+    // Only litter within 0x60 on both axes can be close enough, so just those tiles are searched
     uint16_t nearestLitterDist = (uint16_t)-1;
     rct_litter* nearestLitter = nullptr;
-    rct_litter* litter = nullptr;
-
-    for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != 0xFFFF; litterIndex = litter->next)
-    {
-        litter = &get_sprite(litterIndex)->litter;
-
-        uint16_t distance = abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
-
+    bool nearestLitterTied = false;
+    sprite_query_radius<rct_litter>(peep->x, peep->y, 0x60, [&](rct_litter* litter) {
+        uint16_t distance = getLitterDistance(litter);
         if (distance < nearestLitterDist)
         {
             nearestLitterDist = distance;
             nearestLitter = litter;
+            nearestLitterTied = false;
         }
-    }
+        else if (distance == nearestLitterDist)
+        {
+            nearestLitterTied = true;
+        }
+        return false;
+    });
 
     if (nearestLitterDist > 0x60)
     {
         return 0xFF;
     }
 
+    // Ties go to the first litter in the litter list, as they always have
+    if (nearestLitterTied)
+    {
+        rct_litter* litter = nullptr;
+        for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != SPRITE_INDEX_NULL;
+             litterIndex = litter->next)
+        {
+            litter = &get_sprite(litterIndex)->litter;
+            if (getLitterDistance(litter) == nearestLitterDist)
+            {
+                nearestLitter = litter;
+                break;
+            }
+        }
+    }
+
     LocationXY16 litterTile = { static_cast<int16_t>(nearestLitter->x & 0xFFE0),
                                 static_cast<int16_t>(nearestLitter->y & 0xFFE0) };
 
@@ -1004,26 +1026,22 @@ static bool staff_path_finding_misc(Peep* peep)
  */
 static void staff_entertainer_update_nearby_peeps(Peep* peep)
 {
-    uint16_t spriteIndex;
-    Peep* guest;
-
-    FOR_ALL_GUESTS (spriteIndex, guest)
-    {
-        if (guest->x == LOCATION_NULL)
-            continue;
+    sprite_query_radius<Peep>(peep->x, peep->y, 96, [peep](Peep* guest) {
+        if (guest->type != PEEP_TYPE_GUEST)
+            return false;
 
         int16_t z_dist = abs(peep->z - guest->z);
         if (z_dist > 48)
-            continue;
+            return false;
 
         int16_t x_dist = abs(peep->x - guest->x);
         int16_t y_dist = abs(peep->y - guest->y);
 
         if (x_dist > 96)
-            continue;
+            return false;
 
         if (y_dist > 96)
-            continue;
+            return false;
 
         if (peep->state == PEEP_STATE_WALKING)
         {
@@ -1041,7 +1059,8 @@ static void staff_entertainer_update_nearby_peeps(Peep* peep)
             }
             peep->happiness_target = std::min(peep->happiness_target + 3, PEEP_MAX_HAPPINESS);
         }
-    }
+        return false;
+    });
 }
 
 /**
@@ -1792,29 +1811,21 @@ static int32_t peep_update_patrolling_find_sweeping(Peep* peep)
     if (!(peep->staff_orders & STAFF_ORDERS_SWEEPING))
         return 0;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(peep->x, peep->y);
-
-    for (rct_sprite* sprite = nullptr; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->generic.next_in_quadrant)
-    {
-        sprite = get_sprite(sprite_id);
-
-        if (sprite->generic.linked_list_index != SPRITE_LIST_LITTER)
-            continue;
-
-        uint16_t z_diff = abs(peep->z - sprite->litter.z);
+    bool foundLitter = sprite_query_tile<rct_litter>(peep->x, peep->y, [peep](rct_litter* litter) {
+        uint16_t z_diff = abs(peep->z - litter->z);
 
         if (z_diff >= 16)
-            continue;
+            return false;
 
         peep->SetState(PEEP_STATE_SWEEPING);
         peep->var_37 = 0;
-        peep->destination_x = sprite->litter.x;
-        peep->destination_y = sprite->litter.y;
+        peep->destination_x = litter->x;
+        peep->destination_y = litter->y;
         peep->destination_tolerance = 5;
-        return 1;
-    }
+        return true;
+    });
 
-    return 0;
+    return foundLitter ? 1 : 0;
 }
 
 void Staff::Tick128UpdateStaff()
@@ -2056,7 +2067,7 @@ void Staff::UpdateFixing(int32_t steps)
     {
         // Ride has broken down since Mechanic was called to inspect it.
         // Mechanic identifies the breakdown and switches to fixing it.
-        state = PEEP_STATE_FIXING;
+        SetState(PEEP_STATE_FIXING);
     }
 
     while (progressToNextSubstate)
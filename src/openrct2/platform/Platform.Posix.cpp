@@ -13,10 +13,14 @@
 #    include "Platform2.h"
 #    include "platform.h"
 
+#    include <cerrno>
 #    include <cstdlib>
 #    include <cstring>
 #    include <ctime>
 #    include <pwd.h>
+#    include <sys/resource.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
 
 namespace Platform
 {
@@ -84,6 +88,57 @@ namespace Platform
         return std::string(time);
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        struct rusage usage = {};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#    if defined(__APPLE__) && defined(__MACH__)
+        // macOS reports bytes, everyone else kilobytes.
+        return (uint64_t)usage.ru_maxrss;
+#    else
+        return (uint64_t)usage.ru_maxrss * 1024;
+#    endif
+    }
+
+    int32_t Execute(const std::string& path, const std::vector<std::string>& args, bool outputToStdErr)
+    {
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(path.c_str()));
+        for (const auto& arg : args)
+        {
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        }
+        argv.push_back(nullptr);
+
+        pid_t pid = fork();
+        if (pid == -1)
+        {
+            return -1;
+        }
+        if (pid == 0)
+        {
+            if (outputToStdErr && dup2(STDERR_FILENO, STDOUT_FILENO) == -1)
+            {
+                _exit(127);
+            }
+            execv(path.c_str(), argv.data());
+            _exit(127);
+        }
+
+        int status = 0;
+        while (waitpid(pid, &status, 0) == -1)
+        {
+            if (errno != EINTR)
+            {
+                return -1;
+            }
+        }
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
     bool IsColourTerminalSupported()
     {
         static bool hasChecked = false;
@@ -15,6 +15,7 @@
 // Then the rest
 #    include <datetimeapi.h>
 #    include <memory>
+#    include <psapi.h>
 #    include <shlobj.h>
 #    undef GetEnvironmentVariable
 
@@ -155,6 +156,65 @@ namespace Platform
         return WIN32_GetModuleFileNameW(nullptr);
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        PROCESS_MEMORY_COUNTERS counters = {};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0;
+        }
+        return counters.PeakWorkingSetSize;
+    }
+
+    static std::string QuoteArgument(const std::string& arg)
+    {
+        std::string result = "\"";
+        for (auto c : arg)
+        {
+            if (c == '"')
+            {
+                result += '\\';
+            }
+            result += c;
+        }
+        result += '"';
+        return result;
+    }
+
+    int32_t Execute(const std::string& path, const std::vector<std::string>& args, bool outputToStdErr)
+    {
+        std::string commandLine = QuoteArgument(path);
+        for (const auto& arg : args)
+        {
+            commandLine += " " + QuoteArgument(arg);
+        }
+
+        auto wCommandLine = String::ToWideChar(commandLine);
+        STARTUPINFOW startupInfo = {};
+        startupInfo.cb = sizeof(startupInfo);
+        if (outputToStdErr)
+        {
+            startupInfo.dwFlags = STARTF_USESTDHANDLES;
+            startupInfo.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+            startupInfo.hStdOutput = GetStdHandle(STD_ERROR_HANDLE);
+            startupInfo.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+        }
+        PROCESS_INFORMATION processInfo = {};
+        if (!CreateProcessW(
+                nullptr, wCommandLine.data(), nullptr, nullptr, outputToStdErr, 0, nullptr, nullptr, &startupInfo,
+                &processInfo))
+        {
+            return -1;
+        }
+
+        WaitForSingleObject(processInfo.hProcess, INFINITE);
+        DWORD exitCode = (DWORD)-1;
+        GetExitCodeProcess(processInfo.hProcess, &exitCode);
+        CloseHandle(processInfo.hThread);
+        CloseHandle(processInfo.hProcess);
+        return (int32_t)exitCode;
+    }
+
     std::string GetDocsPath()
     {
         return std::string();
@@ -13,6 +13,7 @@
 
 #include <ctime>
 #include <string>
+#include <vector>
 
 enum class SPECIAL_FOLDER
 {
@@ -33,6 +34,12 @@ namespace Platform
     std::string GetDocsPath();
     std::string GetCurrentExecutablePath();
 
+    // Peak resident memory of this process in bytes, 0 if unknown.
+    uint64_t GetPeakMemoryUsage();
+    // Runs the executable and waits for it to finish, returns its exit code or -1 if it could not be run. With
+    // outputToStdErr the standard output of the process goes to the standard error of this one.
+    int32_t Execute(const std::string& path, const std::vector<std::string>& args, bool outputToStdErr = false);
+
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__)) || defined(__FreeBSD__)
     std::string GetEnvironmentPath(const char* name);
     std::string GetHomePath();
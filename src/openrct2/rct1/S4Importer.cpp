@@ -208,6 +208,7 @@ public:
         // game_convert_strings_to_utf8();
         game_convert_news_items_to_utf8();
         map_count_remaining_land_rights();
+        map_invalidate_all_path_wide_flags();
     }
 
     bool GetDetails(scenario_index_entry* dst) override
@@ -2676,9 +2677,6 @@ private:
 
     void ClearExtraTileEntries()
     {
-        // Reset the map tile pointers
-        std::fill(std::begin(gTileElementTilePointers), std::end(gTileElementTilePointers), nullptr);
-
         // Get the first free map element
         TileElement* nextFreeTileElement = gTileElements;
         for (size_t i = 0; i < RCT1_MAX_MAP_SIZE * RCT1_MAX_MAP_SIZE; i++)
@@ -2688,47 +2686,34 @@ private:
         }
 
         TileElement* tileElement = gTileElements;
-        TileElement** tilePointer = gTileElementTilePointers;
-
-        // 128 rows of map data from RCT1 map
-        for (int32_t x = 0; x < RCT1_MAX_MAP_SIZE; x++)
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
         {
-            // Assign the first half of this row
-            for (int32_t y = 0; y < RCT1_MAX_MAP_SIZE; y++)
-            {
-                *tilePointer++ = tileElement;
-                while (!(tileElement++)->IsLastForTile())
-                    ;
-            }
-
-            // Fill the rest of the row with blank tiles
-            for (int32_t y = 0; y < RCT1_MAX_MAP_SIZE; y++)
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
             {
-                nextFreeTileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-                nextFreeTileElement->SetLastForTile(true);
-                nextFreeTileElement->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
-                nextFreeTileElement->AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
-                nextFreeTileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
-                nextFreeTileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-                nextFreeTileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
-                *tilePointer++ = nextFreeTileElement++;
+                if (x < RCT1_MAX_MAP_SIZE && y < RCT1_MAX_MAP_SIZE)
+                {
+                    // Tiles of the RCT1 map
+                    map_set_tile_elements(x, y, tileElement);
+                    while (!(tileElement++)->IsLastForTile())
+                        ;
+                }
+                else
+                {
+                    // Fill the rest of the map with blank tiles
+                    nextFreeTileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+                    nextFreeTileElement->SetLastForTile(true);
+                    nextFreeTileElement->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+                    nextFreeTileElement->AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
+                    nextFreeTileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
+                    nextFreeTileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
+                    nextFreeTileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
+                    map_set_tile_elements(x, y, nextFreeTileElement++);
+                }
             }
         }
 
-        // 128 extra rows left to fill with blank tiles
-        for (int32_t y = 0; y < 128 * 256; y++)
-        {
-            nextFreeTileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-            nextFreeTileElement->SetLastForTile(true);
-            nextFreeTileElement->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
-            nextFreeTileElement->AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
-            nextFreeTileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
-            nextFreeTileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-            nextFreeTileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
-            *tilePointer++ = nextFreeTileElement++;
-        }
-
         gNextFreeTileElement = nextFreeTileElement;
+        map_reset_tile_element_storage();
     }
 
     void FixWalls()
@@ -10,6 +10,17 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
+#include "../core/TaskScheduler.h"
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define SAWYER_USE_SSE2
+#    include <emmintrin.h>
+#endif
 
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
@@ -22,6 +33,13 @@
 // Allow chunks to be uncompressed to a maximum of 16 MiB
 constexpr size_t MAX_UNCOMPRESSED_CHUNK_SIZE = 16 * 1024 * 1024;
 
+// Size of the blocks compressed data is read in from streams that are not in memory
+constexpr size_t STREAM_BLOCK_SIZE = 64 * 1024;
+
+// Longest run an RLE code byte can describe, and the same rounded up to whole 16 byte blocks
+constexpr size_t RLE_MAX_RUN_LENGTH = 129;
+constexpr size_t RLE_MAX_BLOCK_RUN_LENGTH = 144;
+
 constexpr const char* EXCEPTION_MSG_CORRUPT_CHUNK_SIZE = "Corrupt chunk size.";
 constexpr const char* EXCEPTION_MSG_CORRUPT_RLE = "Corrupt RLE compression data.";
 constexpr const char* EXCEPTION_MSG_DESTINATION_TOO_SMALL = "Chunk data larger than allocated destination capacity.";
@@ -41,6 +59,179 @@ public:
     }
 };
 
+/**
+ * Output of an RLE decode. Dst receives the decoded data from Offset on, anything before it is dropped. Length keeps
+ * counting past the capacity, so that chunks can be truncated to their destination.
+ */
+struct RLEDecodeState
+{
+    uint8_t* Dst;
+    size_t Capacity;
+    size_t Length;
+    size_t Offset;
+};
+
+/**
+ * Drops the part of a run that comes before the offset of the state and returns how much of it that was.
+ */
+static size_t SkipRun(RLEDecodeState& state, size_t count)
+{
+    auto skipLength = std::min(count, state.Offset - std::min(state.Length, state.Offset));
+    state.Length += skipLength;
+    return skipLength;
+}
+
+static void CopyBlocks(uint8_t* dst, const uint8_t* src, size_t count)
+{
+    for (size_t i = 0; i < count; i += 16)
+    {
+#ifdef SAWYER_USE_SSE2
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_loadu_si128((const __m128i*)(src + i)));
+#else
+        std::memcpy(dst + i, src + i, 16);
+#endif
+    }
+}
+
+static void FillBlocks(uint8_t* dst, uint8_t value, size_t count)
+{
+#ifdef SAWYER_USE_SSE2
+    auto value128 = _mm_set1_epi8((char)value);
+    for (size_t i = 0; i < count; i += 16)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), value128);
+    }
+#else
+    for (size_t i = 0; i < count; i += 16)
+    {
+        std::memset(dst + i, value, 16);
+    }
+#endif
+}
+
+static void CopyRun(RLEDecodeState& state, const uint8_t* src, size_t count, size_t srcAvailable)
+{
+    auto skipLength = SkipRun(state, count);
+    src += skipLength;
+    count -= skipLength;
+    srcAvailable -= skipLength;
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto position = state.Length - state.Offset;
+    auto dstAvailable = state.Capacity - std::min(position, state.Capacity);
+    auto dst = state.Dst + position;
+    if (dstAvailable >= RLE_MAX_BLOCK_RUN_LENGTH && srcAvailable >= RLE_MAX_BLOCK_RUN_LENGTH)
+    {
+        // Copying whole blocks may write past the run, that part is overwritten by the runs that follow
+        CopyBlocks(dst, src, count);
+    }
+    else if (dstAvailable > 0)
+    {
+        std::memcpy(dst, src, std::min(count, dstAvailable));
+    }
+    state.Length += count;
+}
+
+static void FillRun(RLEDecodeState& state, uint8_t value, size_t count)
+{
+    count -= SkipRun(state, count);
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto position = state.Length - state.Offset;
+    auto dstAvailable = state.Capacity - std::min(position, state.Capacity);
+    auto dst = state.Dst + position;
+    if (dstAvailable >= RLE_MAX_BLOCK_RUN_LENGTH)
+    {
+        FillBlocks(dst, value, count);
+    }
+    else if (dstAvailable > 0)
+    {
+        std::fill_n(dst, std::min(count, dstAvailable), value);
+    }
+    state.Length += count;
+}
+
+/**
+ * Decodes the complete RLE runs at the start of src and returns the number of bytes they take up. Decoded data beyond
+ * the capacity of the state is dropped.
+ */
+static size_t DecodeRLERuns(RLEDecodeState& state, const uint8_t* src, size_t srcLength)
+{
+    size_t i = 0;
+    while (i < srcLength)
+    {
+        uint8_t rleCodeByte = src[i];
+        if (rleCodeByte & 128)
+        {
+            if (i + 1 >= srcLength)
+            {
+                break;
+            }
+            FillRun(state, src[i + 1], 257 - rleCodeByte);
+            i += 2;
+        }
+        else
+        {
+            size_t count = rleCodeByte + 1;
+            if (i + 1 + count > srcLength)
+            {
+                break;
+            }
+            CopyRun(state, src + i + 1, count, srcLength - i - 1);
+            i += 1 + count;
+        }
+    }
+    return i;
+}
+
+/**
+ * Reverses the rotate encoding, which rotates each byte right by 1, 3, 5 and 7 bits in turn. position is where src
+ * starts within the chunk. dst and src may be the same.
+ */
+static void DecodeRotate(uint8_t* dst, const uint8_t* src, size_t length, size_t position = 0)
+{
+    size_t i = 0;
+    for (; i < length && (position + i) % 4 != 0; i++)
+    {
+        dst[i] = ror8(src[i], (uint8_t)(((position + i) % 4) * 2 + 1));
+    }
+#ifdef SAWYER_USE_SSE2
+    // Each 32 bit lane holds one period of the rotation. SSE2 only shifts 16 bit lanes, so the bits that cross into a
+    // neighbouring byte are masked off, as are the bytes that use a different rotation.
+    __m128i rightMasks[4];
+    __m128i leftMasks[4];
+    for (int32_t k = 0; k < 4; k++)
+    {
+        int32_t shift = k * 2 + 1;
+        rightMasks[k] = _mm_set1_epi32((int32_t)((0xFFu >> shift) << (k * 8)));
+        leftMasks[k] = _mm_set1_epi32((int32_t)(((0xFFu << (8 - shift)) & 0xFF) << (k * 8)));
+    }
+    for (; i + 16 <= length; i += 16)
+    {
+        auto value = _mm_loadu_si128((const __m128i*)(src + i));
+        auto result = _mm_and_si128(_mm_srli_epi16(value, 1), rightMasks[0]);
+        result = _mm_or_si128(result, _mm_and_si128(_mm_slli_epi16(value, 7), leftMasks[0]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi16(value, 3), rightMasks[1]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_slli_epi16(value, 5), leftMasks[1]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi16(value, 5), rightMasks[2]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_slli_epi16(value, 3), leftMasks[2]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi16(value, 7), rightMasks[3]));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_slli_epi16(value, 1), leftMasks[3]));
+        _mm_storeu_si128((__m128i*)(dst + i), result);
+    }
+#endif
+    for (; i < length; i++)
+    {
+        dst[i] = ror8(src[i], (uint8_t)(((position + i) % 4) * 2 + 1));
+    }
+}
+
 SawyerChunkReader::SawyerChunkReader(IStream* stream)
     : _stream(stream)
 {
@@ -78,16 +269,42 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
             case CHUNK_ENCODING_RLECOMPRESSED:
             case CHUNK_ENCODING_ROTATE:
             {
-                std::unique_ptr<uint8_t[]> compressedData(new uint8_t[header.length]);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+                // Memory streams are decoded in place
+                std::unique_ptr<uint8_t[]> compressedData;
+                auto src = (const uint8_t*)_stream->GetData();
+                if (src != nullptr)
                 {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+                    if (_stream->GetLength() - _stream->GetPosition() < header.length)
+                    {
+                        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+                    }
+                    src += _stream->GetPosition();
+                    _stream->Seek(header.length, STREAM_SEEK_CURRENT);
+                }
+                else
+                {
+                    compressedData.reset(new uint8_t[header.length]);
+                    if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+                    {
+                        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+                    }
+                    src = compressedData.get();
                 }
 
                 auto buffer = (uint8_t*)AllocateLargeTempBuffer();
-                size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
+                size_t uncompressedLength;
+                try
+                {
+                    uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, src, header);
+                }
+                catch (const std::exception&)
+                {
+                    FreeLargeTempBuffer(buffer);
+                    throw;
+                }
                 if (uncompressedLength == 0)
                 {
+                    FreeLargeTempBuffer(buffer);
                     throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
                 }
                 buffer = (uint8_t*)FinaliseLargeTempBuffer(buffer, uncompressedLength);
@@ -144,23 +361,203 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = (const uint8_t*)chunk->GetData();
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
+    ReadChunkRange(dst, 0, length);
+}
+
+void SawyerChunkReader::ReadChunkRange(void* dst, size_t offset, size_t length)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, length);
+        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+        auto dst8 = static_cast<uint8_t*>(dst);
+        size_t uncompressedLength;
+        switch (header.encoding)
+        {
+            case CHUNK_ENCODING_NONE:
+                uncompressedLength = ReadChunkDataRaw(dst8, offset, length, header.length);
+                break;
+            case CHUNK_ENCODING_RLE:
+                uncompressedLength = ReadChunkDataRLE(dst8, offset, length, header.length);
+                break;
+            case CHUNK_ENCODING_ROTATE:
+                uncompressedLength = ReadChunkDataRaw(dst8, offset, length, header.length);
+                if (uncompressedLength > offset)
+                {
+                    DecodeRotate(dst8, dst8, std::min(uncompressedLength - offset, length), offset);
+                }
+                break;
+            case CHUNK_ENCODING_RLECOMPRESSED:
+            {
+                // The repeat encoding refers back to earlier output, so it is decoded into a buffer as before
+                _stream->SetPosition(originalPosition);
+                auto chunk = ReadChunk();
+                uncompressedLength = chunk->GetLength();
+                if (uncompressedLength > offset)
+                {
+                    auto data = (const uint8_t*)chunk->GetData();
+                    std::memcpy(dst, data + offset, std::min(uncompressedLength - offset, length));
+                }
+                break;
+            }
+            default:
+                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+        }
+        if (uncompressedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+        auto rangeLength = uncompressedLength - std::min(uncompressedLength, offset);
+        if (rangeLength < length)
+        {
+            std::fill_n(dst8 + rangeLength, length - rangeLength, 0x00);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+void SawyerChunkReader::ReadChunks(const std::vector<SawyerChunkDestination>& destinations)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        // Locate the chunks without decoding them
+        std::vector<size_t> chunkOffsets;
+        chunkOffsets.reserve(destinations.size() + 1);
+        for (size_t i = 0; i < destinations.size(); i++)
+        {
+            chunkOffsets.push_back(_stream->GetPosition() - originalPosition);
+            auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+            if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE
+                || _stream->GetLength() - _stream->GetPosition() < header.length)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            _stream->Seek(header.length, STREAM_SEEK_CURRENT);
+        }
+        chunkOffsets.push_back(_stream->GetPosition() - originalPosition);
+
+        // Every task needs its own stream, so read the chunks into memory unless they already are
+        std::vector<uint8_t> streamData;
+        auto data = (const uint8_t*)_stream->GetData();
+        if (data != nullptr)
+        {
+            data += originalPosition;
+        }
+        else
+        {
+            streamData.resize(chunkOffsets.back());
+            _stream->SetPosition(originalPosition);
+            _stream->Read(streamData.data(), streamData.size());
+            data = streamData.data();
+        }
+
+        std::vector<std::exception_ptr> errors(destinations.size());
+        OpenRCT2::ParallelFor(0, destinations.size(), 1, [&](size_t i) {
+            try
+            {
+                MemoryStream chunkStream(data + chunkOffsets[i], chunkOffsets[i + 1] - chunkOffsets[i]);
+                SawyerChunkReader(&chunkStream).ReadChunk(destinations[i].Data, destinations[i].Length);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (const auto& error : errors)
+        {
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+size_t SawyerChunkReader::ReadChunkDataRaw(uint8_t* dst, size_t offset, size_t dstCapacity, size_t srcLength)
+{
+    if (_stream->GetLength() - _stream->GetPosition() < srcLength)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    }
+    auto skipLength = std::min(srcLength, offset);
+    auto readLength = std::min(srcLength - skipLength, dstCapacity);
+    _stream->Seek(skipLength, STREAM_SEEK_CURRENT);
+    if (_stream->TryRead(dst, readLength) != readLength)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    }
+    _stream->Seek(srcLength - skipLength - readLength, STREAM_SEEK_CURRENT);
+    return srcLength;
+}
+
+size_t SawyerChunkReader::ReadChunkDataRLE(uint8_t* dst, size_t offset, size_t dstCapacity, size_t srcLength)
+{
+    RLEDecodeState state{ dst, dstCapacity, 0, offset };
+    size_t unusedLength;
+
+    auto streamData = (const uint8_t*)_stream->GetData();
+    if (streamData != nullptr)
+    {
+        // Memory streams are decoded in place
+        if (_stream->GetLength() - _stream->GetPosition() < srcLength)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+        }
+        auto src = streamData + _stream->GetPosition();
+        unusedLength = srcLength - DecodeRLERuns(state, src, srcLength);
+        _stream->Seek(srcLength, STREAM_SEEK_CURRENT);
     }
     else
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        // Other streams are read in blocks, a run cut off at the end of a block is moved to the start of the next one
+        std::vector<uint8_t> block(STREAM_BLOCK_SIZE + RLE_MAX_RUN_LENGTH);
+        size_t remainingLength = srcLength;
+        unusedLength = 0;
+        while (remainingLength > 0)
         {
-            auto offset = (uint8_t*)dst + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            auto readLength = std::min(remainingLength, block.size() - unusedLength);
+            if (_stream->TryRead(block.data() + unusedLength, readLength) != readLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            remainingLength -= readLength;
+
+            auto blockLength = unusedLength + readLength;
+            auto usedLength = DecodeRLERuns(state, block.data(), blockLength);
+            unusedLength = blockLength - usedLength;
+            std::memmove(block.data(), block.data() + usedLength, unusedLength);
+
+            if (state.Length > MAX_UNCOMPRESSED_CHUNK_SIZE)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+            }
         }
     }
+
+    if (unusedLength != 0)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+    }
+    if (state.Length > MAX_UNCOMPRESSED_CHUNK_SIZE)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+    }
+    return state.Length;
 }
 
 size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header)
@@ -202,50 +599,17 @@ size_t SawyerChunkReader::DecodeChunkRLERepeat(void* dst, size_t dstCapacity, co
 
 size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    auto dstEnd = dst8 + dstCapacity;
-    for (size_t i = 0; i < srcLength; i++)
+    RLEDecodeState state{ static_cast<uint8_t*>(dst), dstCapacity, 0, 0 };
+    auto usedLength = DecodeRLERuns(state, static_cast<const uint8_t*>(src), srcLength);
+    if (usedLength != srcLength)
     {
-        uint8_t rleCodeByte = src8[i];
-        if (rleCodeByte & 128)
-        {
-            i++;
-            size_t count = 257 - rleCodeByte;
-
-            if (i >= srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if (dst8 + count > dstEnd)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
-            }
-
-            std::fill_n(dst8, count, src8[i]);
-            dst8 += count;
-        }
-        else
-        {
-            if (i + 1 >= srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if (dst8 + rleCodeByte + 1 > dstEnd)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
-            }
-            if (i + 1 + rleCodeByte + 1 > srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-
-            std::memcpy(dst8, src8 + i + 1, rleCodeByte + 1);
-            dst8 += rleCodeByte + 1;
-            i += rleCodeByte + 1;
-        }
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
     }
-    return (uintptr_t)dst8 - (uintptr_t)dst;
+    if (state.Length > dstCapacity)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+    }
+    return state.Length;
 }
 
 size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
@@ -283,14 +647,7 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
         throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
     }
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        dst8[i] = ror8(src8[i], code);
-        code = (code + 2) % 8;
-    }
+    DecodeRotate(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src), srcLength);
     return srcLength;
 }
 
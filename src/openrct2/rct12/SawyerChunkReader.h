@@ -14,9 +14,19 @@
 #include "SawyerChunk.h"
 
 #include <memory>
+#include <vector>
 
 interface IStream;
 
+/**
+ * Where ReadChunks decodes a chunk to, see ReadChunk(void*, size_t).
+ */
+struct SawyerChunkDestination
+{
+    void* Data;
+    size_t Length;
+};
+
 /**
  * Reads sawyer encoding chunks from a data stream. This can be used to read
  * SC6, SV6 and RCT2 objects.
@@ -46,8 +56,9 @@ public:
     std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
     /**
-     * Reads the next chunk from the stream and copies it directly to the
-     * destination buffer. If the chunk is larger than length, only length
+     * Reads the next chunk from the stream and decodes it directly into the
+     * destination buffer, without any intermediate buffers except for
+     * RLECOMPRESSED chunks. If the chunk is larger than length, only length
      * is copied. If the chunk is smaller than length, the remaining space
      * is padded with zero.
      * @param dst The destination buffer.
@@ -55,6 +66,20 @@ public:
      */
     void ReadChunk(void* dst, size_t length);
 
+    /**
+     * As above but only the decoded data from offset to offset + length is
+     * copied, the data before it is decoded without being stored.
+     */
+    void ReadChunkRange(void* dst, size_t offset, size_t length);
+
+    /**
+     * Reads the next chunks from the stream into the given destinations. The
+     * chunk boundaries are located first and the chunks are then decoded
+     * concurrently. If any chunk is invalid, the exception of the first
+     * invalid chunk is thrown and the stream is rewound.
+     */
+    void ReadChunks(const std::vector<SawyerChunkDestination>& destinations);
+
     /**
      * Reads the next chunk from the stream into a buffer returned as the
      * specified type. If the chunk is smaller than the size of the type
@@ -68,6 +93,9 @@ public:
     }
 
 private:
+    size_t ReadChunkDataRLE(uint8_t* dst, size_t offset, size_t dstCapacity, size_t srcLength);
+    size_t ReadChunkDataRaw(uint8_t* dst, size_t offset, size_t dstCapacity, size_t srcLength);
+
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
@@ -50,6 +50,7 @@
 #include <cstring>
 #include <functional>
 #include <iterator>
+#include <stdexcept>
 
 S6Exporter::S6Exporter()
 {
@@ -1336,24 +1337,39 @@ void S6Exporter::ExportMapAnimations()
 
 void S6Exporter::ExportTileElements()
 {
-    for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    // Tiles are spread over the tile element storage, write them out compacted in tile order.
+    uint32_t index = 0;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
-        auto src = &gTileElements[index];
-        auto dst = &_s6.tile_elements[index];
-        if (src->base_height == 0xFF)
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
         {
-            std::memcpy(dst, src, sizeof(*dst));
-        }
-        else
-        {
-            auto tileElementType = (RCT12TileElementType)src->GetType();
-            if (tileElementType == RCT12TileElementType::Corrupt || tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                std::memcpy(dst, src, sizeof(*dst));
-            else
-                ExportTileElement(dst, src);
+            auto src = map_get_first_element_at(x, y);
+            do
+            {
+                if (index >= RCT2_MAX_TILE_ELEMENTS)
+                {
+                    throw std::runtime_error("Too many tile elements to save.");
+                }
+
+                auto dst = &_s6.tile_elements[index++];
+                if (src->base_height == 0xFF)
+                {
+                    std::memcpy(dst, src, sizeof(*dst));
+                }
+                else
+                {
+                    auto tileElementType = (RCT12TileElementType)src->GetType();
+                    if (tileElementType == RCT12TileElementType::Corrupt
+                        || tileElementType == RCT12TileElementType::EightCarsCorrupt14
+                        || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
+                        std::memcpy(dst, src, sizeof(*dst));
+                    else
+                        ExportTileElement(dst, src);
+                }
+            } while (!(src++)->IsLastForTile());
         }
     }
+    std::memset(&_s6.tile_elements[index], 0, (RCT2_MAX_TILE_ELEMENTS - index) * sizeof(_s6.tile_elements[0]));
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
 }
 
@@ -1594,7 +1610,6 @@ int32_t scenario_save(const utf8* path, int32_t flags)
         window_close_construction_windows();
     }
 
-    map_reorganise_elements();
     viewport_set_saved_view();
 
     bool result = false;
@@ -53,6 +53,7 @@
 #include "../world/Surface.h"
 
 #include <algorithm>
+#include <chrono>
 
 /**
  * Class to import RollerCoaster Tycoon 2 scenarios (*.SC6) and saved games (*.SV6).
@@ -114,6 +115,7 @@ public:
             throw IOException("Invalid checksum.");
         }
 
+        auto startTime = std::chrono::high_resolution_clock::now();
         auto chunkReader = SawyerChunkReader(stream);
         chunkReader.ReadChunk(&_s6.header, sizeof(_s6.header));
 
@@ -146,27 +148,38 @@ public:
             _objectRepository.ExportPackedObject(stream);
         }
 
+        // The remaining chunks are independent of each other, so they are decoded concurrently
+        auto decodeStartTime = std::chrono::high_resolution_clock::now();
         if (isScenario)
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 2560076);
-            chunkReader.ReadChunk(&_s6.guests_in_park, 4);
-            chunkReader.ReadChunk(&_s6.last_guests_in_park, 8);
-            chunkReader.ReadChunk(&_s6.park_rating, 2);
-            chunkReader.ReadChunk(&_s6.active_research_types, 1082);
-            chunkReader.ReadChunk(&_s6.current_expenditure, 16);
-            chunkReader.ReadChunk(&_s6.park_value, 4);
-            chunkReader.ReadChunk(&_s6.completed_company_value, 483816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 2560076 },
+                { &_s6.guests_in_park, 4 },
+                { &_s6.last_guests_in_park, 8 },
+                { &_s6.park_rating, 2 },
+                { &_s6.active_research_types, 1082 },
+                { &_s6.current_expenditure, 16 },
+                { &_s6.park_value, 4 },
+                { &_s6.completed_company_value, 483816 },
+            });
         }
         else
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 3048816 },
+            });
         }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        log_verbose(
+            "Loaded park chunks in %.2f ms, of which %.2f ms decoding the map and park state",
+            std::chrono::duration<double, std::milli>(endTime - startTime).count(),
+            std::chrono::duration<double, std::milli>(endTime - decodeStartTime).count());
 
         _s6Path = path;
 
@@ -442,6 +455,7 @@ public:
         // Fix and set dynamic variables
         map_strip_ghost_flag_from_elements();
         map_update_tile_pointers();
+        map_invalidate_all_path_wide_flags();
         game_convert_strings_to_utf8();
         map_count_remaining_land_rights();
         determine_ride_entrance_and_exit_locations();
@@ -449,6 +463,10 @@ public:
         auto& park = OpenRCT2::GetContext()->GetGameState()->GetPark();
         park.Name = GetUserString(_s6.park_name);
 
+        // Sprites were written directly, the cached sprite hashes and hot fields are stale.
+        sprite_incremental_checksum_invalidate();
+        sprite_hot_fields_rebuild();
+
         // We try to fix the cycles on import, hence the 'true' parameter
         check_for_sprite_list_cycles(true);
         check_for_spatial_index_cycles(true);
@@ -1148,6 +1148,7 @@ void ride_remove_peeps(Ride* ride)
 
             peep->Invalidate();
             peep->state = PEEP_STATE_FALLING;
+            sprite_hot_fields_set_state(peep->sprite_index, peep->state);
             peep->SwitchToSpecialSprite(0);
 
             peep->happiness = std::min(peep->happiness, peep->happiness_target) / 2;
@@ -5582,13 +5583,13 @@ int32_t ride_get_refund_price(const Ride* ride)
  */
 void Ride::StopGuestsQueuing()
 {
-    uint16_t spriteIndex;
-    Peep* peep;
-
-    FOR_ALL_PEEPS (spriteIndex, peep)
+    const auto& hotFields = sprite_hot_fields();
+    for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP]; spriteIndex != SPRITE_INDEX_NULL;
+         spriteIndex = hotFields.Next[spriteIndex])
     {
-        if (peep->state != PEEP_STATE_QUEUING)
+        if (hotFields.State[spriteIndex] != PEEP_STATE_QUEUING)
             continue;
+        Peep* peep = GET_PEEP(spriteIndex);
         if (peep->current_ride != id)
             continue;
 
@@ -20,6 +20,8 @@
 #include "RideData.h"
 #include "Station.h"
 #include "Track.h"
+#include "TrackData.h"
+#include "TrackDesign.h"
 
 #include <algorithm>
 #include <iterator>
@@ -71,45 +73,156 @@ struct ShelteredEights
     uint8_t TotalShelteredEighths;
 };
 
-using ride_ratings_calculation = void (*)(Ride* ride);
+using ride_ratings_calculation = void (*)(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result);
 
 RideRatingCalculationData gRideRatingsCalcData;
 
 static ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
 
-static void ride_ratings_update_state();
-static void ride_ratings_update_state_0();
-static void ride_ratings_update_state_1();
-static void ride_ratings_update_state_2();
-static void ride_ratings_update_state_3();
-static void ride_ratings_update_state_4();
-static void ride_ratings_update_state_5();
-static void ride_ratings_begin_proximity_loop();
-static void ride_ratings_calculate(Ride* ride);
-static void ride_ratings_calculate_value(Ride* ride);
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement);
+/**
+ * Where the tick by tick update reads the map and the other rides from: the live game state. RideRatingsSnapshot offers
+ * the same functions for a copy of it.
+ */
+struct RideRatingsLiveMap
+{
+    Ride* GetRide(ride_id_t rideIndex) const
+    {
+        return get_ride(rideIndex);
+    }
+
+    const TileElement* GetFirstElementAt(const TileCoordsXY& coords) const
+    {
+        return map_get_first_element_at(coords.x, coords.y);
+    }
+
+    int32_t GetSurfaceHeight(const TileCoordsXY& coords) const
+    {
+        return tile_element_height({ coords.x * 32, coords.y * 32 });
+    }
+
+    bool GetNextTrackBlock(
+        const CoordsXY& coords, const TileElement* tileElement, CoordsXY* outCoords, const TileElement** outElement) const
+    {
+        CoordsXYE input = { coords.x, coords.y, const_cast<TileElement*>(tileElement) };
+        CoordsXYE output;
+        if (!track_block_get_next(&input, &output, nullptr, nullptr))
+            return false;
+
+        *outCoords = { output.x, output.y };
+        *outElement = output.element;
+        return true;
+    }
+
+    bool GetPreviousTrackBlock(
+        const CoordsXY& coords, const TileElement* tileElement, CoordsXYZ* outCoords, const TileElement** outElement) const
+    {
+        track_begin_end trackBeginEnd;
+        if (!track_block_get_previous(coords.x, coords.y, const_cast<TileElement*>(tileElement), &trackBeginEnd))
+            return false;
+
+        *outCoords = { trackBeginEnd.begin_x, trackBeginEnd.begin_y, trackBeginEnd.begin_z };
+        *outElement = trackBeginEnd.begin_element;
+        return true;
+    }
+
+    bool HasAdjacentStation(Ride* ride) const
+    {
+        return ride_has_adjacent_station(ride);
+    }
+
+    int32_t GetAgeInMonths(const Ride& ride) const
+    {
+        return gCheatsDisableRideValueAging ? 0 : gDateMonthsElapsed - ride.build_date;
+    }
+
+    int32_t GetOpenRideCountOfType(uint8_t rideType) const
+    {
+        const auto& rideManager = GetRideManager();
+        return static_cast<int32_t>(std::count_if(rideManager.begin(), rideManager.end(), [rideType](const Ride& r) {
+            return r.status == RIDE_STATUS_OPEN && r.type == rideType;
+        }));
+    }
+};
+
+static void ride_ratings_update_state(RideRatingCalculationData& state);
+template<typename TSource> static void ride_ratings_update_track_state(RideRatingCalculationData& state, const TSource& source);
+static void ride_ratings_update_state_0(RideRatingCalculationData& state);
+template<typename TSource> static void ride_ratings_update_state_1(RideRatingCalculationData& state, const TSource& source);
+template<typename TSource> static void ride_ratings_update_state_2(RideRatingCalculationData& state, const TSource& source);
+static void ride_ratings_update_state_3(RideRatingCalculationData& state);
+template<typename TSource> static void ride_ratings_update_state_4(RideRatingCalculationData& state, const TSource& source);
+template<typename TSource> static void ride_ratings_update_state_5(RideRatingCalculationData& state, const TSource& source);
+template<typename TSource>
+static void ride_ratings_begin_proximity_loop(RideRatingCalculationData& state, const TSource& source);
+template<typename TSource>
+static RideRatingResult ride_ratings_calculate(RideRatingCalculationData& state, Ride* ride, const TSource& source);
+static void ride_ratings_calculate_value(Ride* ride, int32_t monthsOld, int32_t openRidesOfSameType, RideRatingResult& result);
+template<typename TSource>
+static void ride_ratings_score_close_proximity(
+    RideRatingCalculationData& state, const TSource& source, const TileElement* inputTileElement);
+template<typename TSource> static int32_t ride_ratings_get_scenery_score(Ride* ride, const TSource& source);
 
 static void ride_ratings_add(rating_tuple* rating, int32_t excitement, int32_t intensity, int32_t nausea);
 
 /**
- * This is a small hack function to keep calling the ride rating processor until
- * the given ride's ratings have been calculated. What ever is currently being
- * processed will be overwritten.
+ * Calculates and applies the given ride's ratings straight away, the ride currently
+ * being processed by ride_ratings_update_all is left alone.
  * Only purpose of this function currently is for testing.
  */
 void ride_ratings_update_ride(const Ride& ride)
 {
-    if (ride.status != RIDE_STATUS_CLOSED)
+    auto result = ride_ratings_evaluate(ride);
+    auto ridePtr = get_ride(ride.id);
+    if (result && ridePtr != nullptr)
     {
-        gRideRatingsCalcData.current_ride = ride.id;
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
-        while (gRideRatingsCalcData.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
-        {
-            ride_ratings_update_state();
-        }
+        ride_ratings_apply(*ridePtr, *result);
     }
 }
 
+std::optional<RideRatingResult> ride_ratings_evaluate(const Ride& ride)
+{
+    if (ride.status == RIDE_STATUS_CLOSED)
+    {
+        return std::nullopt;
+    }
+    return ride_ratings_evaluate(RideRatingsSnapshot::FromRide(ride));
+}
+
+std::optional<RideRatingResult> ride_ratings_evaluate(const RideRatingsSnapshot& snapshot)
+{
+    const auto& ride = snapshot.GetRide();
+    if (ride.status == RIDE_STATUS_CLOSED)
+    {
+        return std::nullopt;
+    }
+
+    // Runs the same states as the tick by tick update, just all of them at once.
+    RideRatingCalculationData state{};
+    state.current_ride = ride.id;
+    state.state = RIDE_RATINGS_STATE_INITIALISE;
+    while (state.state != RIDE_RATINGS_STATE_FIND_NEXT_RIDE && state.state != RIDE_RATINGS_STATE_CALCULATE)
+    {
+        ride_ratings_update_track_state(state, snapshot);
+    }
+
+    if (state.state != RIDE_RATINGS_STATE_CALCULATE)
+    {
+        return std::nullopt;
+    }
+    return ride_ratings_calculate(state, snapshot.GetRide(ride.id), snapshot);
+}
+
+void ride_ratings_apply(Ride& ride, const RideRatingResult& result)
+{
+    ride.ratings = result.Ratings;
+    ride.lifecycle_flags |= result.LifecycleFlags & (RIDE_LIFECYCLE_TESTED | RIDE_LIFECYCLE_NO_RAW_STATS);
+    ride.upkeep_cost = result.UpkeepCost;
+    ride.value = result.Value;
+    ride.unreliability_factor = result.UnreliabilityFactor;
+    ride.sheltered_eighths = result.ShelteredEighths;
+    ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
+
 /**
  *
  *  rct2: 0x006B5A2A
@@ -119,30 +232,43 @@ void ride_ratings_update_all()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
-    ride_ratings_update_state();
+    ride_ratings_update_state(gRideRatingsCalcData);
 }
 
-static void ride_ratings_update_state()
+static void ride_ratings_update_state(RideRatingCalculationData& state)
 {
-    switch (gRideRatingsCalcData.state)
+    switch (state.state)
     {
         case RIDE_RATINGS_STATE_FIND_NEXT_RIDE:
-            ride_ratings_update_state_0();
+            ride_ratings_update_state_0(state);
+            break;
+        case RIDE_RATINGS_STATE_CALCULATE:
+            ride_ratings_update_state_3(state);
+            break;
+        default:
+            ride_ratings_update_track_state(state, RideRatingsLiveMap());
             break;
+    }
+}
+
+/**
+ * The states that walk the ride's track, shared by the tick by tick update and the evaluation of snapshots.
+ */
+template<typename TSource> static void ride_ratings_update_track_state(RideRatingCalculationData& state, const TSource& source)
+{
+    switch (state.state)
+    {
         case RIDE_RATINGS_STATE_INITIALISE:
-            ride_ratings_update_state_1();
+            ride_ratings_update_state_1(state, source);
             break;
         case RIDE_RATINGS_STATE_2:
-            ride_ratings_update_state_2();
-            break;
-        case RIDE_RATINGS_STATE_CALCULATE:
-            ride_ratings_update_state_3();
+            ride_ratings_update_state_2(state, source);
             break;
         case RIDE_RATINGS_STATE_4:
-            ride_ratings_update_state_4();
+            ride_ratings_update_state_4(state, source);
             break;
         case RIDE_RATINGS_STATE_5:
-            ride_ratings_update_state_5();
+            ride_ratings_update_state_5(state, source);
             break;
     }
 }
@@ -151,9 +277,9 @@ static void ride_ratings_update_state()
  *
  *  rct2: 0x006B5A5C
  */
-static void ride_ratings_update_state_0()
+static void ride_ratings_update_state_0(RideRatingCalculationData& state)
 {
-    int32_t currentRide = gRideRatingsCalcData.current_ride;
+    int32_t currentRide = state.current_ride;
 
     currentRide++;
     if (currentRide == RIDE_ID_NULL)
@@ -164,49 +290,54 @@ static void ride_ratings_update_state_0()
     auto ride = get_ride(currentRide);
     if (ride != nullptr && ride->status != RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_INITIALISE;
+        state.state = RIDE_RATINGS_STATE_INITIALISE;
     }
-    gRideRatingsCalcData.current_ride = currentRide;
+    state.current_ride = currentRide;
 }
 
 /**
  *
  *  rct2: 0x006B5A94
  */
-static void ride_ratings_update_state_1()
+template<typename TSource> static void ride_ratings_update_state_1(RideRatingCalculationData& state, const TSource& source)
 {
-    gRideRatingsCalcData.proximity_total = 0;
+    state.proximity_total = 0;
     for (int32_t i = 0; i < PROXIMITY_COUNT; i++)
     {
-        gRideRatingsCalcData.proximity_scores[i] = 0;
+        state.proximity_scores[i] = 0;
     }
-    gRideRatingsCalcData.num_brakes = 0;
-    gRideRatingsCalcData.num_reversers = 0;
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_2;
-    gRideRatingsCalcData.station_flags = 0;
-    ride_ratings_begin_proximity_loop();
+    state.num_brakes = 0;
+    state.num_reversers = 0;
+    state.state = RIDE_RATINGS_STATE_2;
+    state.station_flags = 0;
+    ride_ratings_begin_proximity_loop(state, source);
 }
 
 /**
  *
  *  rct2: 0x006B5C66
  */
-static void ride_ratings_update_state_2()
+template<typename TSource> static void ride_ratings_update_state_2(RideRatingCalculationData& state, const TSource& source)
 {
-    const ride_id_t rideIndex = gRideRatingsCalcData.current_ride;
-    auto ride = get_ride(rideIndex);
+    const ride_id_t rideIndex = state.current_ride;
+    auto ride = source.GetRide(rideIndex);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    int32_t x = gRideRatingsCalcData.proximity_x / 32;
-    int32_t y = gRideRatingsCalcData.proximity_y / 32;
-    int32_t z = gRideRatingsCalcData.proximity_z / 8;
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    int32_t x = state.proximity_x / 32;
+    int32_t y = state.proximity_y / 32;
+    int32_t z = state.proximity_z / 8;
+    int32_t trackType = state.proximity_track_type;
 
-    TileElement* tileElement = map_get_first_element_at(x, y);
+    const TileElement* tileElement = source.GetFirstElementAt({ x, y });
+    if (tileElement == nullptr)
+    {
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        return;
+    }
     do
     {
         if (tileElement->IsGhost())
@@ -222,97 +353,97 @@ static void ride_ratings_update_state_2()
             if (trackType == TRACK_ELEM_END_STATION)
             {
                 int32_t entranceIndex = tileElement->AsTrack()->GetStationIndex();
-                gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                state.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 if (ride_get_entrance_location(ride, entranceIndex).isNull())
                 {
-                    gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                    state.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
                 }
             }
 
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(state, source, tileElement);
 
-            CoordsXYE trackElement = {
-                /* .x = */ gRideRatingsCalcData.proximity_x,
-                /* .y = */ gRideRatingsCalcData.proximity_y,
-                /* .element = */ tileElement,
-            };
-            CoordsXYE nextTrackElement;
-            if (!track_block_get_next(&trackElement, &nextTrackElement, nullptr, nullptr))
+            CoordsXY nextCoords;
+            const TileElement* nextTileElement;
+            if (!source.GetNextTrackBlock(
+                    { state.proximity_x, state.proximity_y }, tileElement, &nextCoords, &nextTileElement))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_4;
+                state.state = RIDE_RATINGS_STATE_4;
                 return;
             }
 
-            x = nextTrackElement.x;
-            y = nextTrackElement.y;
-            z = nextTrackElement.element->base_height * 8;
-            tileElement = nextTrackElement.element;
-            if (x == gRideRatingsCalcData.proximity_start_x && y == gRideRatingsCalcData.proximity_start_y
-                && z == gRideRatingsCalcData.proximity_start_z)
+            x = nextCoords.x;
+            y = nextCoords.y;
+            z = nextTileElement->base_height * 8;
+            tileElement = nextTileElement;
+            if (x == state.proximity_start_x && y == state.proximity_start_y && z == state.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                state.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = tileElement->AsTrack()->GetTrackType();
+            state.proximity_x = x;
+            state.proximity_y = y;
+            state.proximity_z = z;
+            state.proximity_track_type = tileElement->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5E4D
  */
-static void ride_ratings_update_state_3()
+static void ride_ratings_update_state_3(RideRatingCalculationData& state)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = get_ride(state.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    ride_ratings_calculate(ride);
-    ride_ratings_calculate_value(ride);
+    ride_ratings_apply(*ride, ride_ratings_calculate(state, ride, RideRatingsLiveMap()));
 
-    window_invalidate_by_number(WC_RIDE, gRideRatingsCalcData.current_ride);
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    window_invalidate_by_number(WC_RIDE, state.current_ride);
+    state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BAB
  */
-static void ride_ratings_update_state_4()
+template<typename TSource> static void ride_ratings_update_state_4(RideRatingCalculationData& state, const TSource& source)
 {
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_5;
-    ride_ratings_begin_proximity_loop();
+    state.state = RIDE_RATINGS_STATE_5;
+    ride_ratings_begin_proximity_loop(state, source);
 }
 
 /**
  *
  *  rct2: 0x006B5D72
  */
-static void ride_ratings_update_state_5()
+template<typename TSource> static void ride_ratings_update_state_5(RideRatingCalculationData& state, const TSource& source)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = source.GetRide(state.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
-    int32_t x = gRideRatingsCalcData.proximity_x / 32;
-    int32_t y = gRideRatingsCalcData.proximity_y / 32;
-    int32_t z = gRideRatingsCalcData.proximity_z / 8;
-    int32_t trackType = gRideRatingsCalcData.proximity_track_type;
+    int32_t x = state.proximity_x / 32;
+    int32_t y = state.proximity_y / 32;
+    int32_t z = state.proximity_z / 8;
+    int32_t trackType = state.proximity_track_type;
 
-    TileElement* tileElement = map_get_first_element_at(x, y);
+    const TileElement* tileElement = source.GetFirstElementAt({ x, y });
+    if (tileElement == nullptr)
+    {
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        return;
+    }
     do
     {
         if (tileElement->IsGhost())
@@ -324,53 +455,53 @@ static void ride_ratings_update_state_5()
 
         if (trackType == 255 || trackType == tileElement->AsTrack()->GetTrackType())
         {
-            ride_ratings_score_close_proximity(tileElement);
+            ride_ratings_score_close_proximity(state, source, tileElement);
 
-            x = gRideRatingsCalcData.proximity_x;
-            y = gRideRatingsCalcData.proximity_y;
-            track_begin_end trackBeginEnd;
-            if (!track_block_get_previous(x, y, tileElement, &trackBeginEnd))
+            CoordsXYZ previousCoords;
+            const TileElement* previousTileElement;
+            if (!source.GetPreviousTrackBlock(
+                    { state.proximity_x, state.proximity_y }, tileElement, &previousCoords, &previousTileElement))
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                state.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
 
-            x = trackBeginEnd.begin_x;
-            y = trackBeginEnd.begin_y;
-            z = trackBeginEnd.begin_z;
-            if (x == gRideRatingsCalcData.proximity_start_x && y == gRideRatingsCalcData.proximity_start_y
-                && z == gRideRatingsCalcData.proximity_start_z)
+            x = previousCoords.x;
+            y = previousCoords.y;
+            z = previousCoords.z;
+            if (x == state.proximity_start_x && y == state.proximity_start_y && z == state.proximity_start_z)
             {
-                gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+                state.state = RIDE_RATINGS_STATE_CALCULATE;
                 return;
             }
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = trackBeginEnd.begin_element->AsTrack()->GetTrackType();
+            state.proximity_x = x;
+            state.proximity_y = y;
+            state.proximity_z = z;
+            state.proximity_track_type = previousTileElement->AsTrack()->GetTrackType();
             return;
         }
     } while (!(tileElement++)->IsLastForTile());
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
 /**
  *
  *  rct2: 0x006B5BB2
  */
-static void ride_ratings_begin_proximity_loop()
+template<typename TSource>
+static void ride_ratings_begin_proximity_loop(RideRatingCalculationData& state, const TSource& source)
 {
-    auto ride = get_ride(gRideRatingsCalcData.current_ride);
+    auto ride = source.GetRide(state.current_ride);
     if (ride == nullptr || ride->status == RIDE_STATUS_CLOSED)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+        state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
         return;
     }
 
     if (ride->type == RIDE_TYPE_MAZE)
     {
-        gRideRatingsCalcData.state = RIDE_RATINGS_STATE_CALCULATE;
+        state.state = RIDE_RATINGS_STATE_CALCULATE;
         return;
     }
 
@@ -378,47 +509,51 @@ static void ride_ratings_begin_proximity_loop()
     {
         if (ride->stations[i].Start.xy != RCT_XY8_UNDEFINED)
         {
-            gRideRatingsCalcData.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+            state.station_flags &= ~RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             if (ride_get_entrance_location(ride, i).isNull())
             {
-                gRideRatingsCalcData.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
+                state.station_flags |= RIDE_RATING_STATION_FLAG_NO_ENTRANCE;
             }
 
             int32_t x = ride->stations[i].Start.x * 32;
             int32_t y = ride->stations[i].Start.y * 32;
             int32_t z = ride->stations[i].Height * 8;
 
-            gRideRatingsCalcData.proximity_x = x;
-            gRideRatingsCalcData.proximity_y = y;
-            gRideRatingsCalcData.proximity_z = z;
-            gRideRatingsCalcData.proximity_track_type = 255;
-            gRideRatingsCalcData.proximity_start_x = x;
-            gRideRatingsCalcData.proximity_start_y = y;
-            gRideRatingsCalcData.proximity_start_z = z;
+            state.proximity_x = x;
+            state.proximity_y = y;
+            state.proximity_z = z;
+            state.proximity_track_type = 255;
+            state.proximity_start_x = x;
+            state.proximity_start_y = y;
+            state.proximity_start_z = z;
             return;
         }
     }
 
-    gRideRatingsCalcData.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
+    state.state = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
 
-static void proximity_score_increment(int32_t type)
+static void proximity_score_increment(RideRatingCalculationData& state, int32_t type)
 {
-    gRideRatingsCalcData.proximity_scores[type]++;
+    state.proximity_scores[type]++;
 }
 
 /**
  *
  *  rct2: 0x006B6207
  */
-static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTileElement, int32_t direction)
+template<typename TSource>
+static void ride_ratings_score_close_proximity_in_direction(
+    RideRatingCalculationData& state, const TSource& source, const TileElement* inputTileElement, int32_t direction)
 {
-    int32_t x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-    int32_t y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
+    int32_t x = state.proximity_x + CoordsDirectionDelta[direction].x;
+    int32_t y = state.proximity_y + CoordsDirectionDelta[direction].y;
     if (x < 0 || y < 0 || x >= (32 * 256) || y >= (32 * 256))
         return;
 
-    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
+    const TileElement* tileElement = source.GetFirstElementAt({ x >> 5, y >> 5 });
+    if (tileElement == nullptr)
+        return;
     do
     {
         if (tileElement->IsGhost())
@@ -427,18 +562,18 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                if (gRideRatingsCalcData.proximity_base_height <= inputTileElement->base_height)
+                if (state.proximity_base_height <= inputTileElement->base_height)
                 {
                     if (inputTileElement->clearance_height <= tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_SURFACE_SIDE_CLOSE);
+                        proximity_score_increment(state, PROXIMITY_SURFACE_SIDE_CLOSE);
                     }
                 }
                 break;
             case TILE_ELEMENT_TYPE_PATH:
                 if (abs((int32_t)inputTileElement->base_height - (int32_t)tileElement->base_height) <= 2)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_SIDE_CLOSE);
+                    proximity_score_increment(state, PROXIMITY_PATH_SIDE_CLOSE);
                 }
                 break;
             case TILE_ELEMENT_TYPE_TRACK:
@@ -446,7 +581,7 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (abs((int32_t)inputTileElement->base_height - (int32_t)tileElement->base_height) <= 2)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
+                        proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
                     }
                 }
                 break;
@@ -456,11 +591,11 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
                 {
                     if (inputTileElement->base_height > tileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_SCENERY_SIDE_ABOVE);
                     }
                     else
                     {
-                        proximity_score_increment(PROXIMITY_SCENERY_SIDE_BELOW);
+                        proximity_score_increment(state, PROXIMITY_SCENERY_SIDE_BELOW);
                     }
                 }
                 break;
@@ -468,9 +603,13 @@ static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTi
     } while (!(tileElement++)->IsLastForTile());
 }
 
-static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTileElement, int32_t x, int32_t y)
+template<typename TSource>
+static void ride_ratings_score_close_proximity_loops_helper(
+    RideRatingCalculationData& state, const TSource& source, const TileElement* inputTileElement, int32_t x, int32_t y)
 {
-    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
+    const TileElement* tileElement = source.GetFirstElementAt({ x >> 5, y >> 5 });
+    if (tileElement == nullptr)
+        return;
     do
     {
         if (tileElement->IsGhost())
@@ -483,7 +622,7 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                 int32_t zDiff = (int32_t)tileElement->base_height - (int32_t)inputTileElement->base_height;
                 if (zDiff >= 0 && zDiff <= 16)
                 {
-                    proximity_score_increment(PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
+                    proximity_score_increment(state, PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
                 }
             }
             break;
@@ -496,11 +635,11 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
                     int32_t zDiff = (int32_t)tileElement->base_height - (int32_t)inputTileElement->base_height;
                     if (zDiff >= 0 && zDiff <= 16)
                     {
-                        proximity_score_increment(PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
+                        proximity_score_increment(state, PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
                         if (tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_LEFT_VERTICAL_LOOP
                             || tileElement->AsTrack()->GetTrackType() == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
                         {
-                            proximity_score_increment(PROXIMITY_INTERSECTING_VERTICAL_LOOP);
+                            proximity_score_increment(state, PROXIMITY_INTERSECTING_VERTICAL_LOOP);
                         }
                     }
                 }
@@ -514,19 +653,21 @@ static void ride_ratings_score_close_proximity_loops_helper(TileElement* inputTi
  *
  *  rct2: 0x006B62DA
  */
-static void ride_ratings_score_close_proximity_loops(TileElement* inputTileElement)
+template<typename TSource>
+static void ride_ratings_score_close_proximity_loops(
+    RideRatingCalculationData& state, const TSource& source, const TileElement* inputTileElement)
 {
     int32_t trackType = inputTileElement->AsTrack()->GetTrackType();
     if (trackType == TRACK_ELEM_LEFT_VERTICAL_LOOP || trackType == TRACK_ELEM_RIGHT_VERTICAL_LOOP)
     {
-        int32_t x = gRideRatingsCalcData.proximity_x;
-        int32_t y = gRideRatingsCalcData.proximity_y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        int32_t x = state.proximity_x;
+        int32_t y = state.proximity_y;
+        ride_ratings_score_close_proximity_loops_helper(state, source, inputTileElement, x, y);
 
         int32_t direction = inputTileElement->GetDirection();
-        x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-        y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
-        ride_ratings_score_close_proximity_loops_helper(inputTileElement, x, y);
+        x = state.proximity_x + CoordsDirectionDelta[direction].x;
+        y = state.proximity_y + CoordsDirectionDelta[direction].y;
+        ride_ratings_score_close_proximity_loops_helper(state, source, inputTileElement, x, y);
     }
 }
 
@@ -534,17 +675,19 @@ static void ride_ratings_score_close_proximity_loops(TileElement* inputTileEleme
  *
  *  rct2: 0x006B5F9D
  */
-static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
+template<typename TSource>
+static void ride_ratings_score_close_proximity(
+    RideRatingCalculationData& state, const TSource& source, const TileElement* inputTileElement)
 {
-    if (gRideRatingsCalcData.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
+    if (state.station_flags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
     {
         return;
     }
 
-    gRideRatingsCalcData.proximity_total++;
-    int32_t x = gRideRatingsCalcData.proximity_x;
-    int32_t y = gRideRatingsCalcData.proximity_y;
-    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
+    state.proximity_total++;
+    int32_t x = state.proximity_x;
+    int32_t y = state.proximity_y;
+    const TileElement* tileElement = source.GetFirstElementAt({ x >> 5, y >> 5 });
     do
     {
         if (tileElement->IsGhost())
@@ -554,31 +697,31 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
         switch (tileElement->GetType())
         {
             case TILE_ELEMENT_TYPE_SURFACE:
-                gRideRatingsCalcData.proximity_base_height = tileElement->base_height;
-                if (tileElement->base_height * 8 == gRideRatingsCalcData.proximity_z)
+                state.proximity_base_height = tileElement->base_height;
+                if (tileElement->base_height * 8 == state.proximity_z)
                 {
-                    proximity_score_increment(PROXIMITY_SURFACE_TOUCH);
+                    proximity_score_increment(state, PROXIMITY_SURFACE_TOUCH);
                 }
                 waterHeight = tileElement->AsSurface()->GetWaterHeight();
                 if (waterHeight != 0)
                 {
                     int32_t z = waterHeight * 16;
-                    if (z <= gRideRatingsCalcData.proximity_z)
+                    if (z <= state.proximity_z)
                     {
-                        proximity_score_increment(PROXIMITY_WATER_OVER);
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        proximity_score_increment(state, PROXIMITY_WATER_OVER);
+                        if (z == state.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_TOUCH);
+                            proximity_score_increment(state, PROXIMITY_WATER_TOUCH);
                         }
                         z += 16;
-                        if (z == gRideRatingsCalcData.proximity_z)
+                        if (z == state.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_LOW);
+                            proximity_score_increment(state, PROXIMITY_WATER_LOW);
                         }
                         z += 112;
-                        if (z <= gRideRatingsCalcData.proximity_z)
+                        if (z <= state.proximity_z)
                         {
-                            proximity_score_increment(PROXIMITY_WATER_HIGH);
+                            proximity_score_increment(state, PROXIMITY_WATER_HIGH);
                         }
                     }
                 }
@@ -589,11 +732,11 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                 {
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_PATH_TOUCH_ABOVE);
                     }
                     if (tileElement->base_height == inputTileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_TOUCH_UNDER);
+                        proximity_score_increment(state, PROXIMITY_PATH_TOUCH_UNDER);
                     }
                 }
                 else
@@ -601,15 +744,15 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     // Bonus for path in first object entry
                     if (tileElement->clearance_height <= inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_OVER);
+                        proximity_score_increment(state, PROXIMITY_PATH_ZERO_OVER);
                     }
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_PATH_ZERO_TOUCH_ABOVE);
                     }
                     if (tileElement->base_height == inputTileElement->clearance_height)
                     {
-                        proximity_score_increment(PROXIMITY_PATH_ZERO_TOUCH_UNDER);
+                        proximity_score_increment(state, PROXIMITY_PATH_ZERO_TOUCH_UNDER);
                     }
                 }
                 break;
@@ -623,33 +766,33 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                     {
                         if (tileElement->base_height - inputTileElement->clearance_height <= 10)
                         {
-                            proximity_score_increment(PROXIMITY_THROUGH_VERTICAL_LOOP);
+                            proximity_score_increment(state, PROXIMITY_THROUGH_VERTICAL_LOOP);
                         }
                     }
                 }
                 if (inputTileElement->AsTrack()->GetRideIndex() != tileElement->AsTrack()->GetRideIndex())
                 {
-                    proximity_score_increment(PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
+                    proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height == tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
                     if (inputTileElement->clearance_height + 2 == tileElement->base_height)
                     {
                         if ((uint8_t)(inputTileElement->clearance_height + 10) >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
                 }
@@ -661,40 +804,40 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
                            || trackType == TRACK_ELEM_BEGIN_STATION);
                     if (tileElement->clearance_height == inputTileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (tileElement->clearance_height + 2 <= inputTileElement->base_height)
                     {
                         if (tileElement->clearance_height + 10 >= inputTileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(state, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
 
                     if (inputTileElement->clearance_height == tileElement->base_height)
                     {
-                        proximity_score_increment(PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
+                        proximity_score_increment(state, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_STATION_TOUCH_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
                     if (inputTileElement->clearance_height + 2 <= tileElement->base_height)
                     {
                         if (inputTileElement->clearance_height + 10 >= tileElement->base_height)
                         {
-                            proximity_score_increment(PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
+                            proximity_score_increment(state, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
                             {
-                                proximity_score_increment(PROXIMITY_OWN_STATION_CLOSE_ABOVE);
+                                proximity_score_increment(state, PROXIMITY_OWN_STATION_CLOSE_ABOVE);
                             }
                         }
                     }
@@ -705,42 +848,59 @@ static void ride_ratings_score_close_proximity(TileElement* inputTileElement)
     } while (!(tileElement++)->IsLastForTile());
 
     uint8_t direction = inputTileElement->GetDirection();
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction + 1) & 3);
-    ride_ratings_score_close_proximity_in_direction(inputTileElement, (direction - 1) & 3);
-    ride_ratings_score_close_proximity_loops(inputTileElement);
+    ride_ratings_score_close_proximity_in_direction(state, source, inputTileElement, (direction + 1) & 3);
+    ride_ratings_score_close_proximity_in_direction(state, source, inputTileElement, (direction - 1) & 3);
+    ride_ratings_score_close_proximity_loops(state, source, inputTileElement);
 
-    switch (gRideRatingsCalcData.proximity_track_type)
+    switch (state.proximity_track_type)
     {
         case TRACK_ELEM_BRAKES:
-            gRideRatingsCalcData.num_brakes++;
+            state.num_brakes++;
             break;
         case TRACK_ELEM_LEFT_REVERSER:
         case TRACK_ELEM_RIGHT_REVERSER:
-            gRideRatingsCalcData.num_reversers++;
+            state.num_reversers++;
             break;
     }
 }
 
-static void ride_ratings_calculate(Ride* ride)
+template<typename TSource>
+static RideRatingResult ride_ratings_calculate(RideRatingCalculationData& state, Ride* ride, const TSource& source)
 {
+    RideRatingResult result;
+    result.Ratings = ride->ratings;
+    result.LifecycleFlags = ride->lifecycle_flags;
+    result.UpkeepCost = ride->upkeep_cost;
+    result.Value = ride->value;
+    result.UnreliabilityFactor = ride->unreliability_factor;
+    result.ShelteredEighths = ride->sheltered_eighths;
+
+    // Worked out here so the calculations themselves never have to look at the map.
+    state.scenery_score = ride_ratings_get_scenery_score(ride, source);
+    state.has_adjacent_station = (ride->depart_flags & RIDE_DEPART_SYNCHRONISE_WITH_ADJACENT_STATIONS)
+        && source.HasAdjacentStation(ride);
+
     auto calcFunc = ride_ratings_get_calculate_func(ride->type);
     if (calcFunc != nullptr)
     {
-        calcFunc(ride);
+        calcFunc(state, ride, result);
     }
 
 #ifdef ORIGINAL_RATINGS
-    if (ride->ratings.excitement != -1)
+    if (result.Ratings.excitement != -1)
     {
         // Address underflows allowed by original RCT2 code
-        ride->ratings.excitement = max(0, ride->ratings.excitement);
-        ride->ratings.intensity = max(0, ride->ratings.intensity);
-        ride->ratings.nausea = max(0, ride->ratings.nausea);
+        result.Ratings.excitement = max(0, result.Ratings.excitement);
+        result.Ratings.intensity = max(0, result.Ratings.intensity);
+        result.Ratings.nausea = max(0, result.Ratings.nausea);
     }
 #endif
+
+    ride_ratings_calculate_value(ride, source.GetAgeInMonths(*ride), source.GetOpenRideCountOfType(ride->type), result);
+    return result;
 }
 
-static void ride_ratings_calculate_value(Ride* ride)
+static void ride_ratings_calculate_value(Ride* ride, int32_t monthsOld, int32_t openRidesOfSameType, RideRatingResult& result)
 {
     struct row
     {
@@ -774,21 +934,15 @@ static void ride_ratings_calculate_value(Ride* ride)
     };
 #endif
 
-    if (!ride_has_ratings(ride))
+    if (result.Ratings.excitement == RIDE_RATING_UNDEFINED)
     {
         return;
     }
 
     // Start with the base ratings, multiplied by the ride type specific weights for excitement, intensity and nausea.
-    int32_t value = (((ride->excitement * RideRatings[ride->type].excitement) * 32) >> 15)
-        + (((ride->intensity * RideRatings[ride->type].intensity) * 32) >> 15)
-        + (((ride->nausea * RideRatings[ride->type].nausea) * 32) >> 15);
-
-    int32_t monthsOld = 0;
-    if (!gCheatsDisableRideValueAging)
-    {
-        monthsOld = gDateMonthsElapsed - ride->build_date;
-    }
+    int32_t value = (((result.Ratings.excitement * RideRatings[ride->type].excitement) * 32) >> 15)
+        + (((result.Ratings.intensity * RideRatings[ride->type].intensity) * 32) >> 15)
+        + (((result.Ratings.nausea * RideRatings[ride->type].nausea) * 32) >> 15);
 
     const row* ageTable = ageTableNew;
     size_t tableSize = std::size(ageTableNew);
@@ -821,14 +975,10 @@ static void ride_ratings_calculate_value(Ride* ride)
     }
 
     // Other ride of same type penalty
-    const auto& rideManager = GetRideManager();
-    auto otherRidesOfSameType = std::count_if(rideManager.begin(), rideManager.end(), [ride](const Ride& r) {
-        return r.status == RIDE_STATUS_OPEN && r.type == ride->type;
-    });
-    if (otherRidesOfSameType > 1)
+    if (openRidesOfSameType > 1)
         value -= value / 4;
 
-    ride->value = std::max(0, value);
+    result.Value = std::max(0, value);
 }
 
 /**
@@ -837,7 +987,7 @@ static void ride_ratings_calculate_value(Ride* ride)
  * inputs
  * - edi: ride ptr
  */
-static uint16_t ride_compute_upkeep(Ride* ride)
+static uint16_t ride_compute_upkeep(const RideRatingCalculationData& state, Ride* ride)
 {
     // data stored at 0x0057E3A8, incrementing 18 bytes at a time
     uint16_t upkeep = initialUpkeepCosts[ride->type];
@@ -876,10 +1026,10 @@ static uint16_t ride_compute_upkeep(Ride* ride)
     {
         reverserMaintenanceCost = 10;
     }
-    upkeep += reverserMaintenanceCost * gRideRatingsCalcData.num_reversers;
+    upkeep += reverserMaintenanceCost * state.num_reversers;
 
     // Add maintenance cost for brake track pieces
-    upkeep += 20 * gRideRatingsCalcData.num_brakes;
+    upkeep += 20 * state.num_brakes;
 
     // these seem to be adhoc adjustments to a ride's upkeep/cost, times
     // various variables set on the ride itself.
@@ -1008,11 +1158,11 @@ static void ride_ratings_apply_intensity_penalty(rating_tuple* ratings)
  *
  *  rct2: 0x00655FD6
  */
-static void set_unreliability_factor(Ride* ride)
+static void set_unreliability_factor(Ride* ride, RideRatingResult& result)
 {
     // The bigger the difference in lift speed and minimum the higher the unreliability
     uint8_t minLiftSpeed = RideLiftData[ride->type].minimum_speed;
-    ride->unreliability_factor += (ride->lift_hill_speed - minLiftSpeed) * 2;
+    result.UnreliabilityFactor += (ride->lift_hill_speed - minLiftSpeed) * 2;
 }
 
 static uint32_t get_proximity_score_helper_1(uint16_t x, uint16_t max, uint32_t multiplier)
@@ -1037,9 +1187,9 @@ static uint32_t get_proximity_score_helper_3(uint16_t x, uint16_t resultIfNotZer
  *
  *  rct2: 0x0065E277
  */
-static uint32_t ride_ratings_get_proximity_score()
+static uint32_t ride_ratings_get_proximity_score(const RideRatingCalculationData& state)
 {
-    const uint16_t* scores = gRideRatingsCalcData.proximity_scores;
+    const uint16_t* scores = state.proximity_scores;
 
     uint32_t result = 0;
     result += get_proximity_score_helper_1(scores[PROXIMITY_WATER_OVER], 60, 0x00AAAA);
@@ -1399,7 +1549,7 @@ static rating_tuple ride_ratings_get_drop_ratings(Ride* ride)
  * Calculates a score based on the surrounding scenery.
  *  rct2: 0x0065E557
  */
-static int32_t ride_ratings_get_scenery_score(Ride* ride)
+template<typename TSource> static int32_t ride_ratings_get_scenery_score(Ride* ride, const TSource& source)
 {
     int8_t i = ride_get_first_valid_station_start(ride);
     int32_t x, y;
@@ -1422,7 +1572,7 @@ static int32_t ride_ratings_get_scenery_score(Ride* ride)
         y = location.y;
     }
 
-    int32_t z = tile_element_height({ x * 32, y * 32 });
+    int32_t z = source.GetSurfaceHeight({ x, y });
 
     // Check if station is underground, returns a fixed mediocre score since you can't have scenery underground
     if (z > ride->stations[i].Height * 8)
@@ -1437,7 +1587,9 @@ static int32_t ride_ratings_get_scenery_score(Ride* ride)
         for (int32_t xx = std::max(x - 5, 0); xx <= std::min(x + 5, 255); xx++)
         {
             // Count scenery items on this tile
-            TileElement* tileElement = map_get_first_element_at(xx, yy);
+            const TileElement* tileElement = source.GetFirstElementAt({ xx, yy });
+            if (tileElement == nullptr)
+                continue;
             do
             {
                 if (tileElement->IsGhost())
@@ -1481,9 +1633,10 @@ static void ride_ratings_apply_length(rating_tuple* ratings, Ride* ride, int32_t
     ride_ratings_add(ratings, (std::min(ride_get_total_length(ride) >> 16, maxLength) * excitementMultiplier) >> 16, 0, 0);
 }
 
-static void ride_ratings_apply_synchronisation(rating_tuple* ratings, Ride* ride, int32_t excitement, int32_t intensity)
+static void ride_ratings_apply_synchronisation(
+    const RideRatingCalculationData& state, rating_tuple* ratings, int32_t excitement, int32_t intensity)
 {
-    if ((ride->depart_flags & RIDE_DEPART_SYNCHRONISE_WITH_ADJACENT_STATIONS) && ride_has_adjacent_station(ride))
+    if (state.has_adjacent_station)
     {
         ride_ratings_add(ratings, excitement, intensity, 0);
     }
@@ -1567,14 +1720,16 @@ static void ride_ratings_apply_rotations(
         ride->rotations * nauseaMultiplier);
 }
 
-static void ride_ratings_apply_proximity(rating_tuple* ratings, int32_t excitementMultiplier)
+static void ride_ratings_apply_proximity(
+    const RideRatingCalculationData& state, rating_tuple* ratings, int32_t excitementMultiplier)
 {
-    ride_ratings_add(ratings, (ride_ratings_get_proximity_score() * excitementMultiplier) >> 16, 0, 0);
+    ride_ratings_add(ratings, (ride_ratings_get_proximity_score(state) * excitementMultiplier) >> 16, 0, 0);
 }
 
-static void ride_ratings_apply_scenery(rating_tuple* ratings, Ride* ride, int32_t excitementMultiplier)
+static void ride_ratings_apply_scenery(
+    const RideRatingCalculationData& state, rating_tuple* ratings, int32_t excitementMultiplier)
 {
-    ride_ratings_add(ratings, (ride_ratings_get_scenery_score(ride) * excitementMultiplier) >> 16, 0, 0);
+    ride_ratings_add(ratings, (state.scenery_score * excitementMultiplier) >> 16, 0, 0);
 }
 
 static void ride_ratings_apply_highest_drop_height_penalty(
@@ -1694,18 +1849,19 @@ static void ride_ratings_apply_first_length_penalty(
 
 #pragma region Ride rating calculation functions
 
-static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_spiral_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 30), RIDE_RATING(0, 30), RIDE_RATING(0, 30));
     ride_ratings_apply_length(&ratings, ride, 6000, 819);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 140434);
     ride_ratings_apply_max_speed(&ratings, ride, 51366, 85019, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 400497);
@@ -1714,8 +1870,8 @@ static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
@@ -1732,26 +1888,26 @@ static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_stand_up_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 17;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 17;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(3, 00), RIDE_RATING(3, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 123987, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -1760,8 +1916,8 @@ static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 34952, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 30427);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
@@ -1770,26 +1926,26 @@ static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
+static void ride_ratings_calculate_suspended_swinging_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 18;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 18;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 30), RIDE_RATING(2, 90), RIDE_RATING(3, 50));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -1798,8 +1954,8 @@ static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 48036);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6971);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6971);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 60), 2, 2, 2);
@@ -1810,26 +1966,26 @@ static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 17;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 17;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 60), RIDE_RATING(2, 80), RIDE_RATING(3, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -1838,8 +1994,8 @@ static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_proximity(state, &ratings, 15657);
+    ride_ratings_apply_scenery(state, &ratings, 8366);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
@@ -1853,26 +2009,26 @@ static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_junior_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 13;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 13;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 40), RIDE_RATING(2, 50), RIDE_RATING(1, 80));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -1881,8 +2037,8 @@ static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_num_drops_penalty(&ratings, ride, 1, 2, 2, 2);
@@ -1891,21 +2047,21 @@ static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_miniature_railway(Ride* ride)
+static void ride_ratings_calculate_miniature_railway(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 11;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 11;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 00));
@@ -1915,32 +2071,31 @@ static void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -6425, 6553, 23405);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 20915);
+    ride_ratings_apply_proximity(state, &ratings, 8946);
+    ride_ratings_apply_scenery(state, &ratings, 20915);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
     if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    result.ShelteredEighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_monorail(Ride* ride)
+static void ride_ratings_calculate_monorail(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 00), RIDE_RATING(0, 00));
@@ -1950,37 +2105,37 @@ static void ride_ratings_calculate_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
+    ride_ratings_apply_proximity(state, &ratings, 8946);
+    ride_ratings_apply_scenery(state, &ratings, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
     if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    result.ShelteredEighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
+static void ride_ratings_calculate_mini_suspended_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 70));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 45), RIDE_RATING(0, 15));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 45), RIDE_RATING(0, 15));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -1989,8 +2144,8 @@ static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 34179, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
     ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 30), 2, 2, 2);
@@ -2000,18 +2155,17 @@ static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_boat_hire(Ride* ride)
+static void ride_ratings_calculate_boat_hire(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->unreliability_factor = 7;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 7;
+    set_unreliability_factor(ride, result);
 
     // NOTE In the original game, the ratings were zeroed before calling set_unreliability_factor which is unusual as rest
     // of the calculation functions do this before hand. This is because set_unreliability_factor alters the value of ebx
@@ -2026,32 +2180,32 @@ static void ride_ratings_calculate_boat_hire(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 20), 0, 0);
     }
 
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 22310);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
+static void ride_ratings_calculate_wooden_wild_mouse(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(2, 90), RIDE_RATING(2, 10));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -2060,8 +2214,8 @@ static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
@@ -2073,26 +2227,25 @@ static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_steeplechase(Ride* ride)
+static void ride_ratings_calculate_steeplechase(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(2, 40), RIDE_RATING(1, 80));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 75), RIDE_RATING(0, 9));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 75), RIDE_RATING(0, 9));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2101,8 +2254,8 @@ static void ride_ratings_calculate_steeplechase(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 4, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
@@ -2113,26 +2266,25 @@ static void ride_ratings_calculate_steeplechase(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_car_ride(Ride* ride)
+static void ride_ratings_calculate_car_ride(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 12;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2140,28 +2292,28 @@ static void ride_ratings_calculate_car_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 8, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_launched_freefall(Ride* ride)
+static void ride_ratings_calculate_launched_freefall(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(3, 00), RIDE_RATING(3, 50));
@@ -2192,32 +2344,32 @@ static void ride_ratings_calculate_launched_freefall(Ride* ride)
     }
 #endif
 
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
+static void ride_ratings_calculate_bobsleigh_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(3, 20), RIDE_RATING(2, 50));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 20), RIDE_RATING(0, 00));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 20), RIDE_RATING(0, 00));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2226,8 +2378,8 @@ static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
     ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 20), 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x1720000, 2, 2, 2);
@@ -2236,56 +2388,56 @@ static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_observation_tower(Ride* ride)
+static void ride_ratings_calculate_observation_tower(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 10));
     ride_ratings_add(
         &ratings, ((ride_get_total_length(ride) >> 16) * 45875) >> 16, 0, ((ride_get_total_length(ride) >> 16) * 26214) >> 16);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 83662);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
     if (shelteredEighths.TrackShelteredEighths >= 5)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 }
 
-static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_looping_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = ride->IsPoweredLaunched() ? 20 : 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = ride->IsPoweredLaunched() ? 20 : 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2294,8 +2446,8 @@ static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 14, 2, 2, 2);
@@ -2312,26 +2464,25 @@ static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_dinghy_slide(Ride* ride)
+static void ride_ratings_calculate_dinghy_slide(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 13;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 13;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(2, 00), RIDE_RATING(1, 50));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 50), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 50), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2340,8 +2491,8 @@ static void ride_ratings_calculate_dinghy_slide(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
@@ -2350,26 +2501,26 @@ static void ride_ratings_calculate_dinghy_slide(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
+static void ride_ratings_calculate_mine_train_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(2, 30), RIDE_RATING(2, 10));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2378,8 +2529,8 @@ static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
+    ride_ratings_apply_proximity(state, &ratings, 21472);
+    ride_ratings_apply_scenery(state, &ratings, 16732);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
@@ -2390,21 +2541,20 @@ static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_chairlift(Ride* ride)
+static void ride_ratings_calculate_chairlift(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14 + (ride->speed * 2);
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14 + (ride->speed * 2);
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 50));
@@ -2415,8 +2565,8 @@ static void ride_ratings_calculate_chairlift(Ride* ride)
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_turns(&ratings, ride, 7430, 3476, 4574);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, -19275, 21845, 23405);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x960000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
@@ -2428,30 +2578,30 @@ static void ride_ratings_calculate_chairlift(Ride* ride)
         ratings.intensity /= 2;
     }
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
     if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    result.ShelteredEighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_corkscrew_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -2460,8 +2610,8 @@ static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
@@ -2478,20 +2628,19 @@ static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_maze(Ride* ride)
+static void ride_ratings_calculate_maze(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 8;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 00));
@@ -2499,25 +2648,24 @@ static void ride_ratings_calculate_maze(Ride* ride)
     int32_t size = std::min<uint16_t>(ride->maze_tiles, 100);
     ride_ratings_add(&ratings, size, size * 2, 0);
 
-    ride_ratings_apply_scenery(&ratings, ride, 22310);
+    ride_ratings_apply_scenery(state, &ratings, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_spiral_slide(Ride* ride)
+static void ride_ratings_calculate_spiral_slide(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 8;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 40), RIDE_RATING(0, 90));
@@ -2528,26 +2676,25 @@ static void ride_ratings_calculate_spiral_slide(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 25));
     }
 
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 2;
+    result.ShelteredEighths = 2;
 }
 
-static void ride_ratings_calculate_go_karts(Ride* ride)
+static void ride_ratings_calculate_go_karts(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 42), RIDE_RATING(1, 73), RIDE_RATING(0, 40));
@@ -2564,95 +2711,92 @@ static void ride_ratings_calculate_go_karts(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 4458, 3476, 5718);
     ride_ratings_apply_drops(&ratings, ride, 8738, 5461, 6553);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 2570, 8738, 2340);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 16732);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    result.ShelteredEighths = shelteredEighths.TotalShelteredEighths;
 
     if (shelteredEighths.TrackShelteredEighths >= 6)
-        ride->excitement /= 2;
+        result.Ratings.excitement /= 2;
 }
 
-static void ride_ratings_calculate_log_flume(Ride* ride)
+static void ride_ratings_calculate_log_flume(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 55), RIDE_RATING(0, 30));
     ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 531372, 655360, 301111);
     ride_ratings_apply_duration(&ratings, ride, 300, 13107);
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 69905, 62415, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_river_rapids(Ride* ride)
+static void ride_ratings_calculate_river_rapids(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 20), RIDE_RATING(0, 70), RIDE_RATING(0, 50));
     ride_ratings_apply_length(&ratings, ride, 2000, 6225);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 30), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 30), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 115130, 159411, 106274);
     ride_ratings_apply_duration(&ratings, ride, 500, 13107);
     ride_ratings_apply_turns(&ratings, ride, 29721, 22598, 5718);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 31314);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
+    ride_ratings_apply_proximity(state, &ratings, 31314);
+    ride_ratings_apply_scenery(state, &ratings, 13943);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_dodgems(Ride* ride)
+static void ride_ratings_calculate_dodgems(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 35));
@@ -2669,149 +2813,141 @@ static void ride_ratings_calculate_dodgems(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
     }
 
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_pirate_ship(Ride* ride)
+static void ride_ratings_calculate_pirate_ship(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 10;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 10;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 90), RIDE_RATING(1, 41));
 
     ride_ratings_add(&ratings, ride->operation_option * 5, ride->operation_option * 5, ride->operation_option * 10);
 
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
+    ride_ratings_apply_scenery(state, &ratings, 16732);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_inverter_ship(Ride* ride)
+static void ride_ratings_calculate_inverter_ship(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(2, 70), RIDE_RATING(2, 74));
 
     ride_ratings_add(&ratings, ride->operation_option * 11, ride->operation_option * 22, ride->operation_option * 22);
 
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_food_stall(Ride* ride)
+static void ride_ratings_calculate_food_stall(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_drink_stall(Ride* ride)
+static void ride_ratings_calculate_drink_stall(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_shop(Ride* ride)
+static void ride_ratings_calculate_shop(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_merry_go_round(Ride* ride)
+static void ride_ratings_calculate_merry_go_round(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 15), RIDE_RATING(0, 30));
     ride_ratings_apply_rotations(&ratings, ride, 5, 5, 5);
-    ride_ratings_apply_scenery(&ratings, ride, 19521);
+    ride_ratings_apply_scenery(state, &ratings, 19521);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_information_kiosk(Ride* ride)
+static void ride_ratings_calculate_information_kiosk(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_toilets(Ride* ride)
+static void ride_ratings_calculate_toilets(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_ferris_wheel(Ride* ride)
+static void ride_ratings_calculate_ferris_wheel(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 25), RIDE_RATING(0, 30));
     ride_ratings_apply_rotations(&ratings, ride, 25, 25, 25);
-    ride_ratings_apply_scenery(&ratings, ride, 41831);
+    ride_ratings_apply_scenery(state, &ratings, 41831);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_motion_simulator(Ride* ride)
+static void ride_ratings_calculate_motion_simulator(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 21;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 21;
+    set_unreliability_factor(ride, result);
 
     // Base ratings
     rating_tuple ratings;
@@ -2831,20 +2967,19 @@ static void ride_ratings_calculate_motion_simulator(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_3d_cinema(Ride* ride)
+static void ride_ratings_calculate_3d_cinema(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 21;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 21;
+    set_unreliability_factor(ride, result);
 
     // Base ratings
     rating_tuple ratings;
@@ -2871,20 +3006,19 @@ static void ride_ratings_calculate_3d_cinema(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths |= 7;
+    result.ShelteredEighths |= 7;
 }
 
-static void ride_ratings_calculate_top_spin(Ride* ride)
+static void ride_ratings_calculate_top_spin(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 19;
+    set_unreliability_factor(ride, result);
 
     // Base ratings
     rating_tuple ratings;
@@ -2908,80 +3042,78 @@ static void ride_ratings_calculate_top_spin(Ride* ride)
             break;
     }
 
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_space_rings(Ride* ride)
+static void ride_ratings_calculate_space_rings(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 7;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 7;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(2, 10), RIDE_RATING(6, 50));
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
+static void ride_ratings_calculate_reverse_freefall_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 25;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 25;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(3, 20), RIDE_RATING(2, 80));
     ride_ratings_apply_length(&ratings, ride, 6000, 327);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 60), RIDE_RATING(0, 15));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 15));
     ride_ratings_apply_max_speed(&ratings, ride, 436906, 436906, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 41704, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_lift(Ride* ride)
+static void ride_ratings_calculate_lift(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     int32_t totalLength;
 
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 11), RIDE_RATING(0, 35), RIDE_RATING(0, 30));
@@ -2989,35 +3121,35 @@ static void ride_ratings_calculate_lift(Ride* ride)
     totalLength = ride_get_total_length(ride) >> 16;
     ride_ratings_add(&ratings, (totalLength * 45875) >> 16, 0, (totalLength * 26214) >> 16);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 83662);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 
     if ((get_num_of_sheltered_eighths(ride).TrackShelteredEighths) >= 5)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 }
 
-static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_vertical_drop_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 20), RIDE_RATING(0, 80), RIDE_RATING(0, 30));
     ride_ratings_apply_length(&ratings, ride, 4000, 1146);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 97418, 141699, 70849);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
@@ -3025,8 +3157,8 @@ static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
@@ -3036,48 +3168,45 @@ static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_cash_machine(Ride* ride)
+static void ride_ratings_calculate_cash_machine(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_twist(Ride* ride)
+static void ride_ratings_calculate_twist(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 13), RIDE_RATING(0, 97), RIDE_RATING(1, 90));
     ride_ratings_apply_rotations(&ratings, ride, 20, 20, 20);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
+    ride_ratings_apply_scenery(state, &ratings, 13943);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_haunted_house(Ride* ride)
+static void ride_ratings_calculate_haunted_house(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 8;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings = {
         /* .excitement =  */ RIDE_RATING(3, 41),
@@ -3088,26 +3217,26 @@ static void ride_ratings_calculate_haunted_house(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_flying_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 17;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 17;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(4, 35), RIDE_RATING(1, 85), RIDE_RATING(4, 33));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3116,8 +3245,8 @@ static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ratings.excitement /= 2;
@@ -3133,26 +3262,25 @@ static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_virginia_reel(Ride* ride)
+static void ride_ratings_calculate_virginia_reel(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 19;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 10), RIDE_RATING(1, 90), RIDE_RATING(3, 70));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -3161,8 +3289,8 @@ static void ride_ratings_calculate_virginia_reel(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 52012, 26075, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xD20000, 2, 2, 2);
     ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
 
@@ -3170,58 +3298,57 @@ static void ride_ratings_calculate_virginia_reel(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_splash_boats(Ride* ride)
+static void ride_ratings_calculate_splash_boats(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 46), RIDE_RATING(0, 35), RIDE_RATING(0, 30));
     ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 797059, 655360, 301111);
     ride_ratings_apply_duration(&ratings, ride, 500, 13107);
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 87381, 93622, 62259);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mini_helicopters(Ride* ride)
+static void ride_ratings_calculate_mini_helicopters(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 12;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3229,33 +3356,33 @@ static void ride_ratings_calculate_mini_helicopters(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_proximity(state, &ratings, 8946);
+    ride_ratings_apply_scenery(state, &ratings, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xA00000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 6;
+    result.ShelteredEighths = 6;
 }
 
-static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_lay_down_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 18;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 18;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 85), RIDE_RATING(1, 15), RIDE_RATING(2, 75));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3264,8 +3391,8 @@ static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
     {
@@ -3286,21 +3413,21 @@ static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_suspended_monorail(Ride* ride)
+static void ride_ratings_calculate_suspended_monorail(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 15), RIDE_RATING(0, 23), RIDE_RATING(0, 8));
@@ -3310,42 +3437,42 @@ static void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
     ride_ratings_apply_duration(&ratings, ride, 150, 21845);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 12525);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_proximity(state, &ratings, 12525);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     auto shelteredEighths = get_num_of_sheltered_eighths(ride);
     if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
+        result.Ratings.excitement /= 4;
 
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    result.ShelteredEighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_reverser_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 19;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 40), RIDE_RATING(1, 80), RIDE_RATING(1, 70));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
 
-    int32_t numReversers = std::min<uint16_t>(gRideRatingsCalcData.num_reversers, 6);
+    int32_t numReversers = std::min<uint16_t>(state.num_reversers, 6);
     ride_rating reverserRating = numReversers * RIDE_RATING(0, 20);
     ride_ratings_add(&ratings, reverserRating, reverserRating, reverserRating);
 
@@ -3354,10 +3481,10 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
 
-    if (gRideRatingsCalcData.num_reversers < 1)
+    if (state.num_reversers < 1)
     {
         ratings.excitement /= 8;
     }
@@ -3369,26 +3496,26 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
+static void ride_ratings_calculate_heartline_twister_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 18;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 18;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 40), RIDE_RATING(1, 70), RIDE_RATING(1, 65));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 20), RIDE_RATING(0, 04));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 20), RIDE_RATING(0, 04));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 97418, 123987, 70849);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3397,8 +3524,8 @@ static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 52150, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 53052, 55705);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 34952, 35108);
-    ride_ratings_apply_proximity(&ratings, 9841);
-    ride_ratings_apply_scenery(&ratings, ride, 3904);
+    ride_ratings_apply_proximity(state, &ratings, 9841);
+    ride_ratings_apply_scenery(state, &ratings, 3904);
 
     if (ride->inversions == 0)
         ratings.excitement /= 4;
@@ -3409,29 +3536,28 @@ static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mini_golf(Ride* ride)
+static void ride_ratings_calculate_mini_golf(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 0;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 0;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 90), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 27887);
+    ride_ratings_apply_proximity(state, &ratings, 15657);
+    ride_ratings_apply_scenery(state, &ratings, 27887);
 
     // Apply golf holes factor
     ride_ratings_add(&ratings, (ride->holes) * 5, 0, 0);
@@ -3447,26 +3573,24 @@ static void ride_ratings_calculate_mini_golf(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_first_aid(Ride* ride)
+static void ride_ratings_calculate_first_aid(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 }
 
-static void ride_ratings_calculate_circus_show(Ride* ride)
+static void ride_ratings_calculate_circus_show(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 9;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 9;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings = {
         /* .excitement = */ RIDE_RATING(2, 10),
@@ -3477,59 +3601,58 @@ static void ride_ratings_calculate_circus_show(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_ghost_train(Ride* ride)
+static void ride_ratings_calculate_ghost_train(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 12;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 20), RIDE_RATING(0, 03));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 8366);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xB40000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_twister_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 15;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 50), RIDE_RATING(0, 40), RIDE_RATING(0, 30));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3538,8 +3661,8 @@ static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
@@ -3556,26 +3679,26 @@ static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_wooden_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 19;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 20), RIDE_RATING(2, 60), RIDE_RATING(2, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -3584,8 +3707,8 @@ static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
@@ -3596,26 +3719,26 @@ static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_side_friction_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 19;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(2, 00), RIDE_RATING(1, 50));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -3624,8 +3747,8 @@ static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 22367);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x50000, 2, 2, 2);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0xFA0000, 2, 2, 2);
@@ -3635,26 +3758,25 @@ static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_wild_mouse(Ride* ride)
+static void ride_ratings_calculate_wild_mouse(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 10));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -3663,8 +3785,8 @@ static void ride_ratings_calculate_wild_mouse(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 50), 2, 2, 2);
@@ -3675,26 +3797,26 @@ static void ride_ratings_calculate_wild_mouse(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_multi_dimension_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 18;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 18;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 75), RIDE_RATING(1, 95), RIDE_RATING(4, 79));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3703,8 +3825,8 @@ static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ratings.excitement /= 4;
@@ -3720,26 +3842,25 @@ static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_giga_coaster(Ride* ride)
+static void ride_ratings_calculate_giga_coaster(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 85), RIDE_RATING(0, 40), RIDE_RATING(0, 35));
     ride_ratings_apply_length(&ratings, ride, 6000, 819);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 140434);
     ride_ratings_apply_max_speed(&ratings, ride, 51366, 85019, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 400497);
@@ -3748,8 +3869,8 @@ static void ride_ratings_calculate_giga_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 16, 2, 2, 2);
@@ -3766,21 +3887,20 @@ static void ride_ratings_calculate_giga_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_roto_drop(Ride* ride)
+static void ride_ratings_calculate_roto_drop(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 24;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 24;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(3, 50), RIDE_RATING(3, 50));
@@ -3788,26 +3908,25 @@ static void ride_ratings_calculate_roto_drop(Ride* ride)
     int32_t lengthFactor = ((ride_get_total_length(ride) >> 16) * 209715) >> 16;
     ride_ratings_add(&ratings, lengthFactor, lengthFactor * 2, lengthFactor * 2);
 
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 25098);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_flying_saucers(Ride* ride)
+static void ride_ratings_calculate_flying_saucers(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 32;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 32;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings = {
         /* .excitement = */ RIDE_RATING(2, 40),
@@ -3827,25 +3946,24 @@ static void ride_ratings_calculate_flying_saucers(Ride* ride)
         ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
     }
 
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_crooked_house(Ride* ride)
+static void ride_ratings_calculate_crooked_house(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 5;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 5;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings = {
         /* .excitement = */ RIDE_RATING(2, 15),
@@ -3856,26 +3974,25 @@ static void ride_ratings_calculate_crooked_house(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 7;
+    result.ShelteredEighths = 7;
 }
 
-static void ride_ratings_calculate_monorail_cycles(Ride* ride)
+static void ride_ratings_calculate_monorail_cycles(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 4;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 4;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3883,33 +4000,33 @@ static void ride_ratings_calculate_monorail_cycles(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
     ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 2340);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 8946);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
+static void ride_ratings_calculate_compact_inverted_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = ride->mode == RIDE_MODE_REVERSE_INCLINE_LAUNCHED_SHUTTLE ? 31 : 21;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = ride->mode == RIDE_MODE_REVERSE_INCLINE_LAUNCHED_SHUTTLE ? 31 : 21;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 15), RIDE_RATING(2, 80), RIDE_RATING(3, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3918,8 +4035,8 @@ static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_proximity(state, &ratings, 15657);
+    ride_ratings_apply_scenery(state, &ratings, 8366);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
@@ -3933,26 +4050,25 @@ static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_water_coaster(Ride* ride)
+static void ride_ratings_calculate_water_coaster(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(2, 80), RIDE_RATING(2, 10));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -3961,8 +4077,8 @@ static void ride_ratings_calculate_water_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_num_drops_penalty(&ratings, ride, 1, 2, 2, 2);
@@ -3974,57 +4090,57 @@ static void ride_ratings_calculate_water_coaster(Ride* ride)
     if (!(ride->special_track_elements & RIDE_ELEMENT_TUNNEL_SPLASH_OR_RAPIDS))
         ratings.excitement /= 8;
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
+static void ride_ratings_calculate_air_powered_vertical_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 28;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 28;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(4, 13), RIDE_RATING(2, 50), RIDE_RATING(2, 80));
     ride_ratings_apply_length(&ratings, ride, 6000, 327);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 60), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 509724, 364088, 320398);
     ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 59578);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 21845, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 1, 1);
 
     ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 59578);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_hairpin_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 14;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(2, 65), RIDE_RATING(2, 25));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
@@ -4033,8 +4149,8 @@ static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
+    ride_ratings_apply_proximity(state, &ratings, 17893);
+    ride_ratings_apply_scenery(state, &ratings, 5577);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
@@ -4046,100 +4162,96 @@ static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_magic_carpet(Ride* ride)
+static void ride_ratings_calculate_magic_carpet(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 45), RIDE_RATING(1, 60), RIDE_RATING(2, 60));
 
     ride_ratings_add(&ratings, ride->operation_option * 10, ride->operation_option * 20, ride->operation_option * 20);
 
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 0;
+    result.ShelteredEighths = 0;
 }
 
-static void ride_ratings_calculate_submarine_ride(Ride* ride)
+static void ride_ratings_calculate_submarine_ride(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->unreliability_factor = 7;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 7;
+    set_unreliability_factor(ride, result);
 
     // NOTE Fixed bug from original game, see boat Hire.
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 20), RIDE_RATING(1, 80), RIDE_RATING(1, 40));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 22310);
+    ride_ratings_apply_proximity(state, &ratings, 11183);
+    ride_ratings_apply_scenery(state, &ratings, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
     // Originally, this was always to zero, even though the default vehicle is completely enclosed.
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_river_rafts(Ride* ride)
+static void ride_ratings_calculate_river_rafts(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 12;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(1, 45), RIDE_RATING(0, 25), RIDE_RATING(0, 34));
     ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_max_speed(&ratings, ride, 531372, 655360, 301111);
     ride_ratings_apply_duration(&ratings, ride, 500, 13107);
     ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
     ride_ratings_apply_drops(&ratings, ride, 78643, 93622, 62259);
-    ride_ratings_apply_proximity(&ratings, 13420);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
+    ride_ratings_apply_proximity(state, &ratings, 13420);
+    ride_ratings_apply_scenery(state, &ratings, 11155);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_enterprise(Ride* ride)
+static void ride_ratings_calculate_enterprise(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 22;
-    set_unreliability_factor(ride);
+    result.LifecycleFlags |= RIDE_LIFECYCLE_TESTED;
+    result.LifecycleFlags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    result.UnreliabilityFactor = 22;
+    set_unreliability_factor(ride, result);
 
     // Base ratings
     rating_tuple ratings = {
@@ -4150,31 +4262,31 @@ static void ride_ratings_calculate_enterprise(Ride* ride)
 
     ride_ratings_add(&ratings, ride->operation_option, ride->operation_option * 16, ride->operation_option * 16);
 
-    ride_ratings_apply_scenery(&ratings, ride, 19521);
+    ride_ratings_apply_scenery(state, &ratings, 19521);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = 3;
+    result.ShelteredEighths = 3;
 }
 
-static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
+static void ride_ratings_calculate_inverted_impulse_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 20;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 20;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(4, 00), RIDE_RATING(3, 00), RIDE_RATING(3, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -4183,8 +4295,8 @@ static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
     ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
+    ride_ratings_apply_proximity(state, &ratings, 15657);
+    ride_ratings_apply_scenery(state, &ratings, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
 
@@ -4192,26 +4304,26 @@ static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_mini_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 13;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 13;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 55), RIDE_RATING(2, 40), RIDE_RATING(1, 85));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -4220,8 +4332,8 @@ static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 9760);
     ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
     ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
     ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
@@ -4231,26 +4343,25 @@ static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_mine_ride(Ride* ride)
+static void ride_ratings_calculate_mine_ride(const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 16;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 75), RIDE_RATING(1, 00), RIDE_RATING(1, 80));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -4259,34 +4370,34 @@ static void ride_ratings_calculate_mine_ride(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
+    ride_ratings_apply_proximity(state, &ratings, 21472);
+    ride_ratings_apply_scenery(state, &ratings, 16732);
     ride_ratings_apply_first_length_penalty(&ratings, ride, 0x10E0000, 2, 2, 2);
 
     ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 40960, 29789, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_lim_launched_roller_coaster(
+    const RideRatingCalculationData& state, Ride* ride, RideRatingResult& result)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 25;
-    set_unreliability_factor(ride);
+    result.UnreliabilityFactor = 25;
+    set_unreliability_factor(ride, result);
 
     rating_tuple ratings;
     ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(1, 50), RIDE_RATING(2, 20));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(state, &ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
@@ -4295,8 +4406,8 @@ static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
     ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
     ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+    ride_ratings_apply_proximity(state, &ratings, 20130);
+    ride_ratings_apply_scenery(state, &ratings, 6693);
 
     if (ride->inversions == 0)
         ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 10, 2, 2, 2);
@@ -4313,12 +4424,11 @@ static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
+    result.Ratings = ratings;
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    result.UpkeepCost = ride_compute_upkeep(state, ride);
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    result.ShelteredEighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
 #pragma endregion
@@ -4426,3 +4536,676 @@ static ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType
 }
 
 #pragma endregion
+
+#pragma region Ride rating snapshot
+
+static uint32_t ride_ratings_snapshot_tile_key(const TileCoordsXY& coords)
+{
+    return (coords.y * MAXIMUM_MAP_SIZE_TECHNICAL) + coords.x;
+}
+
+/**
+ * Copies the fields of the ride the rating calculation reads. Ride itself can not be copied.
+ */
+static void ride_ratings_snapshot_copy_ride(const Ride& src, Ride& dst)
+{
+    dst.id = src.id;
+    dst.type = src.type;
+    dst.subtype = src.subtype;
+    dst.mode = src.mode;
+    dst.status = src.status;
+    dst.lifecycle_flags = src.lifecycle_flags;
+    dst.depart_flags = src.depart_flags;
+    dst.num_stations = src.num_stations;
+    dst.num_vehicles = src.num_vehicles;
+    dst.num_cars_per_train = src.num_cars_per_train;
+    dst.operation_option = src.operation_option;
+    dst.lift_hill_speed = src.lift_hill_speed;
+    dst.maze_tiles = src.maze_tiles;
+    dst.special_track_elements = src.special_track_elements;
+    dst.max_speed = src.max_speed;
+    dst.average_speed = src.average_speed;
+    dst.max_positive_vertical_g = src.max_positive_vertical_g;
+    dst.max_negative_vertical_g = src.max_negative_vertical_g;
+    dst.max_lateral_g = src.max_lateral_g;
+    dst.turn_count_default = src.turn_count_default;
+    dst.turn_count_banked = src.turn_count_banked;
+    dst.turn_count_sloped = src.turn_count_sloped;
+    dst.drops = src.drops;
+    dst.highest_drop_height = src.highest_drop_height;
+    dst.sheltered_length = src.sheltered_length;
+    dst.var_11C = src.var_11C;
+    dst.num_sheltered_sections = src.num_sheltered_sections;
+    dst.total_air_time = src.total_air_time;
+    dst.inversions = src.inversions;
+    dst.holes = src.holes;
+    dst.sheltered_eighths = src.sheltered_eighths;
+    dst.ratings = src.ratings;
+    dst.value = src.value;
+    dst.build_date = src.build_date;
+    dst.upkeep_cost = src.upkeep_cost;
+    dst.unreliability_factor = src.unreliability_factor;
+    std::copy(std::begin(src.stations), std::end(src.stations), std::begin(dst.stations));
+}
+
+static TileElement ride_ratings_snapshot_create_surface(int32_t height)
+{
+    TileElement surface;
+    surface.ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+    surface.SetLastForTile(true);
+    surface.base_height = height;
+    surface.clearance_height = height;
+    surface.AsSurface()->SetWaterHeight(0);
+    surface.AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+    return surface;
+}
+
+/**
+ * Fills in the stats a test run would have counted piece by piece, the same way vehicle_update_measurements does.
+ */
+static void ride_ratings_snapshot_count_track_pieces(Ride& ride, const TrackDesign& td6)
+{
+    uint32_t turnFlags = 0;
+    int32_t turnLength = 0;
+    for (const auto& track : td6.track_elements)
+    {
+        uint8_t trackType = track.type;
+        if (ride.type == RIDE_TYPE_WATER_COASTER && trackType >= TRACK_ELEM_FLAT_COVERED
+            && trackType <= TRACK_ELEM_RIGHT_QUARTER_TURN_3_TILES_COVERED)
+        {
+            ride.special_track_elements |= RIDE_ELEMENT_TUNNEL_SPLASH_OR_RAPIDS;
+        }
+
+        switch (trackType)
+        {
+            case TRACK_ELEM_RAPIDS:
+            case TRACK_ELEM_SPINNING_TUNNEL:
+            case TRACK_ELEM_WATER_SPLASH:
+                ride.special_track_elements |= RIDE_ELEMENT_TUNNEL_SPLASH_OR_RAPIDS;
+                break;
+            case TRACK_ELEM_WATERFALL:
+            case TRACK_ELEM_LOG_FLUME_REVERSER:
+                ride.special_track_elements |= RIDE_ELEMENT_REVERSER_OR_WATERFALL;
+                break;
+            case TRACK_ELEM_WHIRLPOOL:
+                ride.special_track_elements |= RIDE_ELEMENT_WHIRLPOOL;
+                break;
+        }
+
+        uint16_t trackFlags = TrackFlags[trackType];
+        if ((turnFlags & RIDE_TESTING_TURN_LEFT) && (trackFlags & TRACK_ELEM_FLAG_TURN_LEFT))
+        {
+            turnLength++;
+        }
+        else if ((turnFlags & RIDE_TESTING_TURN_RIGHT) && (trackFlags & TRACK_ELEM_FLAG_TURN_RIGHT))
+        {
+            turnLength++;
+        }
+        else if (turnFlags & (RIDE_TESTING_TURN_LEFT | RIDE_TESTING_TURN_RIGHT))
+        {
+            uint8_t turnType = 1;
+            if (!(turnFlags & RIDE_TESTING_TURN_BANKED))
+            {
+                turnType = (turnFlags & RIDE_TESTING_TURN_SLOPED) ? 2 : 0;
+            }
+            switch (turnLength)
+            {
+                case 0:
+                    increment_turn_count_1_element(&ride, turnType);
+                    break;
+                case 1:
+                    increment_turn_count_2_elements(&ride, turnType);
+                    break;
+                case 2:
+                    increment_turn_count_3_elements(&ride, turnType);
+                    break;
+                default:
+                    increment_turn_count_4_plus_elements(&ride, turnType);
+                    break;
+            }
+            turnFlags = 0;
+        }
+        else if (trackFlags & (TRACK_ELEM_FLAG_TURN_LEFT | TRACK_ELEM_FLAG_TURN_RIGHT))
+        {
+            turnFlags = (trackFlags & TRACK_ELEM_FLAG_TURN_LEFT) ? RIDE_TESTING_TURN_LEFT : RIDE_TESTING_TURN_RIGHT;
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_BANKED)
+                turnFlags |= RIDE_TESTING_TURN_BANKED;
+            if (trackFlags & TRACK_ELEM_FLAG_TURN_SLOPED)
+                turnFlags |= RIDE_TESTING_TURN_SLOPED;
+            turnLength = 0;
+        }
+
+        if (ride.type == RIDE_TYPE_MINI_GOLF && (trackFlags & TRACK_ELEM_FLAG_IS_GOLF_HOLE))
+        {
+            if (ride.holes < MAX_GOLF_HOLES)
+                ride.holes++;
+        }
+
+        if (trackFlags & TRACK_ELEM_FLAG_HELIX)
+        {
+            uint8_t helixes = ride_get_helix_sections(&ride);
+            if (helixes != MAX_HELICES)
+                helixes++;
+
+            ride.special_track_elements &= ~0x1F;
+            ride.special_track_elements |= helixes;
+        }
+    }
+}
+
+RideRatingsSnapshot::RideRatingsSnapshot()
+    : _ride(std::make_unique<Ride>())
+{
+}
+
+RideRatingsSnapshot::RideRatingsSnapshot(RideRatingsSnapshot&&) = default;
+RideRatingsSnapshot::~RideRatingsSnapshot() = default;
+RideRatingsSnapshot& RideRatingsSnapshot::operator=(RideRatingsSnapshot&&) = default;
+
+RideRatingsSnapshot RideRatingsSnapshot::FromRide(const Ride& ride)
+{
+    RideRatingsSnapshot snapshot;
+    ride_ratings_snapshot_copy_ride(ride, *snapshot._ride);
+
+    auto copyArea = [&snapshot](const TileCoordsXY& centre, int32_t radius) {
+        int32_t left = std::max(centre.x - radius, 0);
+        int32_t top = std::max(centre.y - radius, 0);
+        int32_t right = std::min(centre.x + radius, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        int32_t bottom = std::min(centre.y + radius, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        for (int32_t y = top; y <= bottom; y++)
+        {
+            for (int32_t x = left; x <= right; x++)
+            {
+                if (snapshot._tiles.find(ride_ratings_snapshot_tile_key({ x, y })) != snapshot._tiles.end())
+                    continue;
+
+                auto tileElement = map_get_first_element_at(x, y);
+                if (tileElement != nullptr)
+                {
+                    snapshot.AddTile({ x, y }, tileElement, tile_element_height({ x * 32, y * 32 }));
+                }
+            }
+        }
+    };
+
+    // The track and everything next to it, for the proximity scores
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    while (tile_element_iterator_next(&it))
+    {
+        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
+            continue;
+        if (it.element->AsTrack()->GetRideIndex() != ride.id)
+            continue;
+
+        copyArea({ it.x, it.y }, 1);
+    }
+
+    // The area around the stations and the maze entrance, for the scenery score
+    for (const auto& station : ride.stations)
+    {
+        if (station.Start.xy != RCT_XY8_UNDEFINED)
+        {
+            copyArea({ station.Start.x, station.Start.y }, 5);
+        }
+    }
+    if (!ride.stations[0].Entrance.isNull())
+    {
+        copyArea({ ride.stations[0].Entrance.x, ride.stations[0].Entrance.y }, 5);
+    }
+
+    RideRatingsLiveMap liveMap;
+    snapshot._hasAdjacentStation = liveMap.HasAdjacentStation(const_cast<Ride*>(&ride));
+    snapshot._ageInMonths = liveMap.GetAgeInMonths(ride);
+    snapshot._openRideCountOfType = liveMap.GetOpenRideCountOfType(ride.type);
+    return snapshot;
+}
+
+std::optional<RideRatingsSnapshot> RideRatingsSnapshot::FromTrackDesign(const TrackDesign& td6)
+{
+    struct PlacedElement
+    {
+        CoordsXY Coords;
+        int32_t BaseZ;
+        int32_t ClearanceZ;
+        TileElement Element;
+    };
+
+    RideRatingsSnapshot snapshot;
+    auto& ride = *snapshot._ride;
+    ride.id = 0;
+    ride.type = td6.type;
+    // Looking the vehicle up would mean reading the loaded objects, so its rating multipliers are left out.
+    ride.subtype = RIDE_ENTRY_INDEX_NULL;
+    ride.mode = td6.ride_mode;
+    ride.status = RIDE_STATUS_OPEN;
+    ride.lifecycle_flags = RIDE_LIFECYCLE_TESTED;
+    ride.depart_flags = td6.depart_flags;
+    ride.num_stations = 1;
+    ride.num_vehicles = td6.number_of_trains;
+    ride.num_cars_per_train = td6.number_of_cars_per_train;
+    ride.operation_option = td6.operation_setting;
+    ride.lift_hill_speed = td6.lift_hill_speed;
+    ride.ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+    ride.value = RIDE_VALUE_UNDEFINED;
+    ride.upkeep_cost = td6.upkeep_cost;
+    for (auto& station : ride.stations)
+    {
+        station.Start.xy = RCT_XY8_UNDEFINED;
+        station.Entrance.x = COORDS_NULL;
+        station.Exit.x = COORDS_NULL;
+    }
+
+    // The inverse of what TrackDesign::CreateTrackDesign stores
+    int32_t totalLength = td6.ride_length * 65536;
+    uint8_t shelteredEighths = td6.inversions >> 5;
+    ride.max_speed = td6.max_speed * 65536;
+    ride.average_speed = td6.average_speed * 65536;
+    ride.max_positive_vertical_g = td6.max_positive_vertical_g * 32;
+    ride.max_negative_vertical_g = td6.max_negative_vertical_g * 32;
+    ride.max_lateral_g = td6.max_lateral_g * 32;
+    ride.inversions = td6.inversions & 0x1F;
+    ride.sheltered_eighths = shelteredEighths;
+    ride.sheltered_length = (totalLength / 8) * shelteredEighths;
+    ride.num_sheltered_sections = shelteredEighths != 0 ? 1 : 0;
+    ride.drops = td6.drops;
+    ride.highest_drop_height = td6.highest_drop_height;
+    ride.total_air_time = (td6.total_air_time * 1024) / 123;
+    ride.stations[0].SegmentLength = totalLength;
+    ride.stations[0].SegmentTime = td6.average_speed > 0 ? td6.ride_length / td6.average_speed : 0;
+    ride_ratings_snapshot_count_track_pieces(ride, td6);
+
+    bool hasEntrance = std::any_of(td6.entrance_elements.begin(), td6.entrance_elements.end(), [](const auto& entrance) {
+        return !(entrance.direction & (1 << 7));
+    });
+
+    std::vector<PlacedElement> placedElements;
+    std::optional<size_t> stationElement;
+    if (td6.type == RIDE_TYPE_MAZE)
+    {
+        for (const auto& mazeElement : td6.maze_elements)
+        {
+            if (mazeElement.type == MAZE_ELEMENT_TYPE_ENTRANCE)
+            {
+                hasEntrance = true;
+            }
+            else if (mazeElement.type != MAZE_ELEMENT_TYPE_EXIT)
+            {
+                ride.maze_tiles++;
+                if (!stationElement)
+                {
+                    stationElement = placedElements.size();
+                    PlacedElement placed{};
+                    placed.Coords = { mazeElement.x * 32, mazeElement.y * 32 };
+                    placed.Element.ClearAs(TILE_ELEMENT_TYPE_TRACK);
+                    placed.Element.AsTrack()->SetTrackType(TRACK_ELEM_MAZE);
+                    placed.Element.AsTrack()->SetMazeEntry(mazeElement.maze_entry);
+                    placed.ClearanceZ = RideData5[td6.type].clearance_height / 8;
+                    placedElements.push_back(placed);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Lay the track out the same way track_design_place_ride does
+        const rct_preview_track** trackBlockArray = ride_type_has_flag(td6.type, RIDE_TYPE_FLAG_HAS_TRACK)
+            ? TrackBlocks
+            : FlatRideTrackBlocks;
+        CoordsXY position = { 0, 0 };
+        int32_t z = 0;
+        uint8_t rotation = 0;
+        for (const auto& track : td6.track_elements)
+        {
+            uint8_t trackType = track.type;
+            if (trackType == TRACK_ELEM_INVERTED_90_DEG_UP_TO_FLAT_QUARTER_LOOP)
+            {
+                trackType = 0xFF;
+            }
+
+            const rct_track_coordinates* trackCoordinates = &TrackCoordinates[trackType];
+            int32_t tempZ = z - trackCoordinates->z_begin;
+            for (const rct_preview_track* trackBlock = trackBlockArray[trackType]; trackBlock->index != 0xFF; trackBlock++)
+            {
+                PlacedElement placed{};
+                placed.Coords = position + CoordsXY{ trackBlock->x, trackBlock->y }.Rotate(rotation);
+                placed.BaseZ = (tempZ + trackBlock->z) / 8;
+
+                int32_t clearanceZ = trackBlock->var_07;
+                if (trackBlock->var_09 & (1 << 2) && RideData5[td6.type].clearance_height > 24)
+                {
+                    clearanceZ += 24;
+                }
+                else
+                {
+                    clearanceZ += RideData5[td6.type].clearance_height;
+                }
+                placed.ClearanceZ = (clearanceZ / 8) + placed.BaseZ;
+
+                placed.Element.ClearAs(TILE_ELEMENT_TYPE_TRACK);
+                placed.Element.SetDirection(rotation & 3);
+                placed.Element.AsTrack()->SetTrackType(trackType);
+                placed.Element.AsTrack()->SetSequenceIndex(trackBlock->index);
+                placed.Element.AsTrack()->SetRideIndex(ride.id);
+                if (!stationElement && trackBlock->index == 0
+                    && (TrackSequenceProperties[trackType][0] & TRACK_SEQUENCE_FLAG_ORIGIN))
+                {
+                    stationElement = placedElements.size();
+                }
+                placedElements.push_back(placed);
+            }
+
+            position += CoordsXY{ trackCoordinates->x, trackCoordinates->y }.Rotate(rotation);
+            z += trackCoordinates->z_end - trackCoordinates->z_begin;
+            rotation = (rotation + trackCoordinates->rotation_end - trackCoordinates->rotation_begin) & 3;
+            if (trackCoordinates->rotation_end & (1 << 2))
+            {
+                rotation |= (1 << 2);
+            }
+            else
+            {
+                position += CoordsDirectionDelta[rotation];
+            }
+        }
+    }
+
+    if (!stationElement)
+    {
+        return std::nullopt;
+    }
+
+    // Move the ride onto the map, with its lowest piece on flat land at the default height
+    constexpr int32_t landHeight = 14;
+    int32_t minX = INT32_MAX;
+    int32_t minY = INT32_MAX;
+    int32_t minZ = INT32_MAX;
+    for (const auto& placed : placedElements)
+    {
+        minX = std::min(minX, placed.Coords.x);
+        minY = std::min(minY, placed.Coords.y);
+        minZ = std::min(minZ, placed.BaseZ);
+    }
+
+    std::unordered_map<uint32_t, std::vector<TileElement>> tiles;
+    for (auto& placed : placedElements)
+    {
+        TileCoordsXY coords = { ((placed.Coords.x - minX) / 32) + 1, ((placed.Coords.y - minY) / 32) + 1 };
+        int32_t baseZ = placed.BaseZ - minZ + landHeight;
+        int32_t clearanceZ = placed.ClearanceZ - minZ + landHeight;
+        if (coords.x >= MAXIMUM_MAP_SIZE_TECHNICAL - 1 || coords.y >= MAXIMUM_MAP_SIZE_TECHNICAL - 1 || clearanceZ >= 255)
+        {
+            return std::nullopt;
+        }
+        placed.Element.base_height = baseZ;
+        placed.Element.clearance_height = clearanceZ;
+
+        auto& tileElements = tiles[ride_ratings_snapshot_tile_key(coords)];
+        if (tileElements.empty())
+        {
+            tileElements.push_back(ride_ratings_snapshot_create_surface(landHeight));
+        }
+        tileElements.push_back(placed.Element);
+
+        if (&placed == &placedElements[*stationElement])
+        {
+            ride.stations[0].Start.x = coords.x;
+            ride.stations[0].Start.y = coords.y;
+            ride.stations[0].Height = baseZ;
+            if (hasEntrance)
+            {
+                ride.stations[0].Entrance = { coords.x, coords.y, baseZ, 0 };
+            }
+        }
+    }
+
+    for (auto& [key, tileElements] : tiles)
+    {
+        std::stable_sort(tileElements.begin(), tileElements.end(), [](const TileElement& a, const TileElement& b) {
+            return a.base_height < b.base_height;
+        });
+        for (auto& tileElement : tileElements)
+        {
+            tileElement.SetLastForTile(&tileElement == &tileElements.back());
+        }
+        TileCoordsXY coords = { static_cast<int32_t>(key % MAXIMUM_MAP_SIZE_TECHNICAL),
+                                static_cast<int32_t>(key / MAXIMUM_MAP_SIZE_TECHNICAL) };
+        snapshot.AddTile(coords, tileElements.data(), landHeight * 8);
+    }
+
+    snapshot._outsideTile = Tile{ snapshot._elements.size(), landHeight * 8 };
+    snapshot._elements.push_back(ride_ratings_snapshot_create_surface(landHeight));
+    return snapshot;
+}
+
+Ride& RideRatingsSnapshot::GetRide()
+{
+    return *_ride;
+}
+
+const Ride& RideRatingsSnapshot::GetRide() const
+{
+    return *_ride;
+}
+
+Ride* RideRatingsSnapshot::GetRide(ride_id_t rideIndex) const
+{
+    return rideIndex == _ride->id ? _ride.get() : nullptr;
+}
+
+const TileElement* RideRatingsSnapshot::GetFirstElementAt(const TileCoordsXY& coords) const
+{
+    if (coords.x < 0 || coords.y < 0 || coords.x >= MAXIMUM_MAP_SIZE_TECHNICAL || coords.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return nullptr;
+    }
+
+    auto it = _tiles.find(ride_ratings_snapshot_tile_key(coords));
+    if (it != _tiles.end())
+    {
+        return &_elements[it->second.FirstElement];
+    }
+    if (_outsideTile)
+    {
+        return &_elements[_outsideTile->FirstElement];
+    }
+    return nullptr;
+}
+
+int32_t RideRatingsSnapshot::GetSurfaceHeight(const TileCoordsXY& coords) const
+{
+    auto it = _tiles.find(ride_ratings_snapshot_tile_key(coords));
+    if (it != _tiles.end())
+    {
+        return it->second.SurfaceHeight;
+    }
+    if (_outsideTile)
+    {
+        return _outsideTile->SurfaceHeight;
+    }
+    return 16;
+}
+
+/**
+ * Same as track_block_get_next, on the snapshot.
+ */
+bool RideRatingsSnapshot::GetNextTrackBlock(
+    const CoordsXY& coords, const TileElement* tileElement, CoordsXY* outCoords, const TileElement** outElement) const
+{
+    auto ride = GetRide(tileElement->AsTrack()->GetRideIndex());
+    if (ride == nullptr)
+        return false;
+
+    int32_t trackType = tileElement->AsTrack()->GetTrackType();
+    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, trackType);
+    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, trackType);
+    if (trackBlock == nullptr || trackCoordinate == nullptr)
+        return false;
+    trackBlock += tileElement->AsTrack()->GetSequenceIndex();
+
+    uint8_t rotation = tileElement->GetDirection();
+    CoordsXY nextCoords = coords;
+    nextCoords += CoordsXY{ trackCoordinate->x, trackCoordinate->y }.Rotate(rotation);
+    nextCoords += CoordsXY{ trackBlock->x, trackBlock->y }.Rotate(direction_reverse(rotation));
+    int32_t z = (tileElement->base_height * 8) - trackBlock->z + trackCoordinate->z_end;
+    uint8_t direction = ((trackCoordinate->rotation_end + rotation) & TILE_ELEMENT_DIRECTION_MASK)
+        | (trackCoordinate->rotation_end & (1 << 2));
+
+    auto nextElement = FindNextTrackBlock(*ride, nextCoords, z, direction, &nextCoords);
+    if (nextElement == nullptr)
+        return false;
+
+    *outCoords = nextCoords;
+    *outElement = nextElement;
+    return true;
+}
+
+/**
+ * Same as track_block_get_next_from_zero, on the snapshot.
+ */
+const TileElement* RideRatingsSnapshot::FindNextTrackBlock(
+    const Ride& ride, const CoordsXY& coords, int32_t z, uint8_t direction, CoordsXY* outCoords) const
+{
+    CoordsXY nextCoords = coords;
+    if (!(direction & (1 << 2)))
+    {
+        nextCoords += CoordsDirectionDelta[direction];
+    }
+
+    const TileElement* tileElement = GetFirstElementAt(TileCoordsXY(nextCoords));
+    if (tileElement == nullptr)
+        return nullptr;
+
+    Ride* ridePtr = GetRide(ride.id);
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+            continue;
+        if (tileElement->AsTrack()->GetRideIndex() != ride.id)
+            continue;
+        if (tileElement->AsTrack()->GetSequenceIndex() != 0)
+            continue;
+        if (tileElement->IsGhost())
+            continue;
+
+        int32_t trackType = tileElement->AsTrack()->GetTrackType();
+        const rct_preview_track* nextTrackBlock = get_track_def_from_ride(ridePtr, trackType);
+        const rct_track_coordinates* nextTrackCoordinate = get_track_coord_from_ride(ridePtr, trackType);
+        if (nextTrackBlock == nullptr || nextTrackCoordinate == nullptr)
+            continue;
+
+        uint8_t nextRotation = tileElement->GetDirectionWithOffset(nextTrackCoordinate->rotation_begin)
+            | (nextTrackCoordinate->rotation_begin & (1 << 2));
+        if (nextRotation != direction)
+            continue;
+
+        int32_t nextZ = nextTrackCoordinate->z_begin - nextTrackBlock->z + (tileElement->base_height * 8);
+        if (nextZ != z)
+            continue;
+
+        *outCoords = nextCoords;
+        return tileElement;
+    } while (!(tileElement++)->IsLastForTile());
+
+    return nullptr;
+}
+
+/**
+ * Same as track_block_get_previous, on the snapshot.
+ */
+bool RideRatingsSnapshot::GetPreviousTrackBlock(
+    const CoordsXY& coords, const TileElement* tileElement, CoordsXYZ* outCoords, const TileElement** outElement) const
+{
+    auto ride = GetRide(tileElement->AsTrack()->GetRideIndex());
+    if (ride == nullptr)
+        return false;
+
+    int32_t trackType = tileElement->AsTrack()->GetTrackType();
+    const rct_preview_track* trackBlock = get_track_def_from_ride(ride, trackType);
+    const rct_track_coordinates* trackCoordinate = get_track_coord_from_ride(ride, trackType);
+    if (trackBlock == nullptr || trackCoordinate == nullptr)
+        return false;
+    trackBlock += tileElement->AsTrack()->GetSequenceIndex();
+
+    uint8_t rotation = tileElement->GetDirection();
+    CoordsXY previousCoords = coords;
+    previousCoords += CoordsXY{ trackBlock->x, trackBlock->y }.Rotate(direction_reverse(rotation));
+    int32_t z = (tileElement->base_height * 8) - trackBlock->z + trackCoordinate->z_begin;
+    uint8_t directionStart = ((trackCoordinate->rotation_begin + rotation) & TILE_ELEMENT_DIRECTION_MASK)
+        | (trackCoordinate->rotation_begin & (1 << 2));
+
+    uint8_t direction = direction_reverse(directionStart);
+    if (!(direction & (1 << 2)))
+    {
+        previousCoords += CoordsDirectionDelta[direction];
+    }
+
+    const TileElement* previousElement = GetFirstElementAt(TileCoordsXY(previousCoords));
+    if (previousElement == nullptr)
+        return false;
+
+    do
+    {
+        if (previousElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+            continue;
+        if (previousElement->AsTrack()->GetRideIndex() != ride->id)
+            continue;
+
+        int32_t previousTrackType = previousElement->AsTrack()->GetTrackType();
+        const rct_preview_track* firstTrackBlock = get_track_def_from_ride(ride, previousTrackType);
+        const rct_track_coordinates* previousTrackCoordinate = get_track_coord_from_ride(ride, previousTrackType);
+        if (firstTrackBlock == nullptr || previousTrackCoordinate == nullptr)
+            continue;
+
+        const rct_preview_track* previousTrackBlock = firstTrackBlock + previousElement->AsTrack()->GetSequenceIndex();
+        if ((previousTrackBlock + 1)->index != 255)
+            continue;
+
+        uint8_t previousRotation = previousElement->GetDirectionWithOffset(previousTrackCoordinate->rotation_end)
+            | (previousTrackCoordinate->rotation_end & (1 << 2));
+        if (previousRotation != directionStart)
+            continue;
+
+        int32_t previousZ = previousTrackCoordinate->z_end - previousTrackBlock->z + (previousElement->base_height * 8);
+        if (previousZ != z)
+            continue;
+
+        previousRotation = previousElement->GetDirectionWithOffset(previousTrackCoordinate->rotation_begin)
+            | (previousTrackCoordinate->rotation_begin & (1 << 2));
+        CoordsXY beginCoords = previousCoords;
+        beginCoords += CoordsXY{ previousTrackCoordinate->x, previousTrackCoordinate->y }.Rotate(
+            direction_reverse(previousRotation));
+
+        *outCoords = { beginCoords.x, beginCoords.y,
+                       (previousElement->base_height * 8) + firstTrackBlock->z - previousTrackBlock->z };
+        *outElement = previousElement;
+        return true;
+    } while (!(previousElement++)->IsLastForTile());
+
+    return false;
+}
+
+bool RideRatingsSnapshot::HasAdjacentStation(Ride* ride) const
+{
+    return _hasAdjacentStation;
+}
+
+int32_t RideRatingsSnapshot::GetAgeInMonths(const Ride& ride) const
+{
+    return _ageInMonths;
+}
+
+int32_t RideRatingsSnapshot::GetOpenRideCountOfType(uint8_t rideType) const
+{
+    return _openRideCountOfType;
+}
+
+void RideRatingsSnapshot::AddTile(const TileCoordsXY& coords, const TileElement* firstElement, int16_t surfaceHeight)
+{
+    _tiles[ride_ratings_snapshot_tile_key(coords)] = { _elements.size(), surfaceHeight };
+    do
+    {
+        _elements.push_back(*firstElement);
+    } while (!(firstElement++)->IsLastForTile());
+}
+
+#pragma endregion
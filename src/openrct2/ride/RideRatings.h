@@ -10,8 +10,17 @@
 #pragma once
 
 #include "../common.h"
+#include "../world/Location.hpp"
 #include "RideTypes.h"
 
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+struct TileElement;
+struct TrackDesign;
+
 using ride_rating = fixed16_2dp;
 
 // Convenience function for writing ride ratings. The result is a 16 bit signed
@@ -54,9 +63,100 @@ struct RideRatingCalculationData
     uint16_t num_brakes;
     uint16_t num_reversers;
     uint16_t station_flags;
+    uint16_t scenery_score;
+    bool has_adjacent_station;
+};
+
+/**
+ * Everything a rating calculation changes on a ride. Fields the ride type does not calculate keep the ride's values.
+ */
+struct RideRatingResult
+{
+    rating_tuple Ratings;
+    uint32_t LifecycleFlags;
+    money16 UpkeepCost;
+    uint16_t Value;
+    uint8_t UnreliabilityFactor;
+    uint8_t ShelteredEighths;
+};
+
+/**
+ * A copy of everything the rating calculation reads for one ride: the ride, the tiles around its track and the
+ * park-wide values that go into the ride's value. Rating a snapshot does not read the map or the ride list, so it
+ * can be done on any thread while the game carries on.
+ */
+class RideRatingsSnapshot
+{
+private:
+    struct Tile
+    {
+        size_t FirstElement;
+        int16_t SurfaceHeight;
+    };
+
+    std::unique_ptr<Ride> _ride;
+    std::vector<TileElement> _elements;
+    std::unordered_map<uint32_t, Tile> _tiles;
+    // What every tile that was not copied looks like, if anything.
+    std::optional<Tile> _outsideTile;
+    bool _hasAdjacentStation = false;
+    int32_t _ageInMonths = 0;
+    int32_t _openRideCountOfType = 0;
+
+public:
+    RideRatingsSnapshot();
+    RideRatingsSnapshot(RideRatingsSnapshot&&);
+    ~RideRatingsSnapshot();
+    RideRatingsSnapshot& operator=(RideRatingsSnapshot&&);
+
+    /**
+     * Copies the ride and the tiles its rating reads from the map. Must be called on the game thread.
+     */
+    static RideRatingsSnapshot FromRide(const Ride& ride);
+
+    /**
+     * Lays the design's track out on flat land, as if it was built in an empty park and has been tested with the
+     * stats stored in the design. Scenery in the design is not placed and the vehicle is not looked up, so the
+     * vehicle's rating multipliers only apply if the caller sets the ride's subtype. Returns nothing if the design
+     * has no station or does not fit on the map.
+     */
+    static std::optional<RideRatingsSnapshot> FromTrackDesign(const TrackDesign& td6);
+
+    Ride& GetRide();
+    const Ride& GetRide() const;
+    Ride* GetRide(ride_id_t rideIndex) const;
+
+    const TileElement* GetFirstElementAt(const TileCoordsXY& coords) const;
+    int32_t GetSurfaceHeight(const TileCoordsXY& coords) const;
+    bool GetNextTrackBlock(
+        const CoordsXY& coords, const TileElement* tileElement, CoordsXY* outCoords, const TileElement** outElement) const;
+    bool GetPreviousTrackBlock(
+        const CoordsXY& coords, const TileElement* tileElement, CoordsXYZ* outCoords, const TileElement** outElement) const;
+    bool HasAdjacentStation(Ride* ride) const;
+    int32_t GetAgeInMonths(const Ride& ride) const;
+    int32_t GetOpenRideCountOfType(uint8_t rideType) const;
+
+private:
+    const TileElement* FindNextTrackBlock(
+        const Ride& ride, const CoordsXY& coords, int32_t z, uint8_t direction, CoordsXY* outCoords) const;
+    void AddTile(const TileCoordsXY& coords, const TileElement* firstElement, int16_t surfaceHeight);
 };
 
 extern RideRatingCalculationData gRideRatingsCalcData;
 
 void ride_ratings_update_ride(const Ride& ride);
 void ride_ratings_update_all();
+
+/**
+ * Calculates the ride's ratings in one go using its own calculation state, without waiting for ride_ratings_update_all
+ * to get to the ride. Nothing is modified.
+ * Returns nothing if the ride can not be rated at the moment, e.g. it is closed or has no station.
+ */
+std::optional<RideRatingResult> ride_ratings_evaluate(const Ride& ride);
+
+/**
+ * Calculates the ratings of the snapshot's ride. Only reads the snapshot, so snapshots can be rated concurrently.
+ */
+std::optional<RideRatingResult> ride_ratings_evaluate(const RideRatingsSnapshot& snapshot);
+
+void ride_ratings_apply(Ride& ride, const RideRatingResult& result);
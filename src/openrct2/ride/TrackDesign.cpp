@@ -2367,8 +2367,16 @@ static map_backup* track_design_preview_backup_map()
     map_backup* backup = (map_backup*)malloc(sizeof(map_backup));
     if (backup != nullptr)
     {
+        // Bring every tile back into gTileElements so the copy below holds the whole map.
+        map_reorganise_elements();
         std::memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
-        std::memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                backup->tile_pointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL] = map_get_first_element_at(x, y);
+            }
+        }
         backup->next_free_tile_element = gNextFreeTileElement;
         backup->map_size_units = gMapSizeUnits;
         backup->map_size_units_minus_2 = gMapSizeMinus2;
@@ -2385,8 +2393,15 @@ static map_backup* track_design_preview_backup_map()
 static void track_design_preview_restore_map(map_backup* backup)
 {
     std::memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
-    std::memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            map_set_tile_elements(x, y, backup->tile_pointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL]);
+        }
+    }
     gNextFreeTileElement = backup->next_free_tile_element;
+    map_reset_tile_element_storage();
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
@@ -23,6 +23,7 @@
 #include "../object/ObjectRepository.h"
 #include "../object/RideObject.h"
 #include "RideGroupManager.h"
+#include "RideRatings.h"
 #include "TrackDesign.h"
 
 #include <algorithm>
@@ -38,6 +39,7 @@ struct TrackRepositoryItem
     uint8_t RideType = 0;
     std::string ObjectEntry;
     uint32_t Flags = 0;
+    rating_tuple Ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
 };
 
 enum TRACK_REPO_ITEM_FLAGS
@@ -57,7 +59,7 @@ class TrackDesignFileIndex final : public FileIndex<TrackRepositoryItem>
 {
 private:
     static constexpr uint32_t MAGIC_NUMBER = 0x58444954; // TIDX
-    static constexpr uint16_t VERSION = 2;
+    static constexpr uint16_t VERSION = 3;
     static constexpr auto PATTERN = "*.td4;*.td6";
 
 public:
@@ -88,6 +90,17 @@ public:
             {
                 item.Flags |= TRIF_READ_ONLY;
             }
+
+            // Only reads the design, so it is fine on the index worker threads
+            auto snapshot = RideRatingsSnapshot::FromTrackDesign(*td6);
+            if (snapshot)
+            {
+                auto result = ride_ratings_evaluate(*snapshot);
+                if (result)
+                {
+                    item.Ratings = result->Ratings;
+                }
+            }
             return std::make_tuple(true, item);
         }
         else
@@ -104,6 +117,7 @@ protected:
         stream->WriteValue(item.RideType);
         stream->WriteString(item.ObjectEntry);
         stream->WriteValue(item.Flags);
+        stream->WriteValue(item.Ratings);
     }
 
     TrackRepositoryItem Deserialise(IStream* stream) const override
@@ -114,6 +128,7 @@ protected:
         item.RideType = stream->ReadValue<uint8_t>();
         item.ObjectEntry = stream->ReadStdString();
         item.Flags = stream->ReadValue<uint32_t>();
+        item.Ratings = stream->ReadValue<rating_tuple>();
         return item;
     }
 
@@ -234,6 +249,7 @@ public:
                 track_design_file_ref ref;
                 ref.name = String::Duplicate(GetNameFromTrackPath(item.Path));
                 ref.path = String::Duplicate(item.Path);
+                ref.ratings = item.Ratings;
                 refs.push_back(ref);
             }
         }
@@ -262,6 +278,7 @@ public:
                 track_design_file_ref ref;
                 ref.name = String::Duplicate(GetNameFromTrackPath(item.Path));
                 ref.path = String::Duplicate(item.Path);
+                ref.ratings = item.Ratings;
                 refs.push_back(ref);
             }
         }
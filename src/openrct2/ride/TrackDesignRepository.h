@@ -11,6 +11,7 @@
 
 #include "../common.h"
 #include "RideGroupManager.h"
+#include "RideRatings.h"
 
 #include <memory>
 
@@ -18,6 +19,8 @@ struct track_design_file_ref
 {
     utf8* name;
     utf8* path;
+    // Worked out from the design when it was indexed, undefined if it could not be rated.
+    rating_tuple ratings;
 };
 
 #include <string>
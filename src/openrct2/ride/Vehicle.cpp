@@ -1338,11 +1338,13 @@ void vehicle_update_all()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gS6Info.editor_step != EDITOR_STEP_ROLLERCOASTER_DESIGNER)
         return;
 
+    const auto& hotFields = sprite_hot_fields();
     sprite_index = gSpriteListHead[SPRITE_LIST_VEHICLE_HEAD];
     while (sprite_index != SPRITE_INDEX_NULL)
     {
         vehicle = GET_VEHICLE(sprite_index);
-        sprite_index = vehicle->next;
+        sprite_index = hotFields.Next[sprite_index];
+        sprite_prefetch(sprite_index);
 
         vehicle_update(vehicle);
     }
@@ -6428,39 +6430,33 @@ bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        uint16_t spriteIdx = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        while (spriteIdx != SPRITE_INDEX_NULL)
-        {
-            rct_vehicle* vehicle2 = GET_VEHICLE(spriteIdx);
-            spriteIdx = vehicle2->next_in_quadrant;
-
+        bool collided = sprite_query_tile<rct_vehicle>(location.x * 32, location.y * 32, [&](rct_vehicle* vehicle2) {
             if (vehicle2 == vehicle)
-                continue;
-
-            if (vehicle2->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
-                continue;
+                return false;
 
             if (vehicle2->ride != rideIndex)
-                continue;
+                return false;
 
             int32_t distX = abs(x - vehicle2->x);
             if (distX > 32768)
-                continue;
+                return false;
 
             int32_t distY = abs(y - vehicle2->y);
             if (distY > 32768)
-                continue;
+                return false;
 
             int32_t ecx = (vehicle->var_44 + vehicle2->var_44) / 2;
             ecx *= 30;
             ecx >>= 8;
-            if (std::max(distX, distY) < ecx)
-            {
-                if (spriteId != nullptr)
-                    *spriteId = vehicle2->sprite_index;
-                return true;
-            }
-        }
+            if (std::max(distX, distY) >= ecx)
+                return false;
+
+            if (spriteId != nullptr)
+                *spriteId = vehicle2->sprite_index;
+            return true;
+        });
+        if (collided)
+            return true;
     }
 
     return false;
@@ -7661,16 +7657,13 @@ static bool vehicle_update_motion_collision_detection(
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        collideId = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        for (; collideId != SPRITE_INDEX_NULL; collideId = collideVehicle->next_in_quadrant)
+        collideId = sprite_get_first_of_type_in_quadrant(SPRITE_IDENTIFIER_VEHICLE, location.x * 32, location.y * 32);
+        for (; collideId != SPRITE_INDEX_NULL; collideId = sprite_get_next_of_type_in_quadrant(collideId))
         {
             collideVehicle = GET_VEHICLE(collideId);
             if (collideVehicle == vehicle)
                 continue;
 
-            if (collideVehicle->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
-                continue;
-
             int32_t z_diff = abs(collideVehicle->z - z);
 
             if (z_diff > 16)
@@ -10010,6 +10003,7 @@ void rct_vehicle::SetState(VEHICLE_STATUS vehicleStatus, uint8_t subState)
 {
     status = vehicleStatus;
     sub_state = subState;
+    sprite_hot_fields_set_state(sprite_index, status);
     vehicle_invalidate_window(this);
 }
 
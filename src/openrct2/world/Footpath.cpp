@@ -22,6 +22,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/Peep.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -402,22 +403,15 @@ void footpath_bridge_get_info_from_pos(
  */
 void footpath_remove_litter(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
-    {
-        rct_litter* sprite = &get_sprite(spriteIndex)->litter;
-        uint16_t nextSpriteIndex = sprite->next_in_quadrant;
-        if (sprite->linked_list_index == SPRITE_LIST_LITTER)
+    sprite_query_tile<rct_litter>(x, y, [z](rct_litter* sprite) {
+        int32_t distanceZ = abs(sprite->z - z);
+        if (distanceZ <= 32)
         {
-            int32_t distanceZ = abs(sprite->z - z);
-            if (distanceZ <= 32)
-            {
-                invalidate_sprite_0((rct_sprite*)sprite);
-                sprite_remove((rct_sprite*)sprite);
-            }
+            invalidate_sprite_0((rct_sprite*)sprite);
+            sprite_remove((rct_sprite*)sprite);
         }
-        spriteIndex = nextSpriteIndex;
-    }
+        return false;
+    });
 }
 
 /**
@@ -426,27 +420,20 @@ void footpath_remove_litter(int32_t x, int32_t y, int32_t z)
  */
 void footpath_interrupt_peeps(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
-    {
-        Peep* peep = &get_sprite(spriteIndex)->peep;
-        uint16_t nextSpriteIndex = peep->next_in_quadrant;
-        if (peep->linked_list_index == SPRITE_LIST_PEEP)
+    sprite_query_tile<Peep>(x, y, [z](Peep* peep) {
+        if (peep->state == PEEP_STATE_SITTING || peep->state == PEEP_STATE_WATCHING)
         {
-            if (peep->state == PEEP_STATE_SITTING || peep->state == PEEP_STATE_WATCHING)
+            if (peep->z == z)
             {
-                if (peep->z == z)
-                {
-                    peep->SetState(PEEP_STATE_WALKING);
-                    peep->destination_x = (peep->x & 0xFFE0) + 16;
-                    peep->destination_y = (peep->y & 0xFFE0) + 16;
-                    peep->destination_tolerance = 5;
-                    peep->UpdateCurrentActionSpriteType();
-                }
+                peep->SetState(PEEP_STATE_WALKING);
+                peep->destination_x = (peep->x & 0xFFE0) + 16;
+                peep->destination_y = (peep->y & 0xFFE0) + 16;
+                peep->destination_tolerance = 5;
+                peep->UpdateCurrentActionSpriteType();
             }
         }
-        spriteIndex = nextSpriteIndex;
-    }
+        return false;
+    });
 }
 
 /**
@@ -990,6 +977,8 @@ void footpath_connect_edges(int32_t x, int32_t y, TileElement* tileElement, int3
     rct_neighbour neighbour;
 
     footpath_update_queue_chains();
+    map_invalidate_path_wide_flags({ x, y });
+    peep_pathfind_invalidate_paths({ x, y });
 
     neighbour_list_init(&neighbourList);
 
@@ -1128,6 +1117,7 @@ void footpath_chain_ride_queue(
             tileElement->AsPath()->SetStationIndex(entranceIndex);
 
             map_invalidate_element(x, y, tileElement);
+            peep_pathfind_invalidate_paths({ x, y });
 
             if (lastQueuePathElement == nullptr)
             {
@@ -1610,23 +1600,6 @@ void PathElement::SetShouldDrawPathOverSupports(bool on)
     log_verbose("Setting 'draw path over supports' to %d", (size_t)on);
 }
 
-/**
- *
- *  rct2: 0x006A8B12
- *  clears the wide footpath flag for all footpaths
- *  at location
- */
-static void footpath_clear_wide(int32_t x, int32_t y)
-{
-    TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
-    do
-    {
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
-            continue;
-        tileElement->AsPath()->SetWide(false);
-    } while (!(tileElement++)->IsLastForTile());
-}
-
 /**
  *
  *  rct2: 0x006A8ACF
@@ -1636,6 +1609,9 @@ static void footpath_clear_wide(int32_t x, int32_t y)
 static TileElement* footpath_can_be_wide(int32_t x, int32_t y, uint8_t height)
 {
     TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
+    if (tileElement == nullptr)
+        return nullptr;
+
     do
     {
         if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
@@ -1653,209 +1629,216 @@ static TileElement* footpath_can_be_wide(int32_t x, int32_t y, uint8_t height)
 }
 
 /**
- *
- *  rct2: 0x006A87BB
+ * Whether the given path element should be wide, only looks at the wide flags of the tiles before it in tile order.
  */
-void footpath_update_path_wide_flags(int32_t x, int32_t y)
+static bool footpath_element_should_be_wide(int32_t x, int32_t y, TileElement* tileElement)
 {
-    if (x < 0x20)
-        return;
-    if (y < 0x20)
-        return;
-    if (x > 0x1FDF)
-        return;
-    if (y > 0x1FDF)
-        return;
+    /* Only the wide flags of the tiles before this one in tile order
+     * (pathList indexes 0, 1, 6 and 7) are read, the following tiles are
+     * treated as if they were not wide. The result is therefore the same as
+     * that of a single sweep over the map in tile order, which the
+     * incremental updates in map_update_path_wide_flags rely on. */
 
-    footpath_clear_wide(x, y);
-    /* Rather than clearing the wide flag of the following tiles and
-     * checking the state of them later, leave them intact and assume
-     * they were cleared. Consequently only the wide flag for this single
-     * tile is modified by this update.
-     * This is important for avoiding glitches in pathfinding that occurs
-     * between the batches of updates to the path wide flags.
-     * Corresponding pathList[] indexes for the following tiles
-     * are: 2, 3, 4, 5.
-     * Note: indexes 3, 4, 5 are reset in the current call;
-     *       index 2 is reset in the previous call. */
-    // x += 0x20;
-    // footpath_clear_wide(x, y);
-    // y += 0x20;
-    // footpath_clear_wide(x, y);
-    // x -= 0x20;
-    // footpath_clear_wide(x, y);
-    // y -= 0x20;
-
-    TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
-    do
-    {
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
-            continue;
-
-        if (tileElement->AsPath()->IsQueue())
-            continue;
+    if (tileElement->AsPath()->IsQueue())
+        return false;
 
-        if (tileElement->AsPath()->IsSloped())
-            continue;
+    if (tileElement->AsPath()->IsSloped())
+        return false;
 
-        if (tileElement->AsPath()->GetEdges() == 0)
-            continue;
+    if (tileElement->AsPath()->GetEdges() == 0)
+        return false;
 
-        uint8_t height = tileElement->base_height;
-
-        // pathList is a list of elements, set by sub_6A8ACF adjacent to x,y
-        // Spanned from 0x00F3EFA8 to 0x00F3EFC7 (8 elements) in the original
-        TileElement* pathList[8];
-
-        x -= 0x20;
-        y -= 0x20;
-        pathList[0] = footpath_can_be_wide(x, y, height);
-        y += 0x20;
-        pathList[1] = footpath_can_be_wide(x, y, height);
-        y += 0x20;
-        pathList[2] = footpath_can_be_wide(x, y, height);
-        x += 0x20;
-        pathList[3] = footpath_can_be_wide(x, y, height);
-        x += 0x20;
-        pathList[4] = footpath_can_be_wide(x, y, height);
-        y -= 0x20;
-        pathList[5] = footpath_can_be_wide(x, y, height);
-        y -= 0x20;
-        pathList[6] = footpath_can_be_wide(x, y, height);
-        x -= 0x20;
-        pathList[7] = footpath_can_be_wide(x, y, height);
-        y += 0x20;
-
-        uint8_t pathConnections = 0;
-        if (tileElement->AsPath()->GetEdges() & EDGE_NW)
+    uint8_t height = tileElement->base_height;
+
+    // pathList is a list of elements, set by sub_6A8ACF adjacent to x,y
+    // Spanned from 0x00F3EFA8 to 0x00F3EFC7 (8 elements) in the original
+    TileElement* pathList[8];
+
+    x -= 0x20;
+    y -= 0x20;
+    pathList[0] = footpath_can_be_wide(x, y, height);
+    y += 0x20;
+    pathList[1] = footpath_can_be_wide(x, y, height);
+    y += 0x20;
+    pathList[2] = footpath_can_be_wide(x, y, height);
+    x += 0x20;
+    pathList[3] = footpath_can_be_wide(x, y, height);
+    x += 0x20;
+    pathList[4] = footpath_can_be_wide(x, y, height);
+    y -= 0x20;
+    pathList[5] = footpath_can_be_wide(x, y, height);
+    y -= 0x20;
+    pathList[6] = footpath_can_be_wide(x, y, height);
+    x -= 0x20;
+    pathList[7] = footpath_can_be_wide(x, y, height);
+    y += 0x20;
+
+    uint8_t pathConnections = 0;
+    if (tileElement->AsPath()->GetEdges() & EDGE_NW)
+    {
+        pathConnections |= FOOTPATH_CONNECTION_NW;
+        if (pathList[7] != nullptr && pathList[7]->AsPath()->IsWide())
         {
-            pathConnections |= FOOTPATH_CONNECTION_NW;
-            if (pathList[7] != nullptr && pathList[7]->AsPath()->IsWide())
-            {
-                pathConnections &= ~FOOTPATH_CONNECTION_NW;
-            }
+            pathConnections &= ~FOOTPATH_CONNECTION_NW;
         }
+    }
 
-        if (tileElement->AsPath()->GetEdges() & EDGE_NE)
+    if (tileElement->AsPath()->GetEdges() & EDGE_NE)
+    {
+        pathConnections |= FOOTPATH_CONNECTION_NE;
+        if (pathList[1] != nullptr && pathList[1]->AsPath()->IsWide())
         {
-            pathConnections |= FOOTPATH_CONNECTION_NE;
-            if (pathList[1] != nullptr && pathList[1]->AsPath()->IsWide())
-            {
-                pathConnections &= ~FOOTPATH_CONNECTION_NE;
-            }
+            pathConnections &= ~FOOTPATH_CONNECTION_NE;
         }
+    }
 
-        if (tileElement->AsPath()->GetEdges() & EDGE_SE)
+    if (tileElement->AsPath()->GetEdges() & EDGE_SE)
+    {
+        pathConnections |= FOOTPATH_CONNECTION_SE;
+        /* In the following:
+         * footpath_element_is_wide(pathList[3])
+         * is always false due to the tile update order
+         * in combination with reset tiles.
+         * Commented out since it will never occur. */
+        // if (pathList[3] != nullptr) {
+        //  if (footpath_element_is_wide(pathList[3])) {
+        //      pathConnections &= ~FOOTPATH_CONNECTION_SE;
+        //  }
+        //}
+    }
+
+    if (tileElement->AsPath()->GetEdges() & EDGE_SW)
+    {
+        pathConnections |= FOOTPATH_CONNECTION_SW;
+        /* In the following:
+         * footpath_element_is_wide(pathList[5])
+         * is always false due to the tile update order
+         * in combination with reset tiles.
+         * Commented out since it will never occur. */
+        // if (pathList[5] != nullptr) {
+        //  if (footpath_element_is_wide(pathList[5])) {
+        //      pathConnections &= ~FOOTPATH_CONNECTION_SW;
+        //  }
+        //}
+    }
+
+    if ((pathConnections & FOOTPATH_CONNECTION_NW) && pathList[7] != nullptr && !pathList[7]->AsPath()->IsWide())
+    {
+        constexpr uint8_t edgeMask1 = EDGE_SE | EDGE_SW;
+        if ((pathConnections & FOOTPATH_CONNECTION_NE) && pathList[0] != nullptr && !pathList[0]->AsPath()->IsWide()
+            && (pathList[0]->AsPath()->GetEdges() & edgeMask1) == edgeMask1 && pathList[1] != nullptr
+            && !pathList[1]->AsPath()->IsWide())
         {
-            pathConnections |= FOOTPATH_CONNECTION_SE;
-            /* In the following:
-             * footpath_element_is_wide(pathList[3])
-             * is always false due to the tile update order
-             * in combination with reset tiles.
-             * Commented out since it will never occur. */
-            // if (pathList[3] != nullptr) {
-            //  if (footpath_element_is_wide(pathList[3])) {
-            //      pathConnections &= ~FOOTPATH_CONNECTION_SE;
-            //  }
-            //}
+            pathConnections |= FOOTPATH_CONNECTION_S;
         }
 
-        if (tileElement->AsPath()->GetEdges() & EDGE_SW)
+        /* In the following:
+         * footpath_element_is_wide(pathList[5])
+         * is always false due to the tile update order
+         * in combination with reset tiles.
+         * Short circuit the logic appropriately. */
+        constexpr uint8_t edgeMask2 = EDGE_NE | EDGE_SE;
+        if ((pathConnections & FOOTPATH_CONNECTION_SW) && pathList[6] != nullptr && !(pathList[6])->AsPath()->IsWide()
+            && (pathList[6]->AsPath()->GetEdges() & edgeMask2) == edgeMask2 && pathList[5] != nullptr)
         {
-            pathConnections |= FOOTPATH_CONNECTION_SW;
-            /* In the following:
-             * footpath_element_is_wide(pathList[5])
-             * is always false due to the tile update order
-             * in combination with reset tiles.
-             * Commented out since it will never occur. */
-            // if (pathList[5] != nullptr) {
-            //  if (footpath_element_is_wide(pathList[5])) {
-            //      pathConnections &= ~FOOTPATH_CONNECTION_SW;
-            //  }
-            //}
+            pathConnections |= FOOTPATH_CONNECTION_E;
         }
+    }
 
-        if ((pathConnections & FOOTPATH_CONNECTION_NW) && pathList[7] != nullptr && !pathList[7]->AsPath()->IsWide())
+    /* In the following:
+     * footpath_element_is_wide(pathList[2])
+     * footpath_element_is_wide(pathList[3])
+     * are always false due to the tile update order
+     * in combination with reset tiles.
+     * Short circuit the logic appropriately. */
+    if ((pathConnections & FOOTPATH_CONNECTION_SE) && pathList[3] != nullptr)
+    {
+        constexpr uint8_t edgeMask1 = EDGE_SW | EDGE_NW;
+        if ((pathConnections & FOOTPATH_CONNECTION_NE) && (pathList[2] != nullptr)
+            && (pathList[2]->AsPath()->GetEdges() & edgeMask1) == edgeMask1 && pathList[1] != nullptr
+            && !pathList[1]->AsPath()->IsWide())
         {
-            constexpr uint8_t edgeMask1 = EDGE_SE | EDGE_SW;
-            if ((pathConnections & FOOTPATH_CONNECTION_NE) && pathList[0] != nullptr && !pathList[0]->AsPath()->IsWide()
-                && (pathList[0]->AsPath()->GetEdges() & edgeMask1) == edgeMask1 && pathList[1] != nullptr
-                && !pathList[1]->AsPath()->IsWide())
-            {
-                pathConnections |= FOOTPATH_CONNECTION_S;
-            }
-
-            /* In the following:
-             * footpath_element_is_wide(pathList[5])
-             * is always false due to the tile update order
-             * in combination with reset tiles.
-             * Short circuit the logic appropriately. */
-            constexpr uint8_t edgeMask2 = EDGE_NE | EDGE_SE;
-            if ((pathConnections & FOOTPATH_CONNECTION_SW) && pathList[6] != nullptr && !(pathList[6])->AsPath()->IsWide()
-                && (pathList[6]->AsPath()->GetEdges() & edgeMask2) == edgeMask2 && pathList[5] != nullptr)
-            {
-                pathConnections |= FOOTPATH_CONNECTION_E;
-            }
+            pathConnections |= FOOTPATH_CONNECTION_W;
         }
 
         /* In the following:
-         * footpath_element_is_wide(pathList[2])
-         * footpath_element_is_wide(pathList[3])
+         * footpath_element_is_wide(pathList[4])
+         * footpath_element_is_wide(pathList[5])
          * are always false due to the tile update order
          * in combination with reset tiles.
          * Short circuit the logic appropriately. */
-        if ((pathConnections & FOOTPATH_CONNECTION_SE) && pathList[3] != nullptr)
+        constexpr uint8_t edgeMask2 = EDGE_NE | EDGE_NW;
+        if ((pathConnections & FOOTPATH_CONNECTION_SW) && pathList[4] != nullptr
+            && (pathList[4]->AsPath()->GetEdges() & edgeMask2) == edgeMask2 && pathList[5] != nullptr)
         {
-            constexpr uint8_t edgeMask1 = EDGE_SW | EDGE_NW;
-            if ((pathConnections & FOOTPATH_CONNECTION_NE) && (pathList[2] != nullptr)
-                && (pathList[2]->AsPath()->GetEdges() & edgeMask1) == edgeMask1 && pathList[1] != nullptr
-                && !pathList[1]->AsPath()->IsWide())
-            {
-                pathConnections |= FOOTPATH_CONNECTION_W;
-            }
-
-            /* In the following:
-             * footpath_element_is_wide(pathList[4])
-             * footpath_element_is_wide(pathList[5])
-             * are always false due to the tile update order
-             * in combination with reset tiles.
-             * Short circuit the logic appropriately. */
-            constexpr uint8_t edgeMask2 = EDGE_NE | EDGE_NW;
-            if ((pathConnections & FOOTPATH_CONNECTION_SW) && pathList[4] != nullptr
-                && (pathList[4]->AsPath()->GetEdges() & edgeMask2) == edgeMask2 && pathList[5] != nullptr)
-            {
-                pathConnections |= FOOTPATH_CONNECTION_N;
-            }
+            pathConnections |= FOOTPATH_CONNECTION_N;
         }
+    }
 
-        if ((pathConnections & FOOTPATH_CONNECTION_NW) && (pathConnections & (FOOTPATH_CONNECTION_E | FOOTPATH_CONNECTION_S)))
-        {
-            pathConnections &= ~FOOTPATH_CONNECTION_NW;
-        }
+    if ((pathConnections & FOOTPATH_CONNECTION_NW) && (pathConnections & (FOOTPATH_CONNECTION_E | FOOTPATH_CONNECTION_S)))
+    {
+        pathConnections &= ~FOOTPATH_CONNECTION_NW;
+    }
 
-        if ((pathConnections & FOOTPATH_CONNECTION_NE) && (pathConnections & (FOOTPATH_CONNECTION_W | FOOTPATH_CONNECTION_S)))
-        {
-            pathConnections &= ~FOOTPATH_CONNECTION_NE;
-        }
+    if ((pathConnections & FOOTPATH_CONNECTION_NE) && (pathConnections & (FOOTPATH_CONNECTION_W | FOOTPATH_CONNECTION_S)))
+    {
+        pathConnections &= ~FOOTPATH_CONNECTION_NE;
+    }
 
-        if ((pathConnections & FOOTPATH_CONNECTION_SE) && (pathConnections & (FOOTPATH_CONNECTION_N | FOOTPATH_CONNECTION_W)))
-        {
-            pathConnections &= ~FOOTPATH_CONNECTION_SE;
-        }
+    if ((pathConnections & FOOTPATH_CONNECTION_SE) && (pathConnections & (FOOTPATH_CONNECTION_N | FOOTPATH_CONNECTION_W)))
+    {
+        pathConnections &= ~FOOTPATH_CONNECTION_SE;
+    }
 
-        if ((pathConnections & FOOTPATH_CONNECTION_SW) && (pathConnections & (FOOTPATH_CONNECTION_E | FOOTPATH_CONNECTION_N)))
-        {
-            pathConnections &= ~FOOTPATH_CONNECTION_SW;
-        }
+    if ((pathConnections & FOOTPATH_CONNECTION_SW) && (pathConnections & (FOOTPATH_CONNECTION_E | FOOTPATH_CONNECTION_N)))
+    {
+        pathConnections &= ~FOOTPATH_CONNECTION_SW;
+    }
+
+    if (!(pathConnections
+          & (FOOTPATH_CONNECTION_NE | FOOTPATH_CONNECTION_SE | FOOTPATH_CONNECTION_SW | FOOTPATH_CONNECTION_NW)))
+    {
+        uint8_t e = tileElement->AsPath()->GetEdgesAndCorners();
+        if ((e != 0b10101111) && (e != 0b01011111) && (e != 0b11101111))
+            return true;
+    }
+    return false;
+}
+
+/**
+ *
+ *  rct2: 0x006A87BB
+ *  Returns whether the wide flag of any path on the tile changed.
+ */
+bool footpath_update_path_wide_flags(int32_t x, int32_t y)
+{
+    if (x < 0x20)
+        return false;
+    if (y < 0x20)
+        return false;
+    if (x > 0x1FDF)
+        return false;
+    if (y > 0x1FDF)
+        return false;
+
+    TileElement* tileElement = map_get_first_element_at(x / 32, y / 32);
+    if (tileElement == nullptr)
+        return false;
+
+    bool changed = false;
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
 
-        if (!(pathConnections
-              & (FOOTPATH_CONNECTION_NE | FOOTPATH_CONNECTION_SE | FOOTPATH_CONNECTION_SW | FOOTPATH_CONNECTION_NW)))
+        bool isWide = footpath_element_should_be_wide(x, y, tileElement);
+        if (tileElement->AsPath()->IsWide() != isWide)
         {
-            uint8_t e = tileElement->AsPath()->GetEdgesAndCorners();
-            if ((e != 0b10101111) && (e != 0b01011111) && (e != 0b11101111))
-                tileElement->AsPath()->SetWide(true);
+            tileElement->AsPath()->SetWide(isWide);
+            changed = true;
         }
     } while (!(tileElement++)->IsLastForTile());
+    return changed;
 }
 
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
@@ -2114,6 +2097,8 @@ void footpath_remove_edges_at(int32_t x, int32_t y, TileElement* tileElement)
     }
 
     footpath_update_queue_entrance_banner(x, y, tileElement);
+    map_invalidate_path_wide_flags({ x, y });
+    peep_pathfind_invalidate_paths({ x, y });
 
     bool fixCorners = false;
     for (uint8_t direction = 0; direction < 4; direction++)
@@ -36,6 +36,7 @@
 #include "../network/network.h"
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../peep/Peep.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -56,7 +57,9 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
+#include <memory>
 
 using namespace OpenRCT2;
 
@@ -89,13 +92,40 @@ int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
 
 TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 std::vector<CoordsXY> gMapSelectionTiles;
 std::vector<PeepSpawn> gPeepSpawns;
 
 TileElement* gNextFreeTileElement;
 uint32_t gNextFreeTileElementPointerIndex;
 
+// Tiles own a run of elements with some slack so most inserts and removes stay within the tile. Runs are handed out in
+// power of two sizes, freed runs are kept per size class and reused before new memory is taken. gTileElements is the
+// first block that loaded maps live in, further blocks are allocated once it is used up.
+static constexpr uint32_t TILE_ELEMENT_SIZE_CLASS_COUNT = 18;
+static constexpr uint32_t TILE_ELEMENT_BLOCK_SIZE = 0x10000;
+
+// The first element and capacity of each tile are kept in square chunks of tiles. map_init allocates every chunk up to
+// the technical maximum and gives each tile a surface, so every tile in range always has elements.
+static constexpr int32_t TILE_CHUNK_SHIFT = 5;
+static constexpr int32_t TILE_CHUNK_SIZE = 1 << TILE_CHUNK_SHIFT;
+static constexpr int32_t TILE_CHUNK_MASK = TILE_CHUNK_SIZE - 1;
+static constexpr int32_t TILE_CHUNKS_PER_ROW = (MAXIMUM_MAP_SIZE_TECHNICAL + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+
+struct TileChunk
+{
+    TileElement* FirstElements[TILE_CHUNK_SIZE * TILE_CHUNK_SIZE]{};
+    uint32_t Capacities[TILE_CHUNK_SIZE * TILE_CHUNK_SIZE]{};
+};
+
+static std::unique_ptr<TileChunk> _tileChunks[TILE_CHUNKS_PER_ROW * TILE_CHUNKS_PER_ROW];
+
+// Tiles whose wide path flags have to be recomputed when the sweep reaches them.
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _pathWideDirtyTileFlags;
+static std::vector<TileElement*> _freeTileElementRuns[TILE_ELEMENT_SIZE_CLASS_COUNT];
+static std::vector<std::unique_ptr<TileElement[]>> _tileElementBlocks;
+static TileElement* _tileElementBlockEnd = std::end(gTileElements);
+static uint32_t _tileElementCount;
+
 bool gLandMountainMode;
 bool gLandPaintMode;
 bool gClearSmallScenery;
@@ -110,6 +140,7 @@ LocationXYZ16 gCommandPosition;
 bool gMapLandRightsUpdateSuccess;
 
 static void clear_elements_at(const CoordsXY& loc);
+static void map_allocate_tiles();
 static ScreenCoordsXY translate_3d_to_2d(int32_t rotation, const CoordsXY& pos);
 
 void rotate_map_coordinates(int16_t* x, int16_t* y, int32_t rotation)
@@ -181,6 +212,26 @@ void tile_element_iterator_restart_for_tile(tile_element_iterator* it)
     it->element = nullptr;
 }
 
+static std::unique_ptr<TileChunk>& tile_chunk_at(int32_t x, int32_t y)
+{
+    return _tileChunks[(x >> TILE_CHUNK_SHIFT) + (y >> TILE_CHUNK_SHIFT) * TILE_CHUNKS_PER_ROW];
+}
+
+static size_t tile_chunk_index(int32_t x, int32_t y)
+{
+    return (x & TILE_CHUNK_MASK) + ((y & TILE_CHUNK_MASK) << TILE_CHUNK_SHIFT);
+}
+
+static TileChunk& tile_chunk_get_or_create(int32_t x, int32_t y)
+{
+    auto& chunk = tile_chunk_at(x, y);
+    if (chunk == nullptr)
+    {
+        chunk = std::make_unique<TileChunk>();
+    }
+    return *chunk;
+}
+
 TileElement* map_get_first_element_at(int32_t x, int32_t y)
 {
     if (x < 0 || y < 0 || x > (MAXIMUM_MAP_SIZE_TECHNICAL - 1) || y > (MAXIMUM_MAP_SIZE_TECHNICAL - 1))
@@ -188,7 +239,13 @@ TileElement* map_get_first_element_at(int32_t x, int32_t y)
         log_error("Trying to access element outside of range");
         return nullptr;
     }
-    return gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+
+    const auto& chunk = tile_chunk_at(x, y);
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+    return chunk->FirstElements[tile_chunk_index(x, y)];
 }
 
 TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n)
@@ -225,7 +282,8 @@ void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements)
         log_error("Trying to access element outside of range");
         return;
     }
-    gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+
+    tile_chunk_get_or_create(x, y).FirstElements[tile_chunk_index(x, y)] = elements;
 }
 
 SurfaceElement* map_get_surface_element_at(int32_t x, int32_t y)
@@ -306,21 +364,13 @@ void map_init(int32_t size)
 {
     gNextFreeTileElementPointerIndex = 0;
 
-    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+    for (auto& chunk : _tileChunks)
     {
-        TileElement* tile_element = &gTileElements[i];
-        tile_element->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-        tile_element->SetLastForTile(true);
-        tile_element->base_height = 14;
-        tile_element->clearance_height = 14;
-        tile_element->AsSurface()->SetWaterHeight(0);
-        tile_element->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
-        tile_element->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-        tile_element->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
-        tile_element->AsSurface()->SetParkFences(0);
-        tile_element->AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
-        tile_element->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
+        chunk.reset();
     }
+    gNextFreeTileElement = gTileElements;
+    map_reset_tile_element_storage();
+    map_allocate_tiles();
 
     gGrassSceneryTileLoopPosition = 0;
     gWidePathTileLoopX = 0;
@@ -330,7 +380,7 @@ void map_init(int32_t size)
     gMapSize = size;
     gMapSizeMaxXY = size * 32 - 33;
     gMapBaseZ = 7;
-    map_update_tile_pointers();
+    map_invalidate_all_path_wide_flags();
     map_remove_out_of_range_elements();
     AutoCreateMapAnimations();
 
@@ -402,26 +452,155 @@ void map_strip_ghost_flag_from_elements()
  */
 void map_update_tile_pointers()
 {
-    int32_t i, x, y;
-
-    for (i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
-    {
-        gTileElementTilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
-    }
-
     TileElement* tileElement = gTileElements;
-    TileElement** tile = gTileElementTilePointers;
-    for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
-        for (x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
         {
-            *tile++ = tileElement;
+            map_set_tile_elements(x, y, tileElement);
             while (!(tileElement++)->IsLastForTile())
                 ;
         }
     }
 
     gNextFreeTileElement = tileElement;
+    map_reset_tile_element_storage();
+}
+
+static uint32_t tile_element_count_for_tile(const TileElement* tileElement)
+{
+    if (tileElement == nullptr)
+    {
+        return 0;
+    }
+
+    uint32_t numElements = 1;
+    while (!(tileElement++)->IsLastForTile())
+    {
+        numElements++;
+    }
+    return numElements;
+}
+
+/**
+ * Forgets all runs and blocks and releases chunks without tiles, the tile pointers must only point into gTileElements
+ * below gNextFreeTileElement.
+ */
+void map_reset_tile_element_storage()
+{
+    for (auto& freeRuns : _freeTileElementRuns)
+    {
+        freeRuns.clear();
+    }
+    _tileElementBlocks.clear();
+    _tileElementBlockEnd = std::end(gTileElements);
+
+    _tileElementCount = 0;
+    for (auto& chunk : _tileChunks)
+    {
+        if (chunk == nullptr)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < std::size(chunk->FirstElements); i++)
+        {
+            chunk->Capacities[i] = tile_element_count_for_tile(chunk->FirstElements[i]);
+            _tileElementCount += chunk->Capacities[i];
+        }
+    }
+}
+
+uint32_t map_get_tile_element_count()
+{
+    return _tileElementCount;
+}
+
+static void map_init_default_surface(TileElement* tileElement)
+{
+    tileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+    tileElement->SetLastForTile(true);
+    tileElement->base_height = 14;
+    tileElement->clearance_height = 14;
+    tileElement->AsSurface()->SetWaterHeight(0);
+    tileElement->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+    tileElement->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
+    tileElement->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
+    tileElement->AsSurface()->SetParkFences(0);
+    tileElement->AsSurface()->SetSurfaceStyle(TERRAIN_GRASS);
+    tileElement->AsSurface()->SetEdgeStyle(TERRAIN_EDGE_ROCK);
+}
+
+static void tile_element_free_run(TileElement* run, uint32_t numElements)
+{
+    // Split the run into power of two pieces so each piece can be reused by its size class.
+    while (numElements != 0)
+    {
+        uint32_t sizeClass = 0;
+        while (sizeClass + 1 < TILE_ELEMENT_SIZE_CLASS_COUNT && (2u << sizeClass) <= numElements)
+        {
+            sizeClass++;
+        }
+
+        uint32_t size = 1u << sizeClass;
+        for (uint32_t i = 0; i < size; i++)
+        {
+            run[i].base_height = 0xFF;
+        }
+        _freeTileElementRuns[sizeClass].push_back(run);
+        run += size;
+        numElements -= size;
+    }
+}
+
+static TileElement* tile_element_allocate_run(uint32_t sizeClass)
+{
+    auto& freeRuns = _freeTileElementRuns[sizeClass];
+    if (!freeRuns.empty())
+    {
+        auto run = freeRuns.back();
+        freeRuns.pop_back();
+        return run;
+    }
+
+    uint32_t size = 1u << sizeClass;
+    if ((uint32_t)(_tileElementBlockEnd - gNextFreeTileElement) < size)
+    {
+        // Keep what is left of the current block for smaller runs and continue in a new block.
+        tile_element_free_run(gNextFreeTileElement, (uint32_t)(_tileElementBlockEnd - gNextFreeTileElement));
+
+        uint32_t blockSize = std::max(TILE_ELEMENT_BLOCK_SIZE, size);
+        _tileElementBlocks.push_back(std::make_unique<TileElement[]>(blockSize));
+        gNextFreeTileElement = _tileElementBlocks.back().get();
+        _tileElementBlockEnd = gNextFreeTileElement + blockSize;
+    }
+
+    auto run = gNextFreeTileElement;
+    gNextFreeTileElement += size;
+    return run;
+}
+
+/**
+ * Gives every tile up to the technical maximum that has no elements a default surface.
+ */
+static void map_allocate_tiles()
+{
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            auto& chunk = tile_chunk_get_or_create(x, y);
+            size_t index = tile_chunk_index(x, y);
+            if (chunk.FirstElements[index] == nullptr)
+            {
+                TileElement* tileElement = tile_element_allocate_run(0);
+                map_init_default_surface(tileElement);
+                chunk.FirstElements[index] = tileElement;
+                chunk.Capacities[index] = 1;
+                _tileElementCount++;
+            }
+        }
+    }
 }
 
 /**
@@ -634,9 +813,46 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+static void map_mark_path_wide_flags_dirty(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    _pathWideDirtyTileFlags[x + y * MAXIMUM_MAP_SIZE_TECHNICAL] = true;
+}
+
+/**
+ * Queues the wide flags around a tile for an update. Needed whenever paths on the tile or on one of its neighbours are
+ * added, removed or have their edges changed.
+ */
+void map_invalidate_path_wide_flags(const CoordsXY& loc)
+{
+    int32_t tileX = loc.x / 32;
+    int32_t tileY = loc.y / 32;
+    for (int32_t y = tileY - 2; y <= tileY + 2; y++)
+    {
+        for (int32_t x = tileX - 2; x <= tileX + 2; x++)
+        {
+            map_mark_path_wide_flags_dirty(x, y);
+        }
+    }
+}
+
+/**
+ * Queues the wide flags of the whole map for an update, used after loading a map. The saved flags stay in place until
+ * the sweep reaches each tile, as they always have.
+ */
+void map_invalidate_all_path_wide_flags()
+{
+    _pathWideDirtyTileFlags.set();
+    peep_pathfind_reset_paths();
+}
+
 /**
  *
  *  rct2: 0x006A876D
+ *  Only recomputes the queued tiles the sweep passes. A tile whose flags changed queues the following tiles that read
+ *  them, so every flag changes on the same tick as when each tile is recomputed.
  */
 void map_update_path_wide_flags()
 {
@@ -647,12 +863,26 @@ void map_update_path_wide_flags()
 
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
-    // progress. A maximum of 128 calls is done per update.
+    // progress. A maximum of 128 tiles is passed per update.
     uint16_t x = gWidePathTileLoopX;
     uint16_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
     {
-        footpath_update_path_wide_flags(x, y);
+        int32_t tileX = x / 32;
+        int32_t tileY = y / 32;
+        uint32_t tileIndex = tileX + tileY * MAXIMUM_MAP_SIZE_TECHNICAL;
+        if (_pathWideDirtyTileFlags[tileIndex])
+        {
+            _pathWideDirtyTileFlags[tileIndex] = false;
+            if (footpath_update_path_wide_flags(x, y))
+            {
+                peep_pathfind_invalidate_paths({ x, y });
+                map_mark_path_wide_flags_dirty(tileX + 1, tileY);
+                map_mark_path_wide_flags_dirty(tileX - 1, tileY + 1);
+                map_mark_path_wide_flags_dirty(tileX, tileY + 1);
+                map_mark_path_wide_flags_dirty(tileX + 1, tileY + 1);
+            }
+        }
 
         // Next x, y tile
         x += 32;
@@ -956,14 +1186,10 @@ void tile_element_remove(TileElement* tileElement)
         } while (!(++tileElement)->IsLastForTile());
     }
 
-    // Mark the latest element with the last element flag.
+    // Mark the latest element with the last element flag, the freed slot stays with the tile.
     (tileElement - 1)->SetLastForTile(true);
     tileElement->base_height = 0xFF;
-
-    if ((tileElement + 1) == gNextFreeTileElement)
-    {
-        gNextFreeTileElement--;
-    }
+    _tileElementCount--;
 }
 
 /**
@@ -1072,7 +1298,8 @@ void map_invalidate_selection_rect()
 }
 
 /**
- *
+ * Compacts all tiles back into gTileElements in tile order, freeing the extra blocks. Only needed before copying
+ * gTileElements as a whole.
  *  rct2: 0x0068B111
  */
 void map_reorganise_elements()
@@ -1121,30 +1348,15 @@ void map_reorganise_elements()
  *
  *  rct2: 0x0068B044
  *  Returns true on space available for more elements
- *  Reorganises the map elements to check for space
+ *  Tiles grow into new memory as needed, the limit only keeps the map within what can be saved.
  */
 bool map_check_free_elements_and_reorganise(int32_t numElements)
 {
-    if (numElements != 0)
+    if (numElements != 0 && _tileElementCount + numElements > MAX_TILE_ELEMENTS)
     {
-        auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
-
-        // Check if is there is room for the required number of elements
-        auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
-        {
-            // Defragment the map element list
-            map_reorganise_elements();
-
-            // Check if there is any room again
-            newTileElementEnd = gNextFreeTileElement + numElements;
-            if (newTileElementEnd > tileElementEnd)
-            {
-                // Not enough spare elements left :'(
-                gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
-                return false;
-            }
-        }
+        // Not enough spare elements left :'(
+        gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
+        return false;
     }
     return true;
 }
@@ -1155,65 +1367,63 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
  */
 TileElement* tile_element_insert(const TileCoordsXYZ& loc, int32_t occupiedQuadrants)
 {
-    TileElement *originalTileElement, *newTileElement, *insertedElement;
-    bool isLastForTile = false;
-
     if (!map_check_free_elements_and_reorganise(1))
     {
         log_error("Cannot insert new element");
         return nullptr;
     }
 
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[loc.y * MAXIMUM_MAP_SIZE_TECHNICAL + loc.x];
-
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[loc.y * MAXIMUM_MAP_SIZE_TECHNICAL + loc.x] = newTileElement;
-
-    // Copy all elements that are below the insert height
-    while (loc.z >= originalTileElement->base_height)
+    TileChunk& chunk = tile_chunk_get_or_create(loc.x, loc.y);
+    size_t tileIndex = tile_chunk_index(loc.x, loc.y);
+    TileElement* firstElement = chunk.FirstElements[tileIndex];
+    uint32_t numElements = tile_element_count_for_tile(firstElement);
+    uint32_t capacity = chunk.Capacities[tileIndex];
+    if (numElements + 1 > capacity)
     {
-        // Copy over map element
-        *newTileElement = *originalTileElement;
-        originalTileElement->base_height = 255;
-        originalTileElement++;
-        newTileElement++;
-
-        if ((newTileElement - 1)->IsLastForTile())
+        // Move the tile to a larger run, leaving room for the next inserts.
+        uint32_t sizeClass = 0;
+        while ((1u << sizeClass) < numElements + 1)
         {
-            // No more elements above the insert element
-            (newTileElement - 1)->SetLastForTile(false);
-            isLastForTile = true;
-            break;
+            sizeClass++;
         }
+        Guard::Assert(sizeClass < TILE_ELEMENT_SIZE_CLASS_COUNT, "Too many elements on one tile");
+
+        TileElement* newRun = tile_element_allocate_run(sizeClass);
+        std::copy_n(firstElement, numElements, newRun);
+        tile_element_free_run(firstElement, capacity);
+
+        firstElement = newRun;
+        capacity = 1u << sizeClass;
+        chunk.FirstElements[tileIndex] = firstElement;
+        chunk.Capacities[tileIndex] = capacity;
     }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->base_height = loc.z;
-    newTileElement->flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->clearance_height = loc.z;
-    std::memset(&newTileElement->pad_04, 0, sizeof(newTileElement->pad_04));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
-    newTileElement++;
-
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
+    // Elements are sorted by base height, the new element goes above all elements at the same height.
+    uint32_t insertIndex = 0;
+    while (insertIndex < numElements && loc.z >= firstElement[insertIndex].base_height)
     {
-        do
-        {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = 255;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+        insertIndex++;
     }
+    std::copy_backward(firstElement + insertIndex, firstElement + numElements, firstElement + numElements + 1);
 
-    gNextFreeTileElement = newTileElement;
+    bool isLastForTile = insertIndex == numElements;
+    if (isLastForTile && insertIndex != 0)
+    {
+        firstElement[insertIndex - 1].SetLastForTile(false);
+    }
+
+    // Insert new map element
+    TileElement* insertedElement = &firstElement[insertIndex];
+    insertedElement->type = 0;
+    insertedElement->base_height = loc.z;
+    insertedElement->flags = 0;
+    insertedElement->SetLastForTile(isLastForTile);
+    insertedElement->SetOccupiedQuadrants(occupiedQuadrants);
+    insertedElement->clearance_height = loc.z;
+    std::memset(&insertedElement->pad_04, 0, sizeof(insertedElement->pad_04));
+    std::memset(&insertedElement->pad_08, 0, sizeof(insertedElement->pad_08));
+
+    _tileElementCount++;
     return insertedElement;
 }
 
@@ -1728,6 +1938,8 @@ static void clear_elements_at(const CoordsXY& loc)
         gPeepSpawns.end());
 
     TileElement* tileElement = map_get_first_element_at(loc.x / 32, loc.y / 32);
+    map_invalidate_path_wide_flags(loc);
+    peep_pathfind_invalidate_paths(loc);
 
     // Remove all elements except the last one
     while (!tileElement->IsLastForTile())
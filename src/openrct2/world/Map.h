@@ -29,6 +29,7 @@
 
 #define MAP_MINIMUM_X_Y (-MAXIMUM_MAP_SIZE_TECHNICAL)
 
+// Limit of elements on a map, the tile element storage grows as needed but saved games can not hold more.
 #define MAX_TILE_ELEMENTS 196096 // 0x30000
 #define MAX_TILE_TILE_ELEMENT_POINTERS (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL)
 #define MAX_PEEP_SPAWNS 8
@@ -105,7 +106,6 @@ extern uint8_t gMapSelectArrowDirection;
 extern uint8_t gMapGroundFlags;
 
 extern TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 
 extern std::vector<CoordsXY> gMapSelectionTiles;
 extern std::vector<PeepSpawn> gPeepSpawns;
@@ -138,6 +138,8 @@ void map_init(int32_t size);
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
+void map_reset_tile_element_storage();
+uint32_t map_get_tile_element_count();
 TileElement* map_get_first_element_at(int32_t x, int32_t y);
 TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n);
 void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements);
@@ -159,6 +161,8 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection);
 void map_remove_provisional_elements();
 void map_restore_provisional_elements();
 void map_update_path_wide_flags();
+void map_invalidate_path_wide_flags(const CoordsXY& loc);
+void map_invalidate_all_path_wide_flags();
 bool map_is_location_valid(const CoordsXY& coords);
 bool map_is_edge(const CoordsXY& coords);
 bool map_can_build_at(const CoordsXYZ& loc);
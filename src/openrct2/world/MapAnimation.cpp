@@ -156,8 +156,6 @@ static bool map_animation_invalidate_small_scenery(int32_t x, int32_t y, int32_t
 {
     TileElement* tileElement;
     rct_scenery_entry* sceneryEntry;
-    rct_sprite* sprite;
-    Peep* peep;
 
     tileElement = map_get_first_element_at(x >> 5, y >> 5);
     do
@@ -191,28 +189,21 @@ static bool map_animation_invalidate_small_scenery(int32_t x, int32_t y, int32_t
                 int32_t x2 = x - CoordsDirectionDelta[direction].x;
                 int32_t y2 = y - CoordsDirectionDelta[direction].y;
 
-                uint16_t spriteIdx = sprite_get_first_in_quadrant(x2, y2);
-                for (; spriteIdx != SPRITE_INDEX_NULL; spriteIdx = sprite->generic.next_in_quadrant)
-                {
-                    sprite = get_sprite(spriteIdx);
-                    if (sprite->generic.linked_list_index != SPRITE_LIST_PEEP)
-                        continue;
-
-                    peep = &sprite->peep;
+                sprite_query_tile<Peep>(x2, y2, [tileElement](Peep* peep) {
                     if (peep->state != PEEP_STATE_WALKING)
-                        continue;
+                        return false;
                     if (peep->z != tileElement->base_height * 8)
-                        continue;
+                        return false;
                     if (peep->action < PEEP_ACTION_NONE_1)
-                        continue;
+                        return false;
 
                     peep->action = PEEP_ACTION_CHECK_TIME;
                     peep->action_frame = 0;
                     peep->action_sprite_image_offset = 0;
                     peep->UpdateCurrentActionSpriteType();
                     invalidate_sprite_1((rct_sprite*)peep);
-                    break;
-                }
+                    return true;
+                });
             }
             map_invalidate_tile_zoom1(x, y, tileElement->base_height * 8, tileElement->clearance_height * 8);
             return false;
@@ -720,6 +720,7 @@ Peep* Park::GenerateGuest()
             peep->direction = direction;
             peep->var_37 = 0;
             peep->state = PEEP_STATE_ENTERING_PARK;
+            sprite_hot_fields_set_state(peep->sprite_index, peep->state);
         }
     }
     return peep;
@@ -22,8 +22,11 @@
 #include "Fountain.h"
 
 #include <algorithm>
+#include <bitset>
 #include <cmath>
+#include <cstring>
 #include <iterator>
+#include <vector>
 
 uint16_t gSpriteListHead[SPRITE_LIST_COUNT];
 uint16_t gSpriteListCount[SPRITE_LIST_COUNT];
@@ -53,6 +56,181 @@ static LocationXYZ16 _spritelocations2[MAX_SPRITES];
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y);
 
+// Cached hashes of the sprites that only change through the list and move functions in this file (litter), peeps and
+// vehicles change every tick so they are hashed each time. Cached hashes are refreshed lazily when the checksum is asked for.
+static std::array<uint64_t, MAX_SPRITES> _spriteChecksumCache;
+static std::bitset<MAX_SPRITES> _spriteChecksumDirty;
+static std::vector<uint16_t> _spriteChecksumDirtyList;
+static uint64_t _spriteChecksumCacheSum = 0;
+static bool _spriteChecksumCacheValid = false;
+
+static SpriteHotFields _spriteHotFields;
+
+static void sprite_hot_fields_update_links(uint16_t spriteIndex)
+{
+    if (spriteIndex < MAX_SPRITES)
+    {
+        const auto& sprite = _spriteList[spriteIndex].generic;
+        _spriteHotFields.Next[spriteIndex] = sprite.next;
+        _spriteHotFields.List[spriteIndex] = sprite.linked_list_index;
+    }
+}
+
+static void sprite_hot_fields_update_position(const rct_sprite* sprite)
+{
+    size_t spriteIndex = sprite - _spriteList;
+    _spriteHotFields.X[spriteIndex] = sprite->generic.x;
+    _spriteHotFields.Y[spriteIndex] = sprite->generic.y;
+    _spriteHotFields.Z[spriteIndex] = sprite->generic.z;
+}
+
+static void sprite_hot_fields_update(uint16_t spriteIndex)
+{
+    const auto* sprite = &_spriteList[spriteIndex];
+    sprite_hot_fields_update_links(spriteIndex);
+    sprite_hot_fields_update_position(sprite);
+    switch (sprite->generic.sprite_identifier)
+    {
+        case SPRITE_IDENTIFIER_PEEP:
+            _spriteHotFields.State[spriteIndex] = sprite->peep.state;
+            break;
+        case SPRITE_IDENTIFIER_VEHICLE:
+            _spriteHotFields.State[spriteIndex] = sprite->vehicle.status;
+            break;
+        default:
+            _spriteHotFields.State[spriteIndex] = 0;
+            break;
+    }
+}
+
+const SpriteHotFields& sprite_hot_fields()
+{
+    return _spriteHotFields;
+}
+
+void sprite_hot_fields_rebuild()
+{
+    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    {
+        sprite_hot_fields_update(i);
+    }
+}
+
+void sprite_hot_fields_set_state(uint16_t spriteIndex, uint8_t state)
+{
+    if (spriteIndex < MAX_SPRITES)
+    {
+        _spriteHotFields.State[spriteIndex] = state;
+    }
+}
+
+void sprite_prefetch(uint16_t spriteIndex)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (spriteIndex < MAX_SPRITES)
+    {
+        __builtin_prefetch(&_spriteList[spriteIndex]);
+    }
+#endif
+}
+
+// Per sprite type chains over the same buckets as gSpriteSpatialIndex, each chain keeps the order the sprites have in the
+// bucket's full chain so walks filtered by type visit sprites in the same order as before.
+static constexpr size_t SPATIAL_INDEX_SIZE = 0x10001;
+static constexpr size_t SPATIAL_TYPE_COUNT = SPRITE_IDENTIFIER_LITTER + 1;
+static std::array<std::array<uint16_t, SPATIAL_INDEX_SIZE>, SPATIAL_TYPE_COUNT> _spriteTypedSpatialIndex;
+static std::array<uint16_t, MAX_SPRITES> _spriteTypedNextInQuadrant;
+static std::array<uint32_t, MAX_SPRITES> _spriteTypedQuadrant;
+static std::array<uint8_t, MAX_SPRITES> _spriteTypedType;
+
+static void sprite_typed_spatial_insert(uint16_t spriteIndex, uint8_t type, size_t quadrant)
+{
+    _spriteTypedType[spriteIndex] = type;
+    if (type >= SPATIAL_TYPE_COUNT)
+    {
+        return;
+    }
+    _spriteTypedQuadrant[spriteIndex] = (uint32_t)quadrant;
+    _spriteTypedNextInQuadrant[spriteIndex] = _spriteTypedSpatialIndex[type][quadrant];
+    _spriteTypedSpatialIndex[type][quadrant] = spriteIndex;
+}
+
+static void sprite_typed_spatial_remove(uint16_t spriteIndex)
+{
+    auto type = _spriteTypedType[spriteIndex];
+    if (type >= SPATIAL_TYPE_COUNT)
+    {
+        return;
+    }
+    uint16_t* link = &_spriteTypedSpatialIndex[type][_spriteTypedQuadrant[spriteIndex]];
+    while (*link != SPRITE_INDEX_NULL && *link != spriteIndex)
+    {
+        link = &_spriteTypedNextInQuadrant[*link];
+    }
+    if (*link == spriteIndex)
+    {
+        *link = _spriteTypedNextInQuadrant[spriteIndex];
+    }
+    _spriteTypedType[spriteIndex] = SPRITE_IDENTIFIER_NULL;
+}
+
+void sprite_typed_spatial_index_rebuild()
+{
+    for (auto& index : _spriteTypedSpatialIndex)
+    {
+        index.fill(SPRITE_INDEX_NULL);
+    }
+    _spriteTypedType.fill(SPRITE_IDENTIFIER_NULL);
+
+    std::array<uint16_t, SPATIAL_TYPE_COUNT> tails;
+    for (size_t quadrant = 0; quadrant < SPATIAL_INDEX_SIZE; quadrant++)
+    {
+        tails.fill(SPRITE_INDEX_NULL);
+        // The count guards against cycles in broken saves, they are fixed separately.
+        size_t count = 0;
+        for (uint16_t spriteIndex = gSpriteSpatialIndex[quadrant]; spriteIndex < MAX_SPRITES && count < MAX_SPRITES;
+             spriteIndex = _spriteList[spriteIndex].generic.next_in_quadrant, count++)
+        {
+            uint8_t type = _spriteList[spriteIndex].generic.sprite_identifier;
+            if (type >= SPATIAL_TYPE_COUNT || _spriteTypedType[spriteIndex] != SPRITE_IDENTIFIER_NULL)
+            {
+                continue;
+            }
+            _spriteTypedType[spriteIndex] = type;
+            _spriteTypedQuadrant[spriteIndex] = (uint32_t)quadrant;
+            _spriteTypedNextInQuadrant[spriteIndex] = SPRITE_INDEX_NULL;
+            if (tails[type] == SPRITE_INDEX_NULL)
+            {
+                _spriteTypedSpatialIndex[type][quadrant] = spriteIndex;
+            }
+            else
+            {
+                _spriteTypedNextInQuadrant[tails[type]] = spriteIndex;
+            }
+            tails[type] = spriteIndex;
+        }
+    }
+}
+
+uint16_t sprite_get_first_of_type_in_quadrant(SPRITE_IDENTIFIER type, int32_t x, int32_t y)
+{
+    return _spriteTypedSpatialIndex[type][GetSpatialIndexOffset(x, y)];
+}
+
+uint16_t sprite_get_next_of_type_in_quadrant(uint16_t spriteIndex)
+{
+    return _spriteTypedNextInQuadrant[spriteIndex];
+}
+
+static void sprite_checksum_mark_dirty(uint16_t spriteIndex)
+{
+    if (spriteIndex < MAX_SPRITES && !_spriteChecksumDirty[spriteIndex])
+    {
+        _spriteChecksumDirty[spriteIndex] = true;
+        _spriteChecksumDirtyList.push_back(spriteIndex);
+    }
+}
+
 std::string rct_sprite_checksum::ToString() const
 {
     std::string result;
@@ -187,6 +365,7 @@ void reset_sprite_list()
     gSpriteListCount[SPRITE_LIST_FREE] = MAX_SPRITES;
 
     reset_sprite_spatial_index();
+    sprite_incremental_checksum_invalidate();
 }
 
 /**
@@ -209,6 +388,9 @@ void reset_sprite_spatial_index()
             spr->generic.next_in_quadrant = nextSpriteId;
         }
     }
+    sprite_typed_spatial_index_rebuild();
+    sprite_incremental_checksum_invalidate();
+    sprite_hot_fields_rebuild();
 }
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
@@ -230,6 +412,30 @@ static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
 
 #ifndef DISABLE_NETWORK
 
+/**
+ * Copy of the sprite with all the fields cleared that do not belong to the game state.
+ */
+static rct_sprite sprite_get_checksum_copy(const rct_sprite* sprite)
+{
+    auto copy = *sprite;
+
+    // Only required for rendering/invalidation, has no meaning to the game state.
+    copy.generic.sprite_left = copy.generic.sprite_right = copy.generic.sprite_top = copy.generic.sprite_bottom = 0;
+    copy.generic.sprite_width = copy.generic.sprite_height_negative = copy.generic.sprite_height_positive = 0;
+
+    if (copy.generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
+    {
+        // Name is pointer and will not be the same across clients
+        copy.peep.name = {};
+
+        // We set this to 0 because as soon the client selects a guest the window will remove the
+        // invalidation flags causing the sprite checksum to be different than on server, the flag does not affect
+        // game state.
+        copy.peep.window_invalidate_flags = 0;
+    }
+    return copy;
+}
+
 rct_sprite_checksum sprite_checksum()
 {
     using namespace Crypt;
@@ -254,23 +460,7 @@ rct_sprite_checksum sprite_checksum()
             if (sprite->generic.sprite_identifier != SPRITE_IDENTIFIER_NULL
                 && sprite->generic.sprite_identifier != SPRITE_IDENTIFIER_MISC)
             {
-                auto copy = *sprite;
-
-                // Only required for rendering/invalidation, has no meaning to the game state.
-                copy.generic.sprite_left = copy.generic.sprite_right = copy.generic.sprite_top = copy.generic.sprite_bottom = 0;
-                copy.generic.sprite_width = copy.generic.sprite_height_negative = copy.generic.sprite_height_positive = 0;
-
-                if (copy.generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
-                {
-                    // Name is pointer and will not be the same across clients
-                    copy.peep.name = {};
-
-                    // We set this to 0 because as soon the client selects a guest the window will remove the
-                    // invalidation flags causing the sprite checksum to be different than on server, the flag does not affect
-                    // game state.
-                    copy.peep.window_invalidate_flags = 0;
-                }
-
+                auto copy = sprite_get_checksum_copy(sprite);
                 _spriteHashAlg->Update(&copy, sizeof(copy));
             }
         }
@@ -294,6 +484,79 @@ rct_sprite_checksum sprite_checksum()
 
 #endif // DISABLE_NETWORK
 
+/**
+ * 64-bit hash of the type, list links and position of a sprite. Only these fields are hashed as they are set when the
+ * sprite is created and only changed by the functions in this file, which mark the sprite dirty. The words are assembled from the fields so the hash is the
+ * same on every platform.
+ */
+static uint64_t sprite_hash(const rct_sprite* sprite)
+{
+    const auto& generic = sprite->generic;
+    const uint64_t words[] = {
+        (uint64_t)generic.sprite_identifier | ((uint64_t)generic.type << 8) | ((uint64_t)generic.linked_list_index << 16)
+            | ((uint64_t)generic.sprite_index << 32) | ((uint64_t)generic.next_in_quadrant << 48),
+        (uint64_t)generic.next | ((uint64_t)generic.previous << 16) | ((uint64_t)(uint16_t)generic.x << 32)
+            | ((uint64_t)(uint16_t)generic.y << 48),
+        (uint64_t)(uint16_t)generic.z,
+    };
+
+    uint64_t hash = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t word : words)
+    {
+        hash ^= word * 0x87C37B91114253D5ULL;
+        hash = (hash << 31) | (hash >> 33);
+        hash *= 0x4CF5AD432745937FULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static uint64_t sprite_get_cached_hash(uint16_t spriteIndex)
+{
+    auto sprite = get_sprite(spriteIndex);
+    if (sprite->generic.sprite_identifier != SPRITE_IDENTIFIER_NULL
+        && sprite->generic.sprite_identifier != SPRITE_IDENTIFIER_MISC)
+    {
+        return sprite_hash(sprite);
+    }
+    return 0;
+}
+
+void sprite_incremental_checksum_invalidate()
+{
+    _spriteChecksumCacheValid = false;
+}
+
+uint64_t sprite_incremental_checksum()
+{
+    if (!_spriteChecksumCacheValid)
+    {
+        _spriteChecksumCacheSum = 0;
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
+        {
+            _spriteChecksumCache[i] = sprite_get_cached_hash(i);
+            _spriteChecksumCacheSum += _spriteChecksumCache[i];
+        }
+        _spriteChecksumDirty.reset();
+        _spriteChecksumDirtyList.clear();
+        _spriteChecksumCacheValid = true;
+    }
+
+    for (auto spriteIndex : _spriteChecksumDirtyList)
+    {
+        auto hash = sprite_get_cached_hash(spriteIndex);
+        _spriteChecksumCacheSum += hash - _spriteChecksumCache[spriteIndex];
+        _spriteChecksumCache[spriteIndex] = hash;
+        _spriteChecksumDirty[spriteIndex] = false;
+    }
+    _spriteChecksumDirtyList.clear();
+
+    // The sum does not depend on the order sprites are visited in, the list links are part of every hash.
+    return _spriteChecksumCacheSum;
+}
+
 static void sprite_reset(rct_sprite_generic* sprite)
 {
     // Need to retain how the sprite is linked in lists
@@ -343,6 +606,7 @@ void sprite_clear_all_unused()
             sprite->next_in_quadrant = SPRITE_INDEX_NULL;
         }
         _spriteFlashingList[spriteIndex] = false;
+        sprite_hot_fields_update(spriteIndex);
         spriteIndex = nextSpriteIndex;
     }
 }
@@ -408,6 +672,9 @@ rct_sprite* create_sprite(SPRITE_IDENTIFIER spriteIdentifier)
 
     sprite->next_in_quadrant = gSpriteSpatialIndex[SPATIAL_INDEX_LOCATION_NULL];
     gSpriteSpatialIndex[SPATIAL_INDEX_LOCATION_NULL] = sprite->sprite_index;
+    sprite_typed_spatial_insert(sprite->sprite_index, spriteIdentifier, SPATIAL_INDEX_LOCATION_NULL);
+
+    sprite_hot_fields_update(sprite->sprite_index);
 
     return (rct_sprite*)sprite;
 }
@@ -428,6 +695,12 @@ void move_sprite_to_list(rct_sprite* sprite, SPRITE_LIST newListIndex)
         return;
     }
 
+    sprite_checksum_mark_dirty(unkSprite->sprite_index);
+    sprite_checksum_mark_dirty(unkSprite->previous);
+    sprite_checksum_mark_dirty(unkSprite->next);
+    sprite_checksum_mark_dirty(gSpriteListHead[newListIndex]);
+    uint16_t oldPrevious = unkSprite->previous;
+
     // If the sprite is currently the head of the list, the
     // sprite following this one becomes the new head of the list.
     if (unkSprite->previous == SPRITE_INDEX_NULL)
@@ -462,6 +735,9 @@ void move_sprite_to_list(rct_sprite* sprite, SPRITE_LIST newListIndex)
     // Decrement old list counter, increment new list counter.
     gSpriteListCount[oldListIndex]--;
     gSpriteListCount[newListIndex]++;
+
+    sprite_hot_fields_update_links(oldPrevious);
+    sprite_hot_fields_update_links(unkSprite->sprite_index);
 }
 
 /**
@@ -604,7 +880,7 @@ void sprite_misc_update_all()
     while (spriteIndex != SPRITE_INDEX_NULL)
     {
         sprite = get_sprite(spriteIndex);
-        spriteIndex = sprite->generic.next;
+        spriteIndex = _spriteHotFields.Next[spriteIndex];
         sprite_misc_update(sprite);
     }
 }
@@ -625,6 +901,8 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
         x = LOCATION_NULL;
     }
 
+    sprite_checksum_mark_dirty(sprite->generic.sprite_index);
+
     size_t newIndex = GetSpatialIndexOffset(x, y);
     size_t currentIndex = GetSpatialIndexOffset(sprite->generic.x, sprite->generic.y);
     if (newIndex != currentIndex)
@@ -633,8 +911,10 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
         if (*spriteIndex != SPRITE_INDEX_NULL)
         {
             rct_sprite* sprite2 = get_sprite(*spriteIndex);
+            rct_sprite* previousSprite = nullptr;
             while (sprite != sprite2)
             {
+                previousSprite = sprite2;
                 spriteIndex = &sprite2->generic.next_in_quadrant;
                 if (*spriteIndex == SPRITE_INDEX_NULL)
                 {
@@ -642,12 +922,22 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
                 }
                 sprite2 = get_sprite(*spriteIndex);
             }
+            if (previousSprite != nullptr)
+            {
+                // Gets relinked to the sprite after this one.
+                sprite_checksum_mark_dirty(previousSprite->generic.sprite_index);
+            }
         }
         *spriteIndex = sprite->generic.next_in_quadrant;
 
         int32_t tempSpriteIndex = gSpriteSpatialIndex[newIndex];
         gSpriteSpatialIndex[newIndex] = sprite->generic.sprite_index;
         sprite->generic.next_in_quadrant = tempSpriteIndex;
+
+        uint16_t movedSpriteIndex = sprite->generic.sprite_index;
+        auto type = _spriteTypedType[movedSpriteIndex];
+        sprite_typed_spatial_remove(movedSpriteIndex);
+        sprite_typed_spatial_insert(movedSpriteIndex, type, newIndex);
     }
 
     if (x == LOCATION_NULL)
@@ -656,6 +946,7 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
         sprite->generic.x = x;
         sprite->generic.y = y;
         sprite->generic.z = z;
+        sprite_hot_fields_update_position(sprite);
     }
     else
     {
@@ -665,6 +956,8 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
 
 void sprite_set_coordinates(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
 {
+    sprite_checksum_mark_dirty(sprite->generic.sprite_index);
+
     CoordsXYZ coords3d = { x, y, z };
     auto screenCoords = translate_3d_to_2d_with_z(get_current_rotation(), coords3d);
 
@@ -675,6 +968,7 @@ void sprite_set_coordinates(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
     sprite->generic.x = x;
     sprite->generic.y = y;
     sprite->generic.z = z;
+    sprite_hot_fields_update_position(sprite);
 }
 
 /**
@@ -692,15 +986,23 @@ void sprite_remove(rct_sprite* sprite)
     move_sprite_to_list(sprite, SPRITE_LIST_FREE);
     sprite->generic.sprite_identifier = SPRITE_IDENTIFIER_NULL;
     _spriteFlashingList[sprite->generic.sprite_index] = false;
+    sprite_hot_fields_set_state(sprite->generic.sprite_index, 0);
 
     size_t quadrantIndex = GetSpatialIndexOffset(sprite->generic.x, sprite->generic.y);
     uint16_t* spriteIndex = &gSpriteSpatialIndex[quadrantIndex];
     rct_sprite* quadrantSprite;
+    rct_sprite* previousSprite = nullptr;
     while (*spriteIndex != SPRITE_INDEX_NULL && (quadrantSprite = get_sprite(*spriteIndex)) != sprite)
     {
+        previousSprite = quadrantSprite;
         spriteIndex = &quadrantSprite->generic.next_in_quadrant;
     }
+    if (previousSprite != nullptr)
+    {
+        sprite_checksum_mark_dirty(previousSprite->generic.sprite_index);
+    }
     *spriteIndex = sprite->generic.next_in_quadrant;
+    sprite_typed_spatial_remove(sprite->generic.sprite_index);
 }
 
 static bool litter_can_be_at(int32_t x, int32_t y, int32_t z)
@@ -784,34 +1086,25 @@ void litter_create(int32_t x, int32_t y, int32_t z, int32_t direction, int32_t t
  */
 void litter_remove_at(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
-    {
-        rct_sprite* sprite = get_sprite(spriteIndex);
-        uint16_t nextSpriteIndex = sprite->generic.next_in_quadrant;
-        if (sprite->generic.linked_list_index == SPRITE_LIST_LITTER)
+    sprite_query_tile<rct_litter>(x, y, [x, y, z](rct_litter* litter) {
+        if (abs(litter->z - z) <= 16)
         {
-            rct_litter* litter = &sprite->litter;
-
-            if (abs(litter->z - z) <= 16)
+            if (abs(litter->x - x) <= 8 && abs(litter->y - y) <= 8)
             {
-                if (abs(litter->x - x) <= 8 && abs(litter->y - y) <= 8)
-                {
-                    invalidate_sprite_0(sprite);
-                    sprite_remove(sprite);
-                }
+                invalidate_sprite_0((rct_sprite*)litter);
+                sprite_remove((rct_sprite*)litter);
             }
         }
-        spriteIndex = nextSpriteIndex;
-    }
+        return false;
+    });
 }
 
 /**
  * Determines whether it's worth tweening a sprite or not when frame smoothing is on.
  */
-static bool sprite_should_tween(rct_sprite* sprite)
+static bool sprite_should_tween(uint16_t spriteIndex)
 {
-    switch (sprite->generic.linked_list_index)
+    switch (_spriteHotFields.List[spriteIndex])
     {
         case SPRITE_LIST_PEEP:
         case SPRITE_LIST_VEHICLE_HEAD:
@@ -823,14 +1116,12 @@ static bool sprite_should_tween(rct_sprite* sprite)
 
 static void store_sprite_locations(LocationXYZ16* sprite_locations)
 {
+    // Read from the hot field copy, this runs every frame with the uncap FPS option on
     for (uint16_t i = 0; i < MAX_SPRITES; i++)
     {
-        // skip going through `get_sprite` to not get stalled on assert,
-        // this can get very expensive for busy parks with uncap FPS option on
-        const rct_sprite* sprite = &_spriteList[i];
-        sprite_locations[i].x = sprite->generic.x;
-        sprite_locations[i].y = sprite->generic.y;
-        sprite_locations[i].z = sprite->generic.z;
+        sprite_locations[i].x = _spriteHotFields.X[i];
+        sprite_locations[i].y = _spriteHotFields.Y[i];
+        sprite_locations[i].z = _spriteHotFields.Z[i];
     }
 }
 
@@ -850,9 +1141,9 @@ void sprite_position_tween_all(float alpha)
 
     for (uint16_t i = 0; i < MAX_SPRITES; i++)
     {
-        rct_sprite* sprite = get_sprite(i);
-        if (sprite_should_tween(sprite))
+        if (sprite_should_tween(i))
         {
+            rct_sprite* sprite = get_sprite(i);
             LocationXYZ16 posA = _spritelocations1[i];
             LocationXYZ16 posB = _spritelocations2[i];
             if (posA.x == posB.x && posA.y == posB.y && posA.z == posB.z)
@@ -874,9 +1165,9 @@ void sprite_position_tween_restore()
 {
     for (uint16_t i = 0; i < MAX_SPRITES; i++)
     {
-        rct_sprite* sprite = get_sprite(i);
-        if (sprite_should_tween(sprite))
+        if (sprite_should_tween(i))
         {
+            rct_sprite* sprite = get_sprite(i);
             invalidate_sprite_2(sprite);
 
             LocationXYZ16 pos = _spritelocations2[i];
@@ -889,10 +1180,9 @@ void sprite_position_tween_reset()
 {
     for (uint16_t i = 0; i < MAX_SPRITES; i++)
     {
-        rct_sprite* sprite = get_sprite(i);
-        _spritelocations1[i].x = _spritelocations2[i].x = sprite->generic.x;
-        _spritelocations1[i].y = _spritelocations2[i].y = sprite->generic.y;
-        _spritelocations1[i].z = _spritelocations2[i].z = sprite->generic.z;
+        _spritelocations1[i].x = _spritelocations2[i].x = _spriteHotFields.X[i];
+        _spritelocations1[i].y = _spritelocations2[i].y = _spriteHotFields.Y[i];
+        _spritelocations1[i].z = _spritelocations2[i].z = _spriteHotFields.Z[i];
     }
 }
 
@@ -1003,6 +1293,8 @@ int32_t check_for_sprite_list_cycles(bool fix)
         {
             if (fix)
             {
+                sprite_incremental_checksum_invalidate();
+
                 // Fix head list, but only in reverse order
                 // This is likely not needed, but just in case
                 get_sprite(gSpriteListHead[i])->generic.previous = SPRITE_INDEX_NULL;
@@ -1025,6 +1317,7 @@ int32_t check_for_sprite_list_cycles(bool fix)
                     spr->generic.next = SPRITE_INDEX_NULL;
                     cycle_start = spr;
                 }
+                sprite_hot_fields_rebuild();
             }
             return i;
         }
@@ -1073,6 +1366,10 @@ int32_t fix_disjoint_sprites()
             }
         }
     }
+    if (count > 0)
+    {
+        sprite_hot_fields_rebuild();
+    }
     return count;
 }
 
@@ -1085,6 +1382,8 @@ int32_t check_for_spatial_index_cycles(bool fix)
         {
             if (fix)
             {
+                sprite_incremental_checksum_invalidate();
+
                 // Store the leftover part of cycle to be fixed
                 uint16_t cycle_next = cycle_start->generic.next_in_quadrant;
 
@@ -1102,6 +1401,7 @@ int32_t check_for_spatial_index_cycles(bool fix)
                     spr->generic.next_in_quadrant = SPRITE_INDEX_NULL;
                     cycle_start = spr;
                 }
+                sprite_typed_spatial_index_rebuild();
             }
             return i;
         }
@@ -16,6 +16,9 @@
 #include "Fountain.h"
 #include "SpriteBase.h"
 
+#include <algorithm>
+#include <array>
+
 #define SPRITE_INDEX_NULL 0xFFFF
 #define MAX_SPRITES 10000
 
@@ -212,6 +215,85 @@ void litter_remove_at(int32_t x, int32_t y, int32_t z);
 void sprite_misc_explosion_cloud_create(int32_t x, int32_t y, int32_t z);
 void sprite_misc_explosion_flare_create(int32_t x, int32_t y, int32_t z);
 uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y);
+uint16_t sprite_get_first_of_type_in_quadrant(SPRITE_IDENTIFIER type, int32_t x, int32_t y);
+uint16_t sprite_get_next_of_type_in_quadrant(uint16_t spriteIndex);
+
+/**
+ * Rebuilds the per type chains from gSpriteSpatialIndex, call after writing the spatial index or next_in_quadrant directly.
+ */
+void sprite_typed_spatial_index_rebuild();
+
+template<typename T> struct SpriteTypeIdentifier;
+template<> struct SpriteTypeIdentifier<rct_vehicle>
+{
+    static constexpr SPRITE_IDENTIFIER Value = SPRITE_IDENTIFIER_VEHICLE;
+};
+template<> struct SpriteTypeIdentifier<Peep>
+{
+    static constexpr SPRITE_IDENTIFIER Value = SPRITE_IDENTIFIER_PEEP;
+};
+template<> struct SpriteTypeIdentifier<rct_litter>
+{
+    static constexpr SPRITE_IDENTIFIER Value = SPRITE_IDENTIFIER_LITTER;
+};
+
+/**
+ * Calls func with every sprite of type T on the tile containing x, y in the order the tile's spatial index chain has them,
+ * without visiting sprites of other types. func may remove the sprite it is given. Stops and returns true as soon as func
+ * returns true.
+ */
+template<typename T, typename TFunc> bool sprite_query_tile(int32_t x, int32_t y, TFunc func)
+{
+    uint16_t spriteIndex = sprite_get_first_of_type_in_quadrant(SpriteTypeIdentifier<T>::Value, x, y);
+    while (spriteIndex != SPRITE_INDEX_NULL)
+    {
+        auto sprite = reinterpret_cast<T*>(get_sprite(spriteIndex));
+        spriteIndex = sprite_get_next_of_type_in_quadrant(spriteIndex);
+        if (func(sprite))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Calls func with every sprite of type T on the tiles the box from left, top to right, bottom (inclusive) overlaps, tile by
+ * tile. Sprites near the box on those tiles are visited as well, so func has to check the distance it needs. Stops and
+ * returns true as soon as func returns true.
+ */
+template<typename T, typename TFunc> bool sprite_query_box(int32_t left, int32_t top, int32_t right, int32_t bottom, TFunc func)
+{
+    constexpr int32_t maxCoord = MAXIMUM_MAP_SIZE_TECHNICAL * 32 - 1;
+    if (right < 0 || bottom < 0 || left > maxCoord || top > maxCoord)
+    {
+        return false;
+    }
+    left = std::max(left, 0) & ~31;
+    top = std::max(top, 0) & ~31;
+    right = std::min(right, maxCoord);
+    bottom = std::min(bottom, maxCoord);
+    for (int32_t x = left; x <= right; x += 32)
+    {
+        for (int32_t y = top; y <= bottom; y += 32)
+        {
+            if (sprite_query_tile<T>(x, y, [&func](T* sprite) { return func(sprite); }))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Same as sprite_query_box for the square of tiles within radius of x, y on both axes.
+ */
+template<typename T, typename TFunc> bool sprite_query_radius(int32_t x, int32_t y, int32_t radius, TFunc func)
+{
+    return sprite_query_box<T>(x - radius, y - radius, x + radius, y + radius, func);
+}
+
 void sprite_position_tween_store_a();
 void sprite_position_tween_store_b();
 void sprite_position_tween_all(float nudge);
@@ -243,6 +325,39 @@ void crash_splash_update(rct_crash_splash* splash);
 
 rct_sprite_checksum sprite_checksum();
 
+/**
+ * Cheap checksum of the type, list links and position of every sprite, the rest of the sprite state is only covered by
+ * sprite_checksum. Sprite hashes are cached and only refreshed after the sprite was created, removed, moved or relinked.
+ * Call sprite_incremental_checksum_invalidate after writing sprites directly.
+ */
+uint64_t sprite_incremental_checksum();
+void sprite_incremental_checksum_invalidate();
+
+/**
+ * Densely packed copy of the sprite fields read by loops over many sprites, indexed by sprite index. rct_sprite stays the
+ * layout that is saved and sent to clients. The functions in this file and the peep and vehicle state setters write the copy
+ * through, call sprite_hot_fields_rebuild after writing sprites or their list links directly.
+ */
+struct SpriteHotFields
+{
+    std::array<uint16_t, MAX_SPRITES> Next;
+    std::array<uint8_t, MAX_SPRITES> List;
+    std::array<int16_t, MAX_SPRITES> X;
+    std::array<int16_t, MAX_SPRITES> Y;
+    std::array<int16_t, MAX_SPRITES> Z;
+    // Peep state or vehicle status, 0 for other sprites.
+    std::array<uint8_t, MAX_SPRITES> State;
+};
+
+const SpriteHotFields& sprite_hot_fields();
+void sprite_hot_fields_rebuild();
+void sprite_hot_fields_set_state(uint16_t spriteIndex, uint8_t state);
+
+/**
+ * Hints the processor to start loading a sprite that is about to be updated.
+ */
+void sprite_prefetch(uint16_t spriteIndex);
+
 void sprite_set_flashing(rct_sprite* sprite, bool flashing);
 bool sprite_get_flashing(rct_sprite* sprite);
 int32_t check_for_sprite_list_cycles(bool fix);
@@ -17,6 +17,7 @@
 #include "../interface/Window.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Localisation.h"
+#include "../peep/Peep.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
 #include "../windows/Intent.h"
@@ -159,6 +160,8 @@ GameActionResult::Ptr tile_inspector_remove_element_at(CoordsXY loc, int16_t ele
         }
         tile_element_remove(tileElement);
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         // Update the window
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
@@ -282,6 +285,8 @@ GameActionResult::Ptr tile_inspector_rotate_element_at(CoordsXY loc, int32_t ele
         }
 
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         if ((uint32_t)(loc.x / 32) == windowTileInspectorTileX && (uint32_t)(loc.y / 32) == windowTileInspectorTileY)
         {
@@ -329,6 +334,8 @@ GameActionResult::Ptr tile_inspector_paste_element_at(CoordsXY loc, TileElement
         pastedElement->SetLastForTile(lastForTile);
 
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)(loc.x / 32) == windowTileInspectorTileX
@@ -453,6 +460,8 @@ GameActionResult::Ptr tile_inspector_any_base_height_offset(
         tileElement->clearance_height += heightOffset;
 
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)(loc.x / 32) == windowTileInspectorTileX
@@ -610,6 +619,8 @@ GameActionResult::Ptr tile_inspector_path_set_sloped(CoordsXY loc, int32_t eleme
         pathElement->AsPath()->SetSloped(sloped);
 
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)(loc.x / 32) == windowTileInspectorTileX
@@ -659,6 +670,8 @@ GameActionResult::Ptr tile_inspector_path_toggle_edge(CoordsXY loc, int32_t elem
         pathElement->AsPath()->SetEdgesAndCorners(newEdges);
 
         map_invalidate_tile_full(loc.x, loc.y);
+        map_invalidate_path_wide_flags(loc);
+        peep_pathfind_invalidate_paths(loc);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
         if (tileInspectorWindow != nullptr && (uint32_t)(loc.x / 32) == windowTileInspectorTileX
@@ -1051,6 +1064,7 @@ GameActionResult::Ptr tile_inspector_banner_toggle_blocking_edge(
         uint8_t edges = bannerElement->AsBanner()->GetAllowedEdges();
         edges ^= (1 << edgeIndex);
         bannerElement->AsBanner()->SetAllowedEdges(edges);
+        peep_pathfind_invalidate_paths(loc);
 
         if ((uint32_t)(loc.x / 32) == windowTileInspectorTileX && (uint32_t)(loc.y / 32) == windowTileInspectorTileY)
         {
@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/drawing/Drawing.h>
+#include <vector>
+
+class ImageResidencyTest : public testing::Test
+{
+protected:
+    static constexpr uint32_t ImageCount = 4;
+    static constexpr size_t ImageDataSize = 16;
+
+    int32_t _loadCount = 0;
+
+    void SetUp() override
+    {
+        gOpenRCT2NoGraphics = false;
+    }
+
+    // Each image is a 4x4 bitmap filled with its own index.
+    static std::vector<rct_g1_element> CreateImages()
+    {
+        std::vector<rct_g1_element> images(ImageCount);
+        for (uint32_t i = 0; i < ImageCount; i++)
+        {
+            images[i].offset = (uint8_t*)(uintptr_t)(i * ImageDataSize);
+            images[i].width = 4;
+            images[i].height = 4;
+            images[i].flags = G1_FLAG_BMP;
+        }
+        return images;
+    }
+
+    uint32_t AllocateImages()
+    {
+        auto images = CreateImages();
+        return gfx_object_allocate_images_deferred(images.data(), ImageCount, [this]() {
+            _loadCount++;
+            std::vector<uint8_t> data(ImageCount * ImageDataSize);
+            for (size_t i = 0; i < data.size(); i++)
+            {
+                data[i] = (uint8_t)(i / ImageDataSize);
+            }
+            return data;
+        });
+    }
+};
+
+TEST_F(ImageResidencyTest, data_is_loaded_on_first_use)
+{
+    auto baseImageId = AllocateImages();
+    ASSERT_NE(baseImageId, UINT32_MAX);
+    EXPECT_EQ(_loadCount, 0);
+
+    for (uint32_t i = 0; i < ImageCount; i++)
+    {
+        auto g1 = gfx_get_g1_element(baseImageId + i);
+        ASSERT_NE(g1, nullptr);
+        ASSERT_NE(g1->offset, nullptr);
+        EXPECT_EQ(g1->width, 4);
+        EXPECT_EQ(g1->offset[0], i);
+        EXPECT_EQ(g1->offset[ImageDataSize - 1], i);
+    }
+    EXPECT_EQ(_loadCount, 1);
+    EXPECT_EQ(gfx_object_get_resident_image_bytes(), ImageCount * ImageDataSize);
+
+    gfx_object_free_images(baseImageId, ImageCount);
+    EXPECT_EQ(gfx_object_get_resident_image_bytes(), 0u);
+}
+
+TEST_F(ImageResidencyTest, cold_images_are_evicted_over_budget)
+{
+    auto baseImageId = AllocateImages();
+    ASSERT_NE(baseImageId, UINT32_MAX);
+    gfx_get_g1_element(baseImageId);
+    EXPECT_EQ(_loadCount, 1);
+
+    // Images drawn in the last frame are kept
+    gfx_object_evict_images(1);
+    EXPECT_EQ(gfx_object_get_resident_image_bytes(), ImageCount * ImageDataSize);
+
+    // No budget never evicts
+    gfx_object_evict_images(0);
+    gfx_object_evict_images(0);
+    EXPECT_EQ(gfx_object_get_resident_image_bytes(), ImageCount * ImageDataSize);
+
+    gfx_object_evict_images(1);
+    EXPECT_EQ(gfx_object_get_resident_image_bytes(), 0u);
+
+    // Evicted images are paged in again with the same data
+    auto g1 = gfx_get_g1_element(baseImageId + 2);
+    ASSERT_NE(g1, nullptr);
+    ASSERT_NE(g1->offset, nullptr);
+    EXPECT_EQ(g1->offset[0], 2);
+    EXPECT_EQ(_loadCount, 2);
+
+    gfx_object_free_images(baseImageId, ImageCount);
+}
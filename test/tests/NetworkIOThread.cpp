@@ -0,0 +1,376 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <algorithm>
+#    include <chrono>
+#    include <cstdint>
+#    include <gtest/gtest.h>
+#    include <openrct2/core/SpscQueue.h>
+#    include <openrct2/network/NetworkIOThread.h>
+#    include <openrct2/network/NetworkPacketQueue.h>
+#    include <thread>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+class NetworkIOThreadTest : public testing::Test
+{
+protected:
+    static constexpr uint16_t Port = 23517;
+
+    std::unique_ptr<NetworkIOThread> _ioThread;
+    std::unique_ptr<ITcpSocket> _client;
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(InitialiseWSA());
+        auto listenSocket = CreateTcpSocket();
+        listenSocket->Listen("127.0.0.1", Port);
+        _ioThread = std::make_unique<NetworkIOThread>(std::move(listenSocket));
+        _client = CreateTcpSocket();
+        _client->Connect("127.0.0.1", Port);
+    }
+
+    void TearDown() override
+    {
+        _client.reset();
+        _ioThread.reset();
+        DisposeWSA();
+    }
+
+    template<typename TFn> static bool WaitFor(TFn&& condition)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() - startTime > std::chrono::seconds(5))
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    std::shared_ptr<NetworkIOChannel> AcceptChannel()
+    {
+        std::shared_ptr<NetworkIOChannel> channel;
+        EXPECT_TRUE(WaitFor([&]() { return (channel = _ioThread->AcceptChannel()) != nullptr; }));
+        return channel;
+    }
+
+    static std::vector<uint8_t> CreatePayload(size_t length, uint8_t seed)
+    {
+        std::vector<uint8_t> payload(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            payload[i] = (uint8_t)(i * 31 + seed);
+        }
+        return payload;
+    }
+
+    static std::unique_ptr<NetworkPacket> CreatePacket(const std::vector<uint8_t>& payload)
+    {
+        auto packet = NetworkPacket::Allocate();
+        packet->Write(payload.data(), payload.size());
+        packet->Size = (uint16_t)payload.size();
+        return packet;
+    }
+
+    // Reads everything the client receives until the server closes the connection.
+    std::vector<uint8_t> ReceiveUntilDisconnected()
+    {
+        std::vector<uint8_t> received;
+        uint8_t buffer[4096];
+        EXPECT_TRUE(WaitFor([&]() {
+            size_t readBytes;
+            auto status = _client->ReceiveData(buffer, sizeof(buffer), &readBytes);
+            received.insert(received.end(), buffer, buffer + readBytes);
+            return status == NETWORK_READPACKET_DISCONNECTED;
+        }));
+        return received;
+    }
+};
+
+// Accepts a limited number of bytes per send, like a socket whose buffer keeps filling up
+class PartialWriteSocket final : public ITcpSocket
+{
+public:
+    size_t MaxBytesPerSend;
+    size_t SendCalls = 0;
+    std::vector<uint8_t> Sent;
+
+    explicit PartialWriteSocket(size_t maxBytesPerSend)
+        : MaxBytesPerSend(maxBytesPerSend)
+    {
+    }
+
+    SOCKET_STATUS GetStatus() const override
+    {
+        return SOCKET_STATUS_CONNECTED;
+    }
+    const char* GetError() const override
+    {
+        return nullptr;
+    }
+    const char* GetHostName() const override
+    {
+        return nullptr;
+    }
+    void Listen(uint16_t) override
+    {
+    }
+    void Listen(const std::string&, uint16_t) override
+    {
+    }
+    std::unique_ptr<ITcpSocket> Accept() override
+    {
+        return nullptr;
+    }
+    void Connect(const std::string&, uint16_t) override
+    {
+    }
+    void ConnectAsync(const std::string&, uint16_t) override
+    {
+    }
+    size_t SendData(const void* buffer, size_t size) override
+    {
+        SocketBuffer socketBuffer = { buffer, size };
+        return SendData(&socketBuffer, 1);
+    }
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        SendCalls++;
+        size_t sent = 0;
+        for (size_t i = 0; i < count && sent < MaxBytesPerSend; i++)
+        {
+            size_t length = std::min(buffers[i].Length, MaxBytesPerSend - sent);
+            auto data = (const uint8_t*)buffers[i].Data;
+            Sent.insert(Sent.end(), data, data + length);
+            sent += length;
+        }
+        return sent;
+    }
+    NETWORK_READPACKET ReceiveData(void*, size_t, size_t* sizeReceived) override
+    {
+        *sizeReceived = 0;
+        return NETWORK_READPACKET_NO_DATA;
+    }
+    void Disconnect() override
+    {
+    }
+    void Close() override
+    {
+    }
+};
+
+static std::shared_ptr<const NetworkPacket> CreateQueuedPacket(uint32_t command, size_t payloadLength)
+{
+    auto packet = NetworkPacket::Allocate();
+    *packet << command;
+    for (size_t i = 0; i < payloadLength; i++)
+    {
+        *packet << (uint8_t)i;
+    }
+    packet->Size = (uint16_t)packet->Data->size();
+    return packet;
+}
+
+static void AppendFramed(std::vector<uint8_t>& stream, const NetworkPacket& packet)
+{
+    uint16_t sizen = Convert::HostToNetwork(packet.Size);
+    stream.insert(stream.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
+    stream.insert(stream.end(), packet.Data->begin(), packet.Data->end());
+}
+
+TEST(NetworkPacketQueueTest, packets_survive_partial_writes)
+{
+    std::vector<std::shared_ptr<const NetworkPacket>> packets;
+    std::vector<uint8_t> expected;
+    for (uint32_t i = 0; i < 300; i++)
+    {
+        packets.push_back(CreateQueuedPacket(i, (i * 7) % 50));
+        AppendFramed(expected, *packets.back());
+    }
+
+    NetworkPacketQueue queue;
+    for (const auto& packet : packets)
+    {
+        queue.Push(packet);
+    }
+
+    PartialWriteSocket socket(7);
+    std::vector<uint32_t> sentCommands;
+    while (!queue.Send(socket, [&](const NetworkPacket& packet) { sentCommands.push_back(packet.GetCommand()); }))
+    {
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(socket.Sent, expected);
+    ASSERT_EQ(sentCommands.size(), packets.size());
+    for (uint32_t i = 0; i < sentCommands.size(); i++)
+    {
+        EXPECT_EQ(sentCommands[i], i);
+    }
+}
+
+TEST(NetworkPacketQueueTest, small_packets_are_gathered_into_one_send)
+{
+    NetworkPacketQueue queue;
+    std::vector<uint8_t> expected;
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        auto packet = CreateQueuedPacket(i, 10);
+        AppendFramed(expected, *packet);
+        queue.Push(packet);
+    }
+
+    PartialWriteSocket socket(SIZE_MAX);
+    EXPECT_TRUE(queue.Send(socket));
+    EXPECT_EQ(socket.SendCalls, 1u);
+    EXPECT_EQ(socket.Sent, expected);
+}
+
+TEST(NetworkPacketQueueTest, front_packet_is_placed_after_partially_sent_packet)
+{
+    auto first = CreateQueuedPacket(1, 20);
+    auto second = CreateQueuedPacket(2, 20);
+    auto urgent = CreateQueuedPacket(3, 20);
+    std::vector<uint8_t> expected;
+    AppendFramed(expected, *first);
+    AppendFramed(expected, *urgent);
+    AppendFramed(expected, *second);
+
+    NetworkPacketQueue queue;
+    queue.Push(first);
+    queue.Push(second);
+    PartialWriteSocket socket(5);
+    EXPECT_FALSE(queue.Send(socket));
+    queue.Push(urgent, true);
+    while (!queue.Send(socket))
+    {
+    }
+    EXPECT_EQ(socket.Sent, expected);
+}
+
+TEST(NetworkPacketQueueTest, broadcast_packet_is_shared_between_queues)
+{
+    auto packet = CreateQueuedPacket(4, 100);
+    NetworkPacketQueue queues[3];
+    for (auto& queue : queues)
+    {
+        queue.Push(packet);
+    }
+    EXPECT_EQ(packet.use_count(), 4);
+
+    std::vector<uint8_t> expected;
+    AppendFramed(expected, *packet);
+    for (auto& queue : queues)
+    {
+        PartialWriteSocket socket(SIZE_MAX);
+        EXPECT_TRUE(queue.Send(socket));
+        EXPECT_EQ(socket.Sent, expected);
+    }
+    EXPECT_EQ(packet.use_count(), 1);
+}
+
+TEST(SpscQueueTest, items_arrive_in_order)
+{
+    constexpr int32_t count = 100000;
+    SpscQueue<int32_t> queue;
+    std::thread producer([&queue]() {
+        for (int32_t i = 0; i < count; i++)
+        {
+            queue.Push(i);
+        }
+    });
+
+    int32_t expected = 0;
+    while (expected < count)
+    {
+        int32_t value;
+        if (queue.TryPop(value))
+        {
+            ASSERT_EQ(value, expected);
+            expected++;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(NetworkIOThreadTest, inbound_data_is_split_into_packets)
+{
+    auto channel = AcceptChannel();
+    ASSERT_NE(channel, nullptr);
+    EXPECT_EQ(channel->GetHostName(), "127.0.0.1");
+
+    // Several packets in one send, the last one larger than the receive buffer of the I/O thread
+    std::vector<std::vector<uint8_t>> payloads = {
+        CreatePayload(1, 1),
+        CreatePayload(300, 2),
+        CreatePayload(65535, 3),
+    };
+    std::vector<uint8_t> stream;
+    for (const auto& payload : payloads)
+    {
+        uint16_t sizen = Convert::HostToNetwork((uint16_t)payload.size());
+        stream.insert(stream.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
+        stream.insert(stream.end(), payload.begin(), payload.end());
+    }
+    size_t sent = 0;
+    ASSERT_TRUE(WaitFor([&]() {
+        sent += _client->SendData(stream.data() + sent, stream.size() - sent);
+        return sent == stream.size();
+    }));
+
+    for (const auto& payload : payloads)
+    {
+        std::unique_ptr<NetworkPacket> packet;
+        ASSERT_TRUE(WaitFor([&]() { return (packet = channel->ReceivePacket()) != nullptr; }));
+        EXPECT_EQ(packet->Size, payload.size());
+        EXPECT_EQ(*packet->Data, payload);
+    }
+    EXPECT_FALSE(channel->IsClosed());
+
+    _client->Close();
+    EXPECT_TRUE(WaitFor([&]() { return channel->IsClosed(); }));
+}
+
+TEST_F(NetworkIOThreadTest, outbound_packets_are_sent_before_disconnecting)
+{
+    auto channel = AcceptChannel();
+    ASSERT_NE(channel, nullptr);
+
+    std::vector<uint8_t> expected;
+    for (uint8_t i = 0; i < 50; i++)
+    {
+        auto payload = CreatePayload(i * 1000 + 1, i);
+        uint16_t sizen = Convert::HostToNetwork((uint16_t)payload.size());
+        expected.insert(expected.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
+        expected.insert(expected.end(), payload.begin(), payload.end());
+        channel->SendPacket(CreatePacket(payload));
+    }
+    channel->Flush();
+    channel->Disconnect();
+
+    EXPECT_EQ(ReceiveUntilDisconnected(), expected);
+    EXPECT_TRUE(WaitFor([&]() { return channel->IsClosed(); }));
+}
+
+TEST_F(NetworkIOThreadTest, released_channel_closes_the_connection)
+{
+    auto channel = AcceptChannel();
+    ASSERT_NE(channel, nullptr);
+    channel->Release();
+    EXPECT_TRUE(ReceiveUntilDisconnected().empty());
+}
+
+#endif // DISABLE_NETWORK
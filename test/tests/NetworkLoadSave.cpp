@@ -53,6 +53,7 @@ static bool LoadMap(IStream* stream)
 
         // Read other data not in normal save files
         stream->Read(gSpriteSpatialIndex, 0x10001 * sizeof(uint16_t));
+        sprite_incremental_checksum_invalidate();
         gGamePaused = stream->ReadValue<uint32_t>();
         _guestGenerationProbability = stream->ReadValue<uint32_t>();
         _suggestedGuestMaximum = stream->ReadValue<uint32_t>();
@@ -90,7 +91,6 @@ static bool LoadMap(IStream* stream)
 static bool SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects)
 {
     bool result = false;
-    map_reorganise_elements();
     viewport_set_saved_view();
     try
     {
@@ -179,6 +179,7 @@ TEST(NetworkLoadSave, all)
     {
         for (int i = 0; i < 100; i++)
         {
+            sprite_incremental_checksum();
             mainContext->GetGameState()->UpdateLogic();
         }
     }
@@ -186,6 +187,8 @@ TEST(NetworkLoadSave, all)
     MemoryStream savedPark;
     rct_sprite_checksum checksumSave;
     rct_sprite_checksum checksumLoad;
+    uint64_t incrementalChecksumSave;
+    uint64_t incrementalChecksumLoad;
 
     // Save park.
     {
@@ -195,6 +198,11 @@ TEST(NetworkLoadSave, all)
         ASSERT_TRUE(saveResult);
 
         checksumSave = sprite_checksum();
+
+        // The checksum maintained over the last ticks has to match one computed from scratch.
+        incrementalChecksumSave = sprite_incremental_checksum();
+        sprite_incremental_checksum_invalidate();
+        ASSERT_EQ(incrementalChecksumSave, sprite_incremental_checksum());
     }
 
     // Import the exported version.
@@ -207,9 +215,11 @@ TEST(NetworkLoadSave, all)
         network_game_load_init();
 
         checksumLoad = sprite_checksum();
+        incrementalChecksumLoad = sprite_incremental_checksum();
     }
 
     ASSERT_EQ(checksumSave.ToString(), checksumLoad.ToString());
+    ASSERT_EQ(incrementalChecksumSave, incrementalChecksumLoad);
 
     SUCCEED();
 }
@@ -0,0 +1,113 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <chrono>
+#    include <cstring>
+#    include <gtest/gtest.h>
+#    include <openrct2/network/NetworkMapSnapshot.h>
+#    include <openrct2/network/NetworkTypes.h>
+#    include <openrct2/util/Util.h>
+#    include <random>
+#    include <thread>
+
+class NetworkMapSnapshotTest : public testing::Test
+{
+protected:
+    // Looks like a park: long runs of repeated values with some noise
+    static std::vector<uint8_t> CreateParkData(size_t length)
+    {
+        std::mt19937 rng(42);
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = (rng() % 8 == 0) ? (uint8_t)rng() : (uint8_t)(i / 4096);
+        }
+        return data;
+    }
+
+    static std::unique_ptr<MemoryStream> CreateStream(const std::vector<uint8_t>& data)
+    {
+        auto ms = std::make_unique<MemoryStream>();
+        ms->Write(data.data(), data.size());
+        return ms;
+    }
+
+    static std::vector<std::shared_ptr<const NetworkPacket>> WaitForChunks(const NetworkMapSnapshot& snapshot)
+    {
+        std::vector<std::shared_ptr<const NetworkPacket>> chunks;
+        auto startTime = std::chrono::steady_clock::now();
+        bool complete = false;
+        while (!complete && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(30))
+        {
+            auto newChunks = snapshot.GetChunks(chunks.size(), complete);
+            chunks.insert(chunks.end(), newChunks.begin(), newChunks.end());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_TRUE(complete);
+        return chunks;
+    }
+};
+
+TEST_F(NetworkMapSnapshotTest, chunks_reassemble_to_the_compressed_park)
+{
+    auto park = CreateParkData(4 * 1024 * 1024);
+    NetworkMapSnapshot snapshot({}, CreateStream(park));
+    auto chunks = WaitForChunks(snapshot);
+    EXPECT_FALSE(snapshot.HasFailed());
+    ASSERT_GT(chunks.size(), 1u);
+
+    std::vector<uint8_t> map;
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        NetworkPacket packet = *chunks[i];
+        ASSERT_EQ(packet.Size, packet.Data->size());
+        uint32_t command, size, offset;
+        packet >> command >> size >> offset;
+        EXPECT_EQ(command, (uint32_t)NETWORK_COMMAND_MAP);
+        EXPECT_EQ(offset, map.size());
+        size_t length = packet.Size - packet.BytesRead;
+        auto data = packet.Read(length);
+        map.insert(map.end(), data, data + length);
+
+        // Only the last chunk knows the size of the whole map
+        EXPECT_EQ(size, i == chunks.size() - 1 ? map.size() : 0);
+    }
+
+    const char header[] = "open2_sv6_zlib";
+    ASSERT_GT(map.size(), sizeof(header));
+    ASSERT_EQ(std::memcmp(map.data(), header, sizeof(header)), 0);
+    size_t inflatedSize;
+    auto inflated = util_zlib_inflate(&map[sizeof(header)], map.size() - sizeof(header), &inflatedSize);
+    ASSERT_NE(inflated, nullptr);
+    EXPECT_EQ(std::vector<uint8_t>(inflated, inflated + inflatedSize), park);
+    free(inflated);
+}
+
+TEST_F(NetworkMapSnapshotTest, chunks_are_shared)
+{
+    NetworkMapSnapshot snapshot({}, CreateStream(CreateParkData(256 * 1024)));
+    auto chunks = WaitForChunks(snapshot);
+    bool complete;
+    auto again = snapshot.GetChunks(0, complete);
+    EXPECT_TRUE(complete);
+    EXPECT_EQ(again, chunks);
+}
+
+TEST_F(NetworkMapSnapshotTest, can_be_destroyed_while_compressing)
+{
+    auto park = CreateParkData(16 * 1024 * 1024);
+    for (int32_t i = 0; i < 4; i++)
+    {
+        NetworkMapSnapshot snapshot({}, CreateStream(park));
+    }
+}
+
+#endif // DISABLE_NETWORK
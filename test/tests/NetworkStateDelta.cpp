@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include <gtest/gtest.h>
+#    include <openrct2/network/NetworkStateDelta.h>
+#    include <random>
+
+class NetworkStateDeltaTest : public testing::Test
+{
+protected:
+    static std::vector<uint8_t> CreateState(size_t length, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data(length);
+        for (auto& value : data)
+        {
+            value = (uint8_t)rng();
+        }
+        return data;
+    }
+
+    static std::vector<uint8_t> CreateDelta(const std::vector<uint8_t>& state, const std::vector<uint8_t>& base)
+    {
+        auto baseHashes = NetworkStateDelta::HashBlocks(base.data(), base.size());
+        return NetworkStateDelta::Create(state.data(), state.size(), baseHashes);
+    }
+};
+
+TEST_F(NetworkStateDeltaTest, only_changed_blocks_are_sent)
+{
+    auto base = CreateState(64 * NetworkStateDelta::BlockSize + 100, 1);
+    auto state = base;
+    state[3 * NetworkStateDelta::BlockSize + 17] ^= 0xFF;
+    state[40 * NetworkStateDelta::BlockSize] ^= 0x01;
+
+    auto delta = CreateDelta(state, base);
+    EXPECT_LT(delta.size(), 3 * NetworkStateDelta::BlockSize);
+    ASSERT_TRUE(NetworkStateDelta::Apply(base, delta.data(), delta.size()));
+    EXPECT_EQ(base, state);
+}
+
+TEST_F(NetworkStateDeltaTest, identical_states_produce_empty_delta)
+{
+    auto base = CreateState(10 * NetworkStateDelta::BlockSize, 2);
+    auto delta = CreateDelta(base, base);
+    EXPECT_EQ(delta.size(), 2 * sizeof(uint32_t));
+
+    auto state = base;
+    ASSERT_TRUE(NetworkStateDelta::Apply(base, delta.data(), delta.size()));
+    EXPECT_EQ(base, state);
+}
+
+TEST_F(NetworkStateDeltaTest, state_can_grow_and_shrink)
+{
+    auto base = CreateState(5 * NetworkStateDelta::BlockSize + 1000, 3);
+
+    auto grown = base;
+    auto extra = CreateState(3 * NetworkStateDelta::BlockSize, 4);
+    grown.insert(grown.end(), extra.begin(), extra.end());
+    auto growDelta = CreateDelta(grown, base);
+    auto state = base;
+    ASSERT_TRUE(NetworkStateDelta::Apply(state, growDelta.data(), growDelta.size()));
+    EXPECT_EQ(state, grown);
+
+    auto shrunk = std::vector<uint8_t>(base.begin(), base.begin() + 2 * NetworkStateDelta::BlockSize + 10);
+    auto shrinkDelta = CreateDelta(shrunk, base);
+    state = base;
+    ASSERT_TRUE(NetworkStateDelta::Apply(state, shrinkDelta.data(), shrinkDelta.size()));
+    EXPECT_EQ(state, shrunk);
+
+    auto empty = CreateDelta({}, base);
+    ASSERT_TRUE(NetworkStateDelta::Apply(state, empty.data(), empty.size()));
+    EXPECT_TRUE(state.empty());
+}
+
+TEST_F(NetworkStateDeltaTest, malformed_delta_leaves_base_untouched)
+{
+    auto base = CreateState(8 * NetworkStateDelta::BlockSize, 5);
+    auto state = CreateState(12 * NetworkStateDelta::BlockSize, 6);
+    auto delta = CreateDelta(state, base);
+
+    auto original = base;
+    // Truncated
+    EXPECT_FALSE(NetworkStateDelta::Apply(base, delta.data(), delta.size() - 1));
+    EXPECT_FALSE(NetworkStateDelta::Apply(base, delta.data(), 6));
+    // Trailing bytes
+    auto padded = delta;
+    padded.push_back(0);
+    EXPECT_FALSE(NetworkStateDelta::Apply(base, padded.data(), padded.size()));
+    // Block index out of range
+    auto outOfRange = delta;
+    outOfRange[8] = 0xFF;
+    EXPECT_FALSE(NetworkStateDelta::Apply(base, outOfRange.data(), outOfRange.size()));
+    // Applied to a base that lacks blocks the delta does not carry
+    auto shortBase = std::vector<uint8_t>(base.begin(), base.begin() + 1000);
+    auto sameLength = CreateDelta(base, base);
+    EXPECT_FALSE(NetworkStateDelta::Apply(shortBase, sameLength.data(), sameLength.size()));
+    EXPECT_EQ(shortBase.size(), 1000u);
+
+    EXPECT_EQ(base, original);
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,134 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/object/ObjectCache.h>
+#include <string>
+#include <vector>
+
+class ObjectCacheTest : public testing::Test
+{
+protected:
+    static constexpr const char* CachePath = "objectcache_test.dat";
+    static constexpr const char* SourcePath = "objectcache_test_source.dat";
+
+    void SetUp() override
+    {
+        File::Delete(CachePath);
+        WriteSource({ 1, 2, 3, 4 });
+    }
+
+    void TearDown() override
+    {
+        File::Delete(CachePath);
+        File::Delete(SourcePath);
+    }
+
+    static void WriteSource(const std::vector<uint8_t>& data)
+    {
+        File::WriteAllBytes(SourcePath, data.data(), data.size());
+    }
+
+    static std::vector<uint8_t> GetPayload()
+    {
+        std::vector<uint8_t> payload(1000);
+        for (size_t i = 0; i < payload.size(); i++)
+        {
+            payload[i] = (uint8_t)(i * 7);
+        }
+        return payload;
+    }
+
+    static std::vector<uint8_t> ToVector(const ObjectCacheData& data)
+    {
+        return std::vector<uint8_t>(data.Data, data.Data + data.Length);
+    }
+};
+
+TEST_F(ObjectCacheTest, saved_entries_are_read_on_next_open)
+{
+    {
+        ObjectCache cache(CachePath);
+        EXPECT_FALSE(cache.Get(SourcePath).has_value());
+        cache.Set(SourcePath, GetPayload());
+        cache.Save();
+    }
+
+    ObjectCache cache(CachePath);
+    auto data = cache.Get(SourcePath);
+    ASSERT_TRUE(data.has_value());
+    EXPECT_EQ(ToVector(*data), GetPayload());
+}
+
+TEST_F(ObjectCacheTest, entries_are_ignored_once_the_source_changes)
+{
+    {
+        ObjectCache cache(CachePath);
+        cache.Set(SourcePath, GetPayload());
+        cache.Save();
+    }
+
+    WriteSource({ 1, 2, 3, 4, 5 });
+
+    ObjectCache cache(CachePath);
+    EXPECT_FALSE(cache.Get(SourcePath).has_value());
+}
+
+TEST_F(ObjectCacheTest, corrupt_entries_are_ignored)
+{
+    {
+        ObjectCache cache(CachePath);
+        cache.Set(SourcePath, GetPayload());
+        cache.Save();
+    }
+
+    // The payload is at the end of the file
+    auto bytes = File::ReadAllBytes(CachePath);
+    bytes.back() ^= 0xFF;
+    File::WriteAllBytes(CachePath, bytes.data(), bytes.size());
+
+    ObjectCache cache(CachePath);
+    EXPECT_FALSE(cache.Get(SourcePath).has_value());
+}
+
+TEST_F(ObjectCacheTest, data_stays_valid_after_the_cache_is_rewritten)
+{
+    ObjectCache cache(CachePath);
+    cache.Set(SourcePath, GetPayload());
+    cache.Save();
+
+    auto data = cache.Get(SourcePath);
+    ASSERT_TRUE(data.has_value());
+
+    cache.Set("objectcache_test_other.dat", { 9 });
+    cache.Save();
+    EXPECT_EQ(ToVector(*data), GetPayload());
+}
+
+TEST_F(ObjectCacheTest, entries_are_ignored_once_a_dependency_changes)
+{
+    static constexpr const char* DependencyPath = "objectcache_test_dependency.dat";
+    uint8_t dependencyData[] = { 1, 2 };
+    File::WriteAllBytes(DependencyPath, dependencyData, sizeof(dependencyData));
+    {
+        ObjectCache cache(CachePath);
+        cache.Set(SourcePath, GetPayload(), { DependencyPath });
+        cache.Save();
+    }
+    {
+        ObjectCache cache(CachePath);
+        EXPECT_TRUE(cache.Get(SourcePath).has_value());
+    }
+
+    File::WriteAllBytes(DependencyPath, dependencyData, 1);
+
+    ObjectCache cache(CachePath);
+    EXPECT_FALSE(cache.Get(SourcePath).has_value());
+    File::Delete(DependencyPath);
+}
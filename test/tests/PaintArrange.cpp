@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/paint/Paint.h>
+#include <random>
+#include <vector>
+
+class PaintArrangeTest : public testing::Test
+{
+protected:
+    struct GeneratedSession
+    {
+        std::unique_ptr<paint_session> Session = std::make_unique<paint_session>();
+        std::vector<paint_struct> Structs;
+    };
+
+    // Fills a session with overlapping bounding boxes spread over a few neighbouring quadrants.
+    static void Generate(GeneratedSession& generated, uint32_t seed, size_t count, uint8_t rotation, uint32_t spread)
+    {
+        std::mt19937 rng(seed);
+        auto& session = *generated.Session;
+        session = {};
+        session.CurrentRotation = rotation;
+        session.QuadrantBackIndex = UINT32_MAX;
+        session.QuadrantFrontIndex = 0;
+
+        generated.Structs.assign(count, paint_struct{});
+        uint32_t firstQuadrant = rng() % 256;
+        for (auto& ps : generated.Structs)
+        {
+            ps.bounds.x = rng() % 512;
+            ps.bounds.y = rng() % 512;
+            ps.bounds.z = rng() % 256;
+            ps.bounds.x_end = ps.bounds.x + rng() % 64;
+            ps.bounds.y_end = ps.bounds.y + rng() % 64;
+            ps.bounds.z_end = ps.bounds.z + rng() % 64;
+            ps.quadrant_flags = rng() & 0xFF;
+
+            uint32_t quadrantIndex = firstQuadrant + rng() % spread;
+            ps.quadrant_index = quadrantIndex;
+            ps.next_quadrant_ps = session.Quadrants[quadrantIndex];
+            session.Quadrants[quadrantIndex] = &ps;
+            session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, quadrantIndex);
+            session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, quadrantIndex);
+        }
+    }
+
+    static std::vector<size_t> GetOrder(const GeneratedSession& generated)
+    {
+        std::vector<size_t> order;
+        for (auto ps = generated.Session->PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+        {
+            order.push_back(ps - generated.Structs.data());
+        }
+        return order;
+    }
+};
+
+TEST_F(PaintArrangeTest, empty_session)
+{
+    GeneratedSession generated;
+    Generate(generated, 0, 0, 0, 1);
+    paint_session_arrange(generated.Session.get(), PaintArrangeEngine::Flat);
+    ASSERT_EQ(generated.Session->PaintHead.next_quadrant_ps, nullptr);
+}
+
+TEST_F(PaintArrangeTest, flat_matches_legacy)
+{
+    std::mt19937 rng(0);
+    GeneratedSession legacy;
+    GeneratedSession flat;
+    for (int32_t i = 0; i < 2000; i++)
+    {
+        uint32_t seed = rng();
+        size_t count = rng() % 300;
+        uint8_t rotation = rng() % 4;
+        uint32_t spread = 1 + rng() % 40;
+
+        Generate(legacy, seed, count, rotation, spread);
+        Generate(flat, seed, count, rotation, spread);
+        paint_session_arrange(legacy.Session.get(), PaintArrangeEngine::Legacy);
+        paint_session_arrange(flat.Session.get(), PaintArrangeEngine::Flat);
+
+        auto order = GetOrder(flat);
+        ASSERT_EQ(order.size(), count);
+        ASSERT_EQ(order, GetOrder(legacy)) << "seed " << seed << ", rotation " << (int32_t)rotation;
+        for (size_t j = 0; j < count; j++)
+        {
+            ASSERT_EQ(flat.Structs[j].quadrant_flags, legacy.Structs[j].quadrant_flags);
+        }
+    }
+}
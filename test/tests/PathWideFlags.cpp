@@ -0,0 +1,202 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/Map.h>
+#include <random>
+#include <vector>
+
+class PathWideFlagsTest : public testing::Test
+{
+protected:
+    // Paths are only placed in a small area so they end up next to each other often.
+    static constexpr int32_t AreaStart = 8;
+    static constexpr int32_t AreaSize = 24;
+
+    std::mt19937 _rng{ 0 };
+
+    void SetUp() override
+    {
+        gScreenFlags = 0;
+        for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+        {
+            TileElement* tileElement = &gTileElements[i];
+            tileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+            tileElement->SetLastForTile(true);
+        }
+        map_update_tile_pointers();
+        gWidePathTileLoopX = 0;
+        gWidePathTileLoopY = 0;
+        map_invalidate_all_path_wide_flags();
+        RecalculateWideFlags();
+    }
+
+    // Recomputes every tile in tile order, which is what the sweep settles on.
+    static void RecalculateWideFlags()
+    {
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                footpath_update_path_wide_flags(x * 32, y * 32);
+            }
+        }
+    }
+
+    // Runs the sweep over the whole map twice, so flags read across the point where it wraps are settled as well.
+    static void SweepWideFlags()
+    {
+        constexpr int32_t ticksPerSweep = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL / 128;
+        for (int32_t i = 0; i < 2 * ticksPerSweep; i++)
+        {
+            map_update_path_wide_flags();
+        }
+    }
+
+    TileCoordsXY GetRandomTile()
+    {
+        return { AreaStart + (int32_t)(_rng() % AreaSize), AreaStart + (int32_t)(_rng() % AreaSize) };
+    }
+
+    void RandomisePath(PathElement* pathElement)
+    {
+        // Fully connected paths form the squares that make paths wide and let changes cascade.
+        pathElement->SetEdgesAndCorners(_rng() % 2 == 0 ? 0xFF : _rng() & 0xFF);
+        pathElement->SetIsQueue(_rng() % 16 == 0);
+        pathElement->SetSloped(_rng() % 16 == 0);
+    }
+
+    // Adds, removes or changes a path and returns the tile that was changed.
+    TileCoordsXY Edit()
+    {
+        auto tile = GetRandomTile();
+        TileElement* tileElement = map_get_first_element_at(tile.x, tile.y);
+        TileElement* pathElement = nullptr;
+        do
+        {
+            if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+            {
+                pathElement = tileElement;
+                break;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+
+        if (pathElement == nullptr)
+        {
+            // Mostly at one height so neighbouring paths line up.
+            uint8_t z = _rng() % 4 == 0 ? 6 : 4;
+            pathElement = tile_element_insert({ tile.x, tile.y, z }, 0b1111);
+            pathElement->SetType(TILE_ELEMENT_TYPE_PATH);
+            RandomisePath(pathElement->AsPath());
+        }
+        else if (_rng() % 3 == 0)
+        {
+            tile_element_remove(pathElement);
+        }
+        else
+        {
+            RandomisePath(pathElement->AsPath());
+        }
+        return tile;
+    }
+
+    static std::vector<bool> GetWideFlags()
+    {
+        std::vector<bool> flags;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                TileElement* tileElement = map_get_first_element_at(x, y);
+                do
+                {
+                    if (tileElement->GetType() == TILE_ELEMENT_TYPE_PATH)
+                    {
+                        flags.push_back(tileElement->AsPath()->IsWide());
+                    }
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        return flags;
+    }
+};
+
+TEST_F(PathWideFlagsTest, incremental_matches_full_recompute)
+{
+    size_t wideCount = 0;
+    for (int32_t i = 0; i < 2000; i++)
+    {
+        // Several edits can be queued before the next update.
+        int32_t editCount = 1 + _rng() % 4;
+        for (int32_t j = 0; j < editCount; j++)
+        {
+            auto tile = Edit();
+            map_invalidate_path_wide_flags({ tile.x * 32, tile.y * 32 });
+        }
+        SweepWideFlags();
+
+        auto incremental = GetWideFlags();
+        RecalculateWideFlags();
+        auto full = GetWideFlags();
+        ASSERT_EQ(incremental, full) << "after edit " << i;
+
+        for (bool isWide : full)
+        {
+            wideCount += isWide ? 1 : 0;
+        }
+    }
+
+    // Make sure the layouts were dense enough to make paths wide at all.
+    ASSERT_GT(wideCount, 0U);
+}
+
+TEST_F(PathWideFlagsTest, update_without_changes_keeps_flags)
+{
+    for (int32_t i = 0; i < 400; i++)
+    {
+        Edit();
+    }
+    RecalculateWideFlags();
+    auto full = GetWideFlags();
+
+    // Recomputing tiles that did not change must not change anything.
+    for (int32_t i = 0; i < 100; i++)
+    {
+        auto tile = GetRandomTile();
+        map_invalidate_path_wide_flags({ tile.x * 32, tile.y * 32 });
+    }
+    SweepWideFlags();
+    ASSERT_EQ(GetWideFlags(), full);
+}
+
+TEST_F(PathWideFlagsTest, flags_change_when_sweep_reaches_tile)
+{
+    // A square of fully connected paths, which makes some of them wide.
+    for (int32_t y = AreaStart; y < AreaStart + 3; y++)
+    {
+        for (int32_t x = AreaStart; x < AreaStart + 3; x++)
+        {
+            TileElement* pathElement = tile_element_insert({ x, y, 4 }, 0b1111);
+            pathElement->SetType(TILE_ELEMENT_TYPE_PATH);
+            pathElement->AsPath()->SetEdgesAndCorners(0xFF);
+            map_invalidate_path_wide_flags({ x * 32, y * 32 });
+        }
+    }
+    auto before = GetWideFlags();
+
+    // The sweep has just passed the square, so the flags must not change before it comes around again.
+    gWidePathTileLoopX = 0;
+    gWidePathTileLoopY = (AreaStart + 4) * 32;
+    map_update_path_wide_flags();
+    ASSERT_EQ(GetWideFlags(), before);
+
+    SweepWideFlags();
+    ASSERT_NE(GetWideFlags(), before);
+}
@@ -4,6 +4,7 @@
 #include "openrct2/ride/Station.h"
 #include "openrct2/scenario/Scenario.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
@@ -213,6 +214,47 @@ TEST_P(SimplePathfindingTest, CanFindPathFromStartToGoal)
     EXPECT_TRUE(succeeded);
 }
 
+TEST_P(SimplePathfindingTest, CanReachRideFromStart)
+{
+    const SimplePathfindingScenario& scenario = GetParam();
+
+    auto ride = FindRideByName(scenario.name);
+    ASSERT_NE(ride, nullptr);
+
+    // The junction graph has to lead from the start to the entrance of the ride as well.
+    auto rides = peep_pathfind_get_reachable_rides(scenario.start);
+    EXPECT_NE(std::find(rides.begin(), rides.end(), ride->id), rides.end());
+}
+
+TEST_P(SimplePathfindingTest, DistanceFieldMatchesHeuristicSearch)
+{
+    const SimplePathfindingScenario& scenario = GetParam();
+
+    auto ride = FindRideByName(scenario.name);
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride_get_entrance_location(ride, 0);
+    TileCoordsXYZ goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    Peep* peep = Peep::Generate({ scenario.start.x * 32 + 16, scenario.start.y * 32 + 16, scenario.start.z * 8 });
+    peep->outside_of_park = 0;
+    peep->guest_heading_to_ride_id = ride->id;
+
+    // Both searches have to take the same first step; equal routes go the lowest direction in both.
+    gPeepPathFindGoalPosition = goal;
+    gPeepPathFindIgnoreForeignQueues = true;
+    gPeepPathFindQueueRideIndex = ride->id;
+    const Direction heuristicDir = peep_pathfind_choose_direction(scenario.start, peep);
+    const Direction distanceDir = peep_pathfind_choose_direction_by_distance(scenario.start);
+
+    peep_sprite_remove(peep);
+
+    EXPECT_NE(distanceDir, INVALID_DIRECTION);
+    EXPECT_EQ(distanceDir, heuristicDir);
+}
+
 INSTANTIATE_TEST_CASE_P(
     ForScenario, SimplePathfindingTest,
     ::testing::Values(
@@ -246,6 +288,24 @@ TEST_P(ImpossiblePathfindingTest, CannotFindPathFromStartToGoal)
     EXPECT_FALSE(FindPath(&pos, goal, 10000, ride->id));
 }
 
+TEST_P(ImpossiblePathfindingTest, DistanceFieldHasNoDirection)
+{
+    const SimplePathfindingScenario& scenario = GetParam();
+
+    auto ride = FindRideByName(scenario.name);
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride_get_entrance_location(ride, 0);
+    gPeepPathFindGoalPosition = TileCoordsXYZ(
+        entrancePos.x + TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y + TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+    gPeepPathFindIgnoreForeignQueues = true;
+    gPeepPathFindQueueRideIndex = ride->id;
+
+    // Guests fall back to the heuristic search when the goal can not be reached.
+    EXPECT_EQ(peep_pathfind_choose_direction_by_distance(scenario.start), INVALID_DIRECTION);
+}
+
 INSTANTIATE_TEST_CASE_P(
     ForScenario, ImpossiblePathfindingTest,
     ::testing::Values(
@@ -22,6 +22,7 @@
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Sprite.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -98,6 +99,44 @@ TEST_P(ReplayTests, RunReplay)
     }
 }
 
+TEST_P(ReplayTests, RunReplayActions)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    core_init();
+
+    auto testData = GetParam();
+    auto replayFile = testData.filePath;
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    // Playing only the actions on the park of the replay has to end up in the same state as the replay
+    ASSERT_TRUE(replayManager->LoadReplayPark(replayFile));
+    ASSERT_TRUE(replayManager->StartActionPlayback(replayFile));
+    while (replayManager->IsPlayingActions())
+    {
+        gs->UpdateLogic();
+    }
+    uint32_t endTick = gCurrentTicks;
+    auto actionsChecksum = sprite_checksum();
+
+    ASSERT_TRUE(replayManager->StartPlayback(replayFile));
+    while (replayManager->IsReplaying() && gCurrentTicks < endTick)
+    {
+        gs->UpdateLogic();
+    }
+    ASSERT_EQ(gCurrentTicks, endTick);
+    ASSERT_EQ(sprite_checksum().ToString(), actionsChecksum.ToString());
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
@@ -19,7 +19,9 @@
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Map.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -43,6 +45,40 @@ protected:
         }
     }
 
+    void EvaluateRatingsForAllRides()
+    {
+        // Evaluate every ride before applying any result, so the evaluation is shown not to depend on earlier results
+        std::vector<std::pair<ride_id_t, RideRatingResult>> results;
+        for (const auto& ride : GetRideManager())
+        {
+            auto result = ride_ratings_evaluate(ride);
+            if (result)
+            {
+                results.emplace_back(ride.id, *result);
+            }
+        }
+        for (const auto& [rideId, result] : results)
+        {
+            ride_ratings_apply(*get_ride(rideId), result);
+        }
+    }
+
+    void ExpectRatingsMatchTestData()
+    {
+        auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+        auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+        int expI = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            auto actual = FormatRatings(ride);
+            auto expected = expectedRatings[expI];
+            ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+            expI++;
+        }
+    }
+
     std::string FormatRatings(const Ride& ride)
     {
         rating_tuple ratings = ride.ratings;
@@ -87,3 +123,63 @@ TEST_F(RideRatings, all)
         expI++;
     }
 }
+
+TEST_F(RideRatings, all_evaluated)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+    ASSERT_EQ(ride_get_count(), 134);
+
+    // The tick by tick update must not be disturbed by evaluating rides on the side
+    auto calcDataBefore = gRideRatingsCalcData;
+    EvaluateRatingsForAllRides();
+    EXPECT_EQ(calcDataBefore.state, gRideRatingsCalcData.state);
+    EXPECT_EQ(calcDataBefore.current_ride, gRideRatingsCalcData.current_ride);
+    EXPECT_EQ(calcDataBefore.proximity_total, gRideRatingsCalcData.proximity_total);
+
+    ExpectRatingsMatchTestData();
+}
+
+TEST_F(RideRatings, all_from_snapshots)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+    ASSERT_EQ(ride_get_count(), 134);
+
+    // A snapshot has to carry everything the rating reads, so rate the snapshots after the map has been wiped
+    std::vector<RideRatingsSnapshot> snapshots;
+    for (const auto& ride : GetRideManager())
+    {
+        snapshots.push_back(RideRatingsSnapshot::FromRide(ride));
+    }
+    map_init(gMapSize);
+
+    for (const auto& snapshot : snapshots)
+    {
+        auto result = ride_ratings_evaluate(snapshot);
+        if (result)
+        {
+            ride_ratings_apply(*get_ride(snapshot.GetRide().id), *result);
+        }
+    }
+
+    ExpectRatingsMatchTestData();
+}
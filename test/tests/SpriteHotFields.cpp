@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/world/Sprite.h>
+#include <random>
+#include <vector>
+
+class SpriteHotFieldsTest : public testing::Test
+{
+protected:
+    std::mt19937 _rng{ 0 };
+
+    void SetUp() override
+    {
+        reset_sprite_list();
+    }
+
+    // The copy that was written through must be the same as one built from the sprites.
+    static void ExpectMatchesSprites()
+    {
+        auto writtenThrough = std::make_unique<SpriteHotFields>(sprite_hot_fields());
+        sprite_hot_fields_rebuild();
+        const auto& rebuilt = sprite_hot_fields();
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
+        {
+            ASSERT_EQ(writtenThrough->Next[i], rebuilt.Next[i]) << "sprite " << i;
+            ASSERT_EQ(writtenThrough->List[i], rebuilt.List[i]) << "sprite " << i;
+            ASSERT_EQ(writtenThrough->X[i], rebuilt.X[i]) << "sprite " << i;
+            ASSERT_EQ(writtenThrough->Y[i], rebuilt.Y[i]) << "sprite " << i;
+            ASSERT_EQ(writtenThrough->Z[i], rebuilt.Z[i]) << "sprite " << i;
+            ASSERT_EQ(writtenThrough->State[i], rebuilt.State[i]) << "sprite " << i;
+        }
+    }
+};
+
+TEST_F(SpriteHotFieldsTest, create_move_remove_keeps_copy_coherent)
+{
+    std::vector<rct_sprite*> sprites;
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        auto action = _rng() % 4;
+        if (action == 0 || sprites.empty())
+        {
+            auto sprite = create_sprite(SPRITE_IDENTIFIER_LITTER);
+            if (sprite != nullptr)
+            {
+                sprite->generic.sprite_identifier = SPRITE_IDENTIFIER_LITTER;
+                sprites.push_back(sprite);
+            }
+        }
+        else
+        {
+            size_t index = _rng() % sprites.size();
+            auto sprite = sprites[index];
+            if (action == 1)
+            {
+                sprite_move(_rng() % 0x2000, _rng() % 0x2000, _rng() % 0x800, sprite);
+            }
+            else if (action == 2)
+            {
+                move_sprite_to_list(sprite, (_rng() % 2) ? SPRITE_LIST_MISC : SPRITE_LIST_LITTER);
+            }
+            else
+            {
+                sprite_remove(sprite);
+                sprites.erase(sprites.begin() + index);
+            }
+        }
+    }
+    ExpectMatchesSprites();
+}
+
+TEST_F(SpriteHotFieldsTest, list_walk_matches_sprite_links)
+{
+    for (int32_t i = 0; i < 100; i++)
+    {
+        auto sprite = create_sprite(SPRITE_IDENTIFIER_LITTER);
+        ASSERT_NE(sprite, nullptr);
+        sprite->generic.sprite_identifier = SPRITE_IDENTIFIER_LITTER;
+        if (i % 3 == 0)
+        {
+            sprite_remove(sprite);
+        }
+    }
+
+    const auto& hotFields = sprite_hot_fields();
+    uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_LITTER];
+    uint16_t count = 0;
+    while (spriteIndex != SPRITE_INDEX_NULL)
+    {
+        EXPECT_EQ(hotFields.List[spriteIndex], SPRITE_LIST_LITTER);
+        EXPECT_EQ(hotFields.Next[spriteIndex], get_sprite(spriteIndex)->generic.next);
+        spriteIndex = hotFields.Next[spriteIndex];
+        count++;
+    }
+    EXPECT_EQ(count, gSpriteListCount[SPRITE_LIST_LITTER]);
+}
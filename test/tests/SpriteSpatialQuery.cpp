@@ -0,0 +1,201 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/ride/Vehicle.h>
+#include <openrct2/world/Sprite.h>
+#include <random>
+#include <vector>
+
+class SpriteSpatialQueryTest : public testing::Test
+{
+protected:
+    std::mt19937 _rng{ 0 };
+
+    void SetUp() override
+    {
+        reset_sprite_list();
+    }
+
+    rct_sprite* CreateSprite(SPRITE_IDENTIFIER type)
+    {
+        auto sprite = create_sprite(type);
+        if (sprite != nullptr)
+        {
+            sprite->generic.sprite_identifier = type;
+        }
+        return sprite;
+    }
+
+    // Positions are kept to a few tiles so the chains get long.
+    void MoveRandomly(rct_sprite* sprite)
+    {
+        sprite_move(_rng() % (4 * 32), _rng() % (4 * 32), _rng() % 0x800, sprite);
+    }
+
+    // The full chain of a tile filtered by type, as the tile walks did before.
+    static std::vector<uint16_t> FilteredChain(SPRITE_IDENTIFIER type, int32_t x, int32_t y)
+    {
+        std::vector<uint16_t> result;
+        for (uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y); spriteIndex != SPRITE_INDEX_NULL;
+             spriteIndex = get_sprite(spriteIndex)->generic.next_in_quadrant)
+        {
+            if (get_sprite(spriteIndex)->generic.sprite_identifier == type)
+            {
+                result.push_back(spriteIndex);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<uint16_t> TypedChain(SPRITE_IDENTIFIER type, int32_t x, int32_t y)
+    {
+        std::vector<uint16_t> result;
+        for (uint16_t spriteIndex = sprite_get_first_of_type_in_quadrant(type, x, y); spriteIndex != SPRITE_INDEX_NULL;
+             spriteIndex = sprite_get_next_of_type_in_quadrant(spriteIndex))
+        {
+            result.push_back(spriteIndex);
+        }
+        return result;
+    }
+
+    static void ExpectTypedChainsMatch()
+    {
+        for (int32_t x = 0; x < 4 * 32; x += 32)
+        {
+            for (int32_t y = 0; y < 4 * 32; y += 32)
+            {
+                for (auto type : { SPRITE_IDENTIFIER_VEHICLE, SPRITE_IDENTIFIER_PEEP, SPRITE_IDENTIFIER_MISC,
+                                   SPRITE_IDENTIFIER_LITTER })
+                {
+                    EXPECT_EQ(TypedChain(type, x, y), FilteredChain(type, x, y)) << "tile " << x << ", " << y;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SpriteSpatialQueryTest, typed_chains_follow_full_chain_order)
+{
+    const SPRITE_IDENTIFIER types[] = { SPRITE_IDENTIFIER_VEHICLE, SPRITE_IDENTIFIER_PEEP, SPRITE_IDENTIFIER_MISC,
+                                        SPRITE_IDENTIFIER_LITTER };
+    std::vector<rct_sprite*> sprites;
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        auto action = _rng() % 3;
+        if (action == 0 || sprites.empty())
+        {
+            auto sprite = CreateSprite(types[_rng() % std::size(types)]);
+            if (sprite != nullptr)
+            {
+                MoveRandomly(sprite);
+                sprites.push_back(sprite);
+            }
+        }
+        else
+        {
+            size_t index = _rng() % sprites.size();
+            if (action == 1)
+            {
+                MoveRandomly(sprites[index]);
+            }
+            else
+            {
+                sprite_remove(sprites[index]);
+                sprites.erase(sprites.begin() + index);
+            }
+        }
+    }
+    ExpectTypedChainsMatch();
+
+    // A rebuild from the full chains must give the same result as the incremental updates.
+    sprite_typed_spatial_index_rebuild();
+    ExpectTypedChainsMatch();
+}
+
+TEST_F(SpriteSpatialQueryTest, query_tile_visits_only_type_and_stops_early)
+{
+    for (int32_t i = 0; i < 6; i++)
+    {
+        auto sprite = CreateSprite((i % 2) ? SPRITE_IDENTIFIER_PEEP : SPRITE_IDENTIFIER_LITTER);
+        ASSERT_NE(sprite, nullptr);
+        sprite_move(40, 40, 0, sprite);
+    }
+
+    int32_t visited = 0;
+    bool stopped = sprite_query_tile<Peep>(40, 40, [&visited](Peep* peep) {
+        EXPECT_EQ(peep->sprite_identifier, SPRITE_IDENTIFIER_PEEP);
+        visited++;
+        return false;
+    });
+    EXPECT_FALSE(stopped);
+    EXPECT_EQ(visited, 3);
+
+    visited = 0;
+    stopped = sprite_query_tile<rct_litter>(40, 40, [&visited](rct_litter*) {
+        visited++;
+        return visited == 2;
+    });
+    EXPECT_TRUE(stopped);
+    EXPECT_EQ(visited, 2);
+
+    // Removing the visited sprite must not break the walk.
+    visited = 0;
+    sprite_query_tile<rct_litter>(40, 40, [&visited](rct_litter* litter) {
+        sprite_remove((rct_sprite*)litter);
+        visited++;
+        return false;
+    });
+    EXPECT_EQ(visited, 3);
+    EXPECT_EQ(sprite_get_first_of_type_in_quadrant(SPRITE_IDENTIFIER_LITTER, 40, 40), SPRITE_INDEX_NULL);
+}
+
+TEST_F(SpriteSpatialQueryTest, query_box_visits_every_overlapping_tile)
+{
+    std::vector<rct_sprite*> sprites;
+    for (int32_t i = 0; i < 500; i++)
+    {
+        auto sprite = CreateSprite(SPRITE_IDENTIFIER_LITTER);
+        ASSERT_NE(sprite, nullptr);
+        sprite_move(_rng() % (8 * 32), _rng() % (8 * 32), 0, sprite);
+        sprites.push_back(sprite);
+    }
+
+    // Includes boxes that are cut off by the map edge
+    const int32_t boxes[][4] = { { 40, 40, 40, 40 }, { 33, 70, 150, 95 }, { -100, -5, 31, 64 }, { 0, 0, 255, 255 } };
+    for (const auto& box : boxes)
+    {
+        std::vector<uint16_t> expected;
+        for (auto sprite : sprites)
+        {
+            auto tileX = sprite->generic.x / 32;
+            auto tileY = sprite->generic.y / 32;
+            if (tileX >= std::max(box[0], 0) / 32 && tileX <= box[2] / 32 && tileY >= std::max(box[1], 0) / 32
+                && tileY <= box[3] / 32)
+            {
+                expected.push_back(sprite->generic.sprite_index);
+            }
+        }
+
+        std::vector<uint16_t> visited;
+        bool stopped = sprite_query_box<rct_litter>(box[0], box[1], box[2], box[3], [&visited](rct_litter* litter) {
+            visited.push_back(litter->sprite_index);
+            return false;
+        });
+        EXPECT_FALSE(stopped);
+        std::sort(expected.begin(), expected.end());
+        std::sort(visited.begin(), visited.end());
+        EXPECT_EQ(visited, expected);
+    }
+
+    int32_t visited = 0;
+    EXPECT_TRUE(sprite_query_radius<rct_litter>(128, 128, 128, [&visited](rct_litter*) { return ++visited == 10; }));
+    EXPECT_EQ(visited, 10);
+}
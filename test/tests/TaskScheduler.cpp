@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <openrct2/core/TaskScheduler.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Enough tasks to exhaust the inline task slots of a thread several times.
+constexpr size_t TEST_TASK_COUNT = 4096;
+
+TEST(TaskSchedulerTest, run_all_tasks)
+{
+    TaskScheduler scheduler(4);
+    std::vector<int32_t> results(TEST_TASK_COUNT, 0);
+    {
+        TaskGroup group(scheduler);
+        for (size_t i = 0; i < TEST_TASK_COUNT; i++)
+        {
+            group.Run([&results, i]() { results[i] = (int32_t)i * 2; });
+        }
+        group.Wait();
+        ASSERT_EQ(group.CountPending(), 0U);
+    }
+    for (size_t i = 0; i < TEST_TASK_COUNT; i++)
+    {
+        ASSERT_EQ(results[i], (int32_t)i * 2);
+    }
+}
+
+TEST(TaskSchedulerTest, no_workers_runs_inline)
+{
+    TaskScheduler scheduler(0);
+    size_t count = 0;
+    TaskGroup group(scheduler);
+    for (size_t i = 0; i < 16; i++)
+    {
+        group.Run([&count]() { count++; });
+    }
+    group.Wait();
+    ASSERT_EQ(count, 16U);
+}
+
+TEST(TaskSchedulerTest, nested_fork_join)
+{
+    TaskScheduler scheduler(3);
+    std::atomic<size_t> count = { 0 };
+    TaskGroup outer(scheduler);
+    for (size_t i = 0; i < 64; i++)
+    {
+        outer.Run([&scheduler, &count]() {
+            TaskGroup inner(scheduler);
+            for (size_t j = 0; j < 64; j++)
+            {
+                inner.Run([&count]() { count++; });
+            }
+        });
+    }
+    outer.Wait();
+    ASSERT_EQ(count.load(), 64U * 64U);
+}
+
+TEST(TaskSchedulerTest, wait_reports_progress)
+{
+    TaskScheduler scheduler(2);
+    std::atomic<size_t> count = { 0 };
+    size_t reports = 0;
+    TaskGroup group(scheduler);
+    for (size_t i = 0; i < 256; i++)
+    {
+        group.Run([&count]() { count++; });
+    }
+    group.Wait([&reports]() { reports++; });
+    ASSERT_EQ(count.load(), 256U);
+    ASSERT_LE(reports, 256U);
+}
+
+TEST(TaskSchedulerTest, parallel_for)
+{
+    std::vector<uint64_t> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::atomic<uint64_t> sum = { 0 };
+    ParallelForRange(0, values.size(), 1000, [&values, &sum](size_t first, size_t last) {
+        uint64_t partial = 0;
+        for (size_t i = first; i < last; i++)
+        {
+            partial += values[i];
+        }
+        sum += partial;
+    });
+    ASSERT_EQ(sum.load(), (uint64_t)(values.size() - 1) * values.size() / 2);
+
+    std::vector<uint8_t> visited(values.size(), 0);
+    ParallelFor(0, visited.size(), 333, [&visited](size_t i) { visited[i]++; });
+    for (auto v : visited)
+    {
+        ASSERT_EQ(v, 1);
+    }
+}
@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+#include <openrct2/world/Map.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+class TileElementStorageTest : public testing::Test
+{
+protected:
+    // Base and clearance height of every element on a tile, the clearance height is used as a tag.
+    using TileContents = std::vector<std::pair<uint8_t, uint8_t>>;
+
+    void SetUp() override
+    {
+        for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
+        {
+            TileElement* tileElement = &gTileElements[i];
+            tileElement->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+            tileElement->SetLastForTile(true);
+            tileElement->base_height = 2;
+            tileElement->clearance_height = 0;
+        }
+        map_update_tile_pointers();
+    }
+
+    static TileContents GetContents(int32_t x, int32_t y)
+    {
+        TileContents contents;
+        const TileElement* tileElement = map_get_first_element_at(x, y);
+        do
+        {
+            contents.emplace_back(tileElement->base_height, tileElement->clearance_height);
+        } while (!(tileElement++)->IsLastForTile());
+        return contents;
+    }
+};
+
+TEST_F(TileElementStorageTest, insert_remove_matches_model)
+{
+    constexpr int32_t tileCount = 8;
+    std::vector<TileContents> model(tileCount * tileCount, TileContents{ { 2, 0 } });
+    uint32_t expectedCount = map_get_tile_element_count();
+
+    std::mt19937 rng(0);
+    uint8_t nextTag = 1;
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        int32_t x = rng() % tileCount;
+        int32_t y = rng() % tileCount;
+        auto& contents = model[x + y * tileCount];
+        if (contents.size() > 1 && rng() % 3 == 0)
+        {
+            size_t index = 1 + rng() % (contents.size() - 1);
+            tile_element_remove(map_get_first_element_at(x, y) + index);
+            contents.erase(contents.begin() + index);
+            expectedCount--;
+        }
+        else
+        {
+            uint8_t z = 2 + rng() % 32;
+            TileElement* inserted = tile_element_insert({ x, y, z }, 0);
+            ASSERT_NE(inserted, nullptr);
+            inserted->clearance_height = nextTag;
+
+            auto it = contents.begin();
+            while (it != contents.end() && z >= it->first)
+            {
+                it++;
+            }
+            contents.insert(it, { z, nextTag });
+            nextTag = nextTag == 255 ? 1 : nextTag + 1;
+            expectedCount++;
+        }
+
+        ASSERT_EQ(GetContents(x, y), contents);
+    }
+
+    ASSERT_EQ(map_get_tile_element_count(), expectedCount);
+    for (int32_t y = 0; y < tileCount; y++)
+    {
+        for (int32_t x = 0; x < tileCount; x++)
+        {
+            ASSERT_EQ(GetContents(x, y), model[x + y * tileCount]);
+        }
+    }
+
+    // Compacting keeps every tile intact.
+    map_reorganise_elements();
+    ASSERT_EQ(map_get_tile_element_count(), expectedCount);
+    for (int32_t y = 0; y < tileCount; y++)
+    {
+        for (int32_t x = 0; x < tileCount; x++)
+        {
+            ASSERT_EQ(GetContents(x, y), model[x + y * tileCount]);
+        }
+    }
+}
+
+TEST_F(TileElementStorageTest, grows_past_initial_block)
+{
+    // Far more elements than fit behind the loaded map in gTileElements.
+    for (int32_t i = 0; i < 16; i++)
+    {
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y += 4)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x += 4)
+            {
+                ASSERT_NE(tile_element_insert({ x, y, 2 + i }, 0), nullptr);
+            }
+        }
+    }
+    ASSERT_EQ(map_get_tile_element_count(), (uint32_t)(MAX_TILE_TILE_ELEMENT_POINTERS + 16 * 64 * 64));
+
+    auto contents = GetContents(4, 8);
+    ASSERT_EQ(contents.size(), 17U);
+    for (size_t i = 1; i < contents.size(); i++)
+    {
+        ASSERT_EQ(contents[i].first, 1 + i);
+    }
+}
+
+TEST_F(TileElementStorageTest, limit)
+{
+    ASSERT_TRUE(map_check_free_elements_and_reorganise(MAX_TILE_ELEMENTS - MAX_TILE_TILE_ELEMENT_POINTERS));
+    ASSERT_FALSE(map_check_free_elements_and_reorganise(MAX_TILE_ELEMENTS - MAX_TILE_TILE_ELEMENT_POINTERS + 1));
+}
+
+TEST_F(TileElementStorageTest, every_tile_has_elements)
+{
+    // Tiles in every chunk up to the technical maximum can be used.
+    TileElement* inserted = tile_element_insert({ MAXIMUM_MAP_SIZE_TECHNICAL - 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1, 4 }, 0);
+    ASSERT_NE(inserted, nullptr);
+    ASSERT_EQ(map_get_tile_element_count(), MAX_TILE_TILE_ELEMENT_POINTERS + 1U);
+
+    map_reorganise_elements();
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            ASSERT_NE(map_get_first_element_at(x, y), nullptr);
+        }
+    }
+    ASSERT_EQ(map_get_tile_element_count(), MAX_TILE_TILE_ELEMENT_POINTERS + 1U);
+    ASSERT_EQ(
+        GetContents(MAXIMUM_MAP_SIZE_TECHNICAL - 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1), TileContents({ { 2, 0 }, { 4, 4 } }));
+}
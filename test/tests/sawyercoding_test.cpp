@@ -11,9 +11,67 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <random>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
+/**
+ * Reads from memory without exposing it, so that chunk readers take the same path as for files.
+ */
+class UnmappedStream final : public IStream
+{
+private:
+    MemoryStream _stream;
+
+public:
+    UnmappedStream(const void* data, size_t dataSize)
+        : _stream(data, dataSize)
+    {
+    }
+
+    bool CanRead() const override
+    {
+        return true;
+    }
+    bool CanWrite() const override
+    {
+        return false;
+    }
+    uint64_t GetLength() const override
+    {
+        return _stream.GetLength();
+    }
+    uint64_t GetPosition() const override
+    {
+        return _stream.GetPosition();
+    }
+    void SetPosition(uint64_t position) override
+    {
+        _stream.SetPosition(position);
+    }
+    void Seek(int64_t offset, int32_t origin) override
+    {
+        _stream.Seek(offset, origin);
+    }
+    void Read(void* buffer, uint64_t length) override
+    {
+        _stream.Read(buffer, length);
+    }
+    void Write(const void* buffer, uint64_t length) override
+    {
+        throw IOException("Stream is read only.");
+    }
+    uint64_t TryRead(void* buffer, uint64_t length) override
+    {
+        return _stream.TryRead(buffer, length);
+    }
+    const void* GetData() const override
+    {
+        return nullptr;
+    }
+};
+
 class SawyerCodingTest : public testing::Test
 {
 protected:
@@ -45,6 +103,66 @@ protected:
         delete[] encodedDataBuffer;
     }
 
+    // Random data made of literal stretches and runs of various lengths, so that every RLE code is produced.
+    static std::vector<uint8_t> CreateRunData(std::mt19937& rng, size_t length)
+    {
+        std::vector<uint8_t> data;
+        data.reserve(length);
+        while (data.size() < length)
+        {
+            auto count = std::min<size_t>(length - data.size(), rng() % 300 + 1);
+            if (rng() % 2 == 0)
+            {
+                data.insert(data.end(), count, (uint8_t)rng());
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    data.push_back((uint8_t)rng());
+                }
+            }
+        }
+        return data;
+    }
+
+    static std::vector<uint8_t> Encode(const std::vector<uint8_t>& data, uint8_t encoding)
+    {
+        sawyercoding_chunk_header header;
+        header.encoding = encoding;
+        header.length = (uint32_t)data.size();
+        std::vector<uint8_t> encoded(BUFFER_SIZE);
+        encoded.resize(sawyercoding_write_chunk_buffer(encoded.data(), data.data(), header));
+        return encoded;
+    }
+
+    // Decodes the chunk with both the buffered and the streaming readers, from memory and as if from a file.
+    static void test_decode_equivalence(const std::vector<uint8_t>& encoded, const std::vector<uint8_t>& expected)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        auto chunk = SawyerChunkReader(&ms).ReadChunk();
+        ASSERT_EQ(chunk->GetLength(), expected.size());
+        ASSERT_EQ(memcmp(chunk->GetData(), expected.data(), expected.size()), 0);
+
+        for (auto length : { expected.size(), expected.size() / 2 + 1, expected.size() + 100 })
+        {
+            std::vector<uint8_t> expectedDst(length, 0);
+            std::copy_n(expected.begin(), std::min(length, expected.size()), expectedDst.begin());
+
+            std::vector<uint8_t> dst(length, 0xCC);
+            MemoryStream memoryStream(encoded.data(), encoded.size());
+            SawyerChunkReader(&memoryStream).ReadChunk(dst.data(), dst.size());
+            ASSERT_EQ(dst, expectedDst);
+            ASSERT_EQ(memoryStream.GetPosition(), encoded.size());
+
+            std::fill(dst.begin(), dst.end(), 0xCC);
+            UnmappedStream unmappedStream(encoded.data(), encoded.size());
+            SawyerChunkReader(&unmappedStream).ReadChunk(dst.data(), dst.size());
+            ASSERT_EQ(dst, expectedDst);
+            ASSERT_EQ(unmappedStream.GetPosition(), encoded.size());
+        }
+    }
+
     void test_decode(const uint8_t* data, size_t size)
     {
         auto expectedLength = size - sizeof(sawyercoding_chunk_header);
@@ -106,6 +224,229 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, fuzz_rle_matches_reference)
+{
+    std::mt19937 rng(0);
+    for (int32_t i = 0; i < 200; i++)
+    {
+        auto length = (i % 20 == 0) ? rng() % 0x200000 + 1 : rng() % 5000 + 1;
+        auto data = CreateRunData(rng, length);
+        auto encoded = Encode(data, CHUNK_ENCODING_RLE);
+
+        // The SV4 decoder in SawyerCoding.cpp is the reference RLE decoder, it expects a checksum after the data
+        auto payload = std::vector<uint8_t>(encoded.begin() + sizeof(sawyercoding_chunk_header), encoded.end());
+        payload.resize(payload.size() + 4);
+        std::vector<uint8_t> reference(data.size());
+        auto referenceLength = sawyercoding_decode_sv4(
+            payload.data(), reference.data(), payload.size(), reference.size());
+        ASSERT_EQ(referenceLength, data.size());
+        ASSERT_EQ(reference, data);
+
+        test_decode_equivalence(encoded, reference);
+    }
+}
+
+TEST_F(SawyerCodingTest, fuzz_rotate_matches_reference)
+{
+    std::mt19937 rng(1);
+    for (int32_t i = 0; i < 200; i++)
+    {
+        auto data = CreateRunData(rng, rng() % 5000 + 1);
+        test_decode_equivalence(Encode(data, CHUNK_ENCODING_ROTATE), data);
+    }
+}
+
+TEST_F(SawyerCodingTest, fuzz_none_and_rlecompressed_match_reference)
+{
+    std::mt19937 rng(2);
+    for (int32_t i = 0; i < 50; i++)
+    {
+        auto data = CreateRunData(rng, rng() % 5000 + 1);
+        test_decode_equivalence(Encode(data, CHUNK_ENCODING_NONE), data);
+        test_decode_equivalence(Encode(data, CHUNK_ENCODING_RLECOMPRESSED), data);
+    }
+}
+
+TEST_F(SawyerCodingTest, fuzz_corrupt_rle_is_handled_consistently)
+{
+    std::mt19937 rng(3);
+    for (int32_t i = 0; i < 500; i++)
+    {
+        std::vector<uint8_t> encoded(sizeof(sawyercoding_chunk_header) + rng() % 512 + 1);
+        for (auto& b : encoded)
+        {
+            b = (uint8_t)rng();
+        }
+        sawyercoding_chunk_header header;
+        header.encoding = CHUNK_ENCODING_RLE;
+        header.length = (uint32_t)(encoded.size() - sizeof(sawyercoding_chunk_header));
+        std::memcpy(encoded.data(), &header, sizeof(header));
+
+        // Random data is usually cut off in the middle of a run, but either way every reader has to agree
+        std::vector<uint8_t> expected;
+        bool isValid = true;
+        try
+        {
+            MemoryStream ms(encoded.data(), encoded.size());
+            auto chunk = SawyerChunkReader(&ms).ReadChunk();
+            auto chunkData = (const uint8_t*)chunk->GetData();
+            expected.assign(chunkData, chunkData + chunk->GetLength());
+        }
+        catch (const IOException&)
+        {
+            isValid = false;
+        }
+
+        if (isValid)
+        {
+            test_decode_equivalence(encoded, expected);
+        }
+        else
+        {
+            std::vector<uint8_t> dst(1024);
+            MemoryStream memoryStream(encoded.data(), encoded.size());
+            EXPECT_THROW(SawyerChunkReader(&memoryStream).ReadChunk(dst.data(), dst.size()), IOException);
+            EXPECT_EQ(memoryStream.GetPosition(), 0u);
+            UnmappedStream unmappedStream(encoded.data(), encoded.size());
+            EXPECT_THROW(SawyerChunkReader(&unmappedStream).ReadChunk(dst.data(), dst.size()), IOException);
+            EXPECT_EQ(unmappedStream.GetPosition(), 0u);
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, truncated_chunk_throws)
+{
+    std::mt19937 rng(4);
+    auto data = CreateRunData(rng, 4000);
+    for (auto encoding : { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_ROTATE })
+    {
+        auto encoded = Encode(data, encoding);
+        encoded.resize(encoded.size() - 1);
+
+        std::vector<uint8_t> dst(data.size());
+        MemoryStream memoryStream(encoded.data(), encoded.size());
+        EXPECT_THROW(SawyerChunkReader(&memoryStream).ReadChunk(dst.data(), dst.size()), IOException);
+        UnmappedStream unmappedStream(encoded.data(), encoded.size());
+        EXPECT_THROW(SawyerChunkReader(&unmappedStream).ReadChunk(dst.data(), dst.size()), IOException);
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunks_matches_sequential_reads)
+{
+    std::mt19937 rng(5);
+    const uint8_t encodings[] = { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED,
+                                  CHUNK_ENCODING_ROTATE };
+    std::vector<uint8_t> encoded;
+    std::vector<size_t> lengths;
+    for (size_t i = 0; i < 20; i++)
+    {
+        auto data = CreateRunData(rng, (i == 2) ? 0x100000 : rng() % 5000 + 1);
+        auto chunk = Encode(data, encodings[i % 4]);
+        encoded.insert(encoded.end(), chunk.begin(), chunk.end());
+        // Destinations that are smaller, the same size and larger than the chunk
+        lengths.push_back(data.size() + (i % 3) * 50 - 50);
+    }
+
+    std::vector<std::vector<uint8_t>> expected;
+    MemoryStream sequentialStream(encoded.data(), encoded.size());
+    SawyerChunkReader sequentialReader(&sequentialStream);
+    for (auto length : lengths)
+    {
+        expected.emplace_back(length);
+        sequentialReader.ReadChunk(expected.back().data(), length);
+    }
+
+    MemoryStream memoryStream(encoded.data(), encoded.size());
+    UnmappedStream unmappedStream(encoded.data(), encoded.size());
+    for (IStream* stream : std::initializer_list<IStream*>{ &memoryStream, &unmappedStream })
+    {
+        std::vector<std::vector<uint8_t>> actual;
+        std::vector<SawyerChunkDestination> destinations;
+        for (auto length : lengths)
+        {
+            actual.emplace_back(length, 0xCC);
+            destinations.push_back({ actual.back().data(), length });
+        }
+        SawyerChunkReader(stream).ReadChunks(destinations);
+        ASSERT_EQ(actual, expected);
+        ASSERT_EQ(stream->GetPosition(), encoded.size());
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunks_with_corrupt_chunk_throws)
+{
+    std::mt19937 rng(6);
+    std::vector<uint8_t> valid;
+    std::vector<uint8_t> corrupt;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto chunk = Encode(CreateRunData(rng, 1000), CHUNK_ENCODING_RLE);
+        valid.insert(valid.end(), chunk.begin(), chunk.end());
+        if (i == 5)
+        {
+            // A literal run of 128 bytes with only one of them present
+            chunk = { CHUNK_ENCODING_RLE, 2, 0, 0, 0, 0x7F, 0x00 };
+        }
+        corrupt.insert(corrupt.end(), chunk.begin(), chunk.end());
+    }
+    // The last chunk claims to be longer than the stream
+    auto truncated = std::vector<uint8_t>(valid.begin(), valid.end() - 1);
+
+    std::vector<uint8_t> dst(1000 * 8);
+    std::vector<SawyerChunkDestination> destinations;
+    for (size_t i = 0; i < 8; i++)
+    {
+        destinations.push_back({ dst.data() + i * 1000, 1000 });
+    }
+
+    for (const auto& encoded : { corrupt, truncated })
+    {
+        MemoryStream memoryStream(encoded.data(), encoded.size());
+        EXPECT_THROW(SawyerChunkReader(&memoryStream).ReadChunks(destinations), IOException);
+        EXPECT_EQ(memoryStream.GetPosition(), 0u);
+
+        UnmappedStream unmappedStream(encoded.data(), encoded.size());
+        EXPECT_THROW(SawyerChunkReader(&unmappedStream).ReadChunks(destinations), IOException);
+        EXPECT_EQ(unmappedStream.GetPosition(), 0u);
+    }
+
+    MemoryStream validStream(valid.data(), valid.size());
+    EXPECT_NO_THROW(SawyerChunkReader(&validStream).ReadChunks(destinations));
+}
+
+TEST_F(SawyerCodingTest, read_chunk_range_matches_full_read)
+{
+    std::mt19937 rng(7);
+    const uint8_t encodings[] = { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED,
+                                  CHUNK_ENCODING_ROTATE };
+    for (size_t i = 0; i < 40; i++)
+    {
+        auto data = CreateRunData(rng, rng() % 5000 + 1);
+        auto encoded = Encode(data, encodings[i % 4]);
+        // Ranges inside the chunk, running past its end and starting past its end
+        size_t offset = (i % 5 == 4) ? data.size() + 10 : rng() % data.size();
+        size_t length = rng() % 3000 + 1;
+
+        std::vector<uint8_t> expected(length, 0);
+        if (offset < data.size())
+        {
+            std::copy_n(data.begin() + offset, std::min(length, data.size() - offset), expected.begin());
+        }
+
+        std::vector<uint8_t> dst(length, 0xCC);
+        MemoryStream memoryStream(encoded.data(), encoded.size());
+        SawyerChunkReader(&memoryStream).ReadChunkRange(dst.data(), offset, dst.size());
+        ASSERT_EQ(dst, expected);
+        ASSERT_EQ(memoryStream.GetPosition(), encoded.size());
+
+        std::fill(dst.begin(), dst.end(), 0xCC);
+        UnmappedStream unmappedStream(encoded.data(), encoded.size());
+        SawyerChunkReader(&unmappedStream).ReadChunkRange(dst.data(), offset, dst.size());
+        ASSERT_EQ(dst, expected);
+        ASSERT_EQ(unmappedStream.GetPosition(), encoded.size());
+    }
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {